@@ -0,0 +1,171 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/behavior.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/scoped_actor.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace caf;
+
+namespace {
+
+// -- spawning and terminating actors ------------------------------------------
+
+// Spawns `range(0)` actors and waits for them to terminate. With `range(1)`
+// set, all actors collect metrics, which requires a lookup in the metric
+// registry for each new actor.
+void actor_spawn_terminate(benchmark::State& state) {
+  auto n = state.range(0);
+  actor_system_config cfg;
+  if (state.range(1) != 0)
+    cfg.set("caf.metrics-filters.actors.includes",
+            std::vector<std::string>{"*"});
+  actor_system sys{cfg};
+  for (auto _ : state) {
+    for (int64_t i = 0; i < n; ++i)
+      sys.spawn([] {});
+    sys.await_all_actors_done();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(actor_spawn_terminate)
+  ->ArgNames({"n", "metrics"})
+  ->ArgsProduct({{1, 1'000}, {0, 1}})
+  ->UseRealTime();
+
+// Spawns short-lived actors from multiple threads at once. Stresses the actor
+// ID allocation and the running-actors count.
+std::unique_ptr<actor_system_config> spawn_threads_cfg;
+std::unique_ptr<actor_system> spawn_threads_sys;
+
+void actor_spawn_terminate_threads(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    spawn_threads_cfg = std::make_unique<actor_system_config>();
+    spawn_threads_sys = std::make_unique<actor_system>(*spawn_threads_cfg);
+  }
+  for (auto _ : state)
+    spawn_threads_sys->spawn([] {});
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    spawn_threads_sys->await_all_actors_done();
+    spawn_threads_sys.reset();
+    spawn_threads_cfg.reset();
+  }
+}
+
+BENCHMARK(actor_spawn_terminate_threads)->ThreadRange(1, 64)->UseRealTime();
+
+// -- request/response round-trips ---------------------------------------------
+
+void actor_request_response(benchmark::State& state) {
+  actor_system_config cfg;
+  actor_system sys{cfg};
+  auto echo = sys.spawn([]() -> behavior {
+    return {
+      [](int32_t x) { return x; },
+    };
+  });
+  scoped_actor self{sys};
+  for (auto _ : state) {
+    self->mail(int32_t{42}).request(echo, infinite).receive(
+      [](int32_t x) { benchmark::DoNotOptimize(x); },
+      [&state](const error&) { state.SkipWithError("request failed"); });
+  }
+  self->send_exit(echo, exit_reason::user_shutdown);
+}
+
+BENCHMARK(actor_request_response)->UseRealTime();
+
+// -- processing many pending messages -----------------------------------------
+
+// Fills the mailbox of a new actor with `range(0)` integers and measures how
+// long it takes to process them, optionally with a batch handler (`range(1)`).
+void actor_process_pending(benchmark::State& state) {
+  auto n = state.range(0);
+  auto use_batch_handler = state.range(1) != 0;
+  actor_system_config cfg;
+  actor_system sys{cfg};
+  scoped_actor self{sys};
+  auto observer = actor{self};
+  for (auto _ : state) {
+    self->spawn([=](event_based_actor* aut) -> behavior {
+      auto sum = std::make_shared<int64_t>(0);
+      if (use_batch_handler)
+        aut->set_batch_handler<int32_t>([sum](span<int32_t> xs) {
+          for (auto x : xs)
+            *sum += x;
+        });
+      for (int64_t i = 0; i < n; ++i)
+        aut->mail(int32_t{1}).send(aut);
+      aut->mail(ok_atom_v).send(aut);
+      return {
+        [sum](int32_t x) { *sum += x; },
+        [aut, sum, observer](ok_atom) {
+          aut->mail(*sum).send(observer);
+          aut->quit();
+        },
+      };
+    });
+    self->receive([](int64_t sum) { benchmark::DoNotOptimize(sum); });
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(actor_process_pending)
+  ->ArgNames({"n", "batch_handler"})
+  ->Args({10'000, 0})
+  ->Args({10'000, 1})
+  ->UseRealTime();
+
+// -- selecting handlers of a behavior ---------------------------------------
+
+using handler_types
+  = std::tuple<int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t,
+               uint64_t, float, double, std::string, bool>;
+
+constexpr size_t num_handler_types = std::tuple_size_v<handler_types>;
+
+// Returns a handler with a unique signature for each `I` (up to 144).
+template <size_t I>
+auto make_handler() {
+  using t1 = std::tuple_element_t<I / num_handler_types, handler_types>;
+  using t2 = std::tuple_element_t<I % num_handler_types, handler_types>;
+  return [](const t1&, const t2&) { return static_cast<int32_t>(I); };
+}
+
+template <size_t... Is>
+behavior make_test_behavior(std::index_sequence<Is...>) {
+  return behavior{make_handler<Is>()...};
+}
+
+// Sends a message to a behavior with `N` handlers that matches the last one.
+template <size_t N>
+void behavior_dispatch(benchmark::State& state) {
+  auto bhvr = make_test_behavior(std::make_index_sequence<N>{});
+  using t1 = std::tuple_element_t<(N - 1) / num_handler_types, handler_types>;
+  using t2 = std::tuple_element_t<(N - 1) % num_handler_types, handler_types>;
+  auto msg = make_message(t1{}, t2{});
+  for (auto _ : state) {
+    auto res = bhvr(msg);
+    benchmark::DoNotOptimize(res);
+  }
+}
+
+BENCHMARK_TEMPLATE(behavior_dispatch, 1);
+BENCHMARK_TEMPLATE(behavior_dispatch, 8);
+BENCHMARK_TEMPLATE(behavior_dispatch, 32);
+BENCHMARK_TEMPLATE(behavior_dispatch, 128);
+
+} // namespace
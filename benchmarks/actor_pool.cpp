@@ -0,0 +1,92 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/actor_pool.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/anon_mail.hpp"
+#include "caf/behavior.hpp"
+#include "caf/exit_reason.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <memory>
+
+using namespace caf;
+
+CAF_PUSH_DEPRECATED_WARNING
+
+namespace {
+
+using policy_factory = std::function<actor_pool::policy()>;
+
+std::unique_ptr<actor_system_config> pool_cfg;
+std::unique_ptr<actor_system> pool_sys;
+actor pool;
+
+// Sends messages to a pool with eight workers from multiple threads at once.
+// All senders dispatch concurrently, i.e., the benchmark shows the overhead of
+// each policy as well as how well it scales with the number of senders.
+void actor_pool_dispatch(benchmark::State& state, policy_factory make_policy) {
+  if (state.thread_index() == 0) {
+    pool_cfg = std::make_unique<actor_system_config>();
+    pool_sys = std::make_unique<actor_system>(*pool_cfg);
+    auto spawn_worker = [] {
+      return pool_sys->spawn([]() -> behavior {
+        return {
+          [](int32_t) {},
+        };
+      });
+    };
+    pool = actor_pool::make(*pool_sys, 8, spawn_worker, make_policy());
+  }
+  int32_t value = 0;
+  for (auto _ : state)
+    anon_mail(value++).send(pool);
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    anon_send_exit(pool, exit_reason::user_shutdown);
+    pool = nullptr;
+    pool_sys->await_all_actors_done();
+    pool_sys.reset();
+    pool_cfg.reset();
+  }
+}
+
+uint64_t message_key(const message& msg) {
+  return static_cast<uint64_t>(msg.get_as<int32_t>(0));
+}
+
+BENCHMARK_CAPTURE(actor_pool_dispatch, round_robin,
+                  policy_factory{actor_pool::round_robin})
+  ->ThreadRange(1, 8)
+  ->UseRealTime();
+
+BENCHMARK_CAPTURE(actor_pool_dispatch, random,
+                  policy_factory{actor_pool::random})
+  ->ThreadRange(1, 8)
+  ->UseRealTime();
+
+BENCHMARK_CAPTURE(actor_pool_dispatch, least_loaded,
+                  policy_factory{actor_pool::least_loaded})
+  ->ThreadRange(1, 8)
+  ->UseRealTime();
+
+BENCHMARK_CAPTURE(actor_pool_dispatch, power_of_two_choices,
+                  policy_factory{actor_pool::power_of_two_choices})
+  ->ThreadRange(1, 8)
+  ->UseRealTime();
+
+BENCHMARK_CAPTURE(actor_pool_dispatch, consistent_hashing,
+                  policy_factory{[] {
+                    return actor_pool::consistent_hashing(message_key);
+                  }})
+  ->ThreadRange(1, 8)
+  ->UseRealTime();
+
+} // namespace
+
+CAF_POP_WARNINGS
@@ -0,0 +1,107 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/action.hpp"
+#include "caf/actor_clock.hpp"
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/disposable.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace caf;
+using namespace std::literals;
+
+namespace {
+
+// Schedules and cancels `n` timeouts. Actors usually cancel most of their
+// timeouts, e.g., for requests that received a response.
+void clock_schedule_dispose(benchmark::State& state, std::string policy) {
+  auto n = state.range(0);
+  actor_system_config cfg;
+  cfg.set("caf.clock.policy", policy);
+  actor_system sys{cfg};
+  auto& clock = sys.clock();
+  std::vector<disposable> pending;
+  pending.reserve(static_cast<size_t>(n));
+  for (auto _ : state) {
+    auto t = clock.now() + 1h;
+    for (int64_t i = 0; i < n; ++i)
+      pending.push_back(clock.schedule(t + std::chrono::microseconds{i},
+                                       make_action([] {})));
+    for (auto& hdl : pending)
+      hdl.dispose();
+    pending.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK_CAPTURE(clock_schedule_dispose, default, std::string{"default"})
+  ->Arg(1'000)
+  ->UseRealTime();
+
+BENCHMARK_CAPTURE(clock_schedule_dispose, timing_wheel,
+                  std::string{"timing-wheel"})
+  ->Arg(1'000)
+  ->UseRealTime();
+
+// Schedules and cancels timeouts at random points in time while `n` other
+// timeouts are pending, e.g., the idle timeouts of many actors. Adding the
+// pending timeouts is part of the setup, so we run a fixed number of
+// iterations to avoid repeating it. Note: the default clock scans all pending
+// timeouts whenever it receives a new one. Hence, its setup for 1M pending
+// timeouts takes very long. Pass `--benchmark_filter=-default/1000000` to skip
+// that case.
+void clock_schedule_with_pending(benchmark::State& state, std::string policy) {
+  constexpr int64_t batch_size = 1'000;
+  auto n = state.range(0);
+  actor_system_config cfg;
+  cfg.set("caf.clock.policy", policy);
+  actor_system sys{cfg};
+  auto& clock = sys.clock();
+  auto t0 = clock.now() + 1h;
+  std::vector<disposable> pending;
+  pending.reserve(static_cast<size_t>(n));
+  for (int64_t i = 0; i < n; ++i)
+    pending.push_back(clock.schedule(t0 + std::chrono::microseconds{i},
+                                     make_action([] {})));
+  std::minstd_rand rng{42};
+  std::uniform_int_distribution<int64_t> offset{0, n};
+  std::vector<disposable> batch;
+  batch.reserve(batch_size);
+  for (auto _ : state) {
+    for (int64_t i = 0; i < batch_size; ++i) {
+      auto t = t0 + std::chrono::microseconds{offset(rng)};
+      batch.push_back(clock.schedule(t, make_action([] {})));
+    }
+    for (auto& hdl : batch)
+      hdl.dispose();
+    batch.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * batch_size);
+  for (auto& hdl : pending)
+    hdl.dispose();
+}
+
+BENCHMARK_CAPTURE(clock_schedule_with_pending, default, std::string{"default"})
+  ->Arg(10'000)
+  ->Arg(1'000'000)
+  ->Iterations(10)
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
+
+BENCHMARK_CAPTURE(clock_schedule_with_pending, timing_wheel,
+                  std::string{"timing-wheel"})
+  ->Arg(10'000)
+  ->Arg(1'000'000)
+  ->Iterations(10)
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
+
+} // namespace
@@ -0,0 +1,175 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/async/spsc_buffer.hpp"
+#include "caf/flow/observable.hpp"
+#include "caf/flow/observable_builder.hpp"
+#include "caf/flow/scoped_coordinator.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+
+namespace {
+
+void flow_map_filter(benchmark::State& state) {
+  auto n = static_cast<size_t>(state.range(0));
+  auto ctx = flow::make_scoped_coordinator();
+  for (auto _ : state) {
+    auto sum = int64_t{0};
+    ctx->make_observable()
+      .range(int64_t{0}, n)
+      .map([](int64_t x) { return x * 3; })
+      .filter([](int64_t x) { return x % 2 == 0; })
+      .for_each([&sum](int64_t x) { sum += x; });
+    ctx->run();
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+
+BENCHMARK(flow_map_filter)->Arg(1'000)->Arg(100'000);
+
+void flow_merge(benchmark::State& state) {
+  auto n = static_cast<size_t>(state.range(0));
+  auto ctx = flow::make_scoped_coordinator();
+  for (auto _ : state) {
+    auto sum = int64_t{0};
+    auto src = ctx->make_observable().range(int64_t{0}, n / 4).as_observable();
+    src.merge(src, src, src).for_each([&sum](int64_t x) { sum += x; });
+    ctx->run();
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+
+BENCHMARK(flow_merge)->Arg(1'000)->Arg(100'000);
+
+// Producer that receives demand from the consumer thread.
+class bench_producer : public ref_counted, public async::producer {
+public:
+  void on_consumer_ready() override {
+    // nop
+  }
+
+  void on_consumer_cancel() override {
+    // nop
+  }
+
+  void on_consumer_demand(size_t new_demand) override {
+    demand += new_demand;
+  }
+
+  void ref_producer() const noexcept override {
+    ref();
+  }
+
+  void deref_producer() const noexcept override {
+    deref();
+  }
+
+  CAF_INTRUSIVE_PTR_FRIENDS(bench_producer)
+
+  std::atomic<size_t> demand = 0;
+};
+
+// Consumer that receives wakeups from the producer thread.
+class bench_consumer : public ref_counted, public async::consumer {
+public:
+  void on_producer_ready() override {
+    // nop
+  }
+
+  void on_producer_wakeup() override {
+    wakeup = true;
+  }
+
+  void ref_consumer() const noexcept override {
+    ref();
+  }
+
+  void deref_consumer() const noexcept override {
+    deref();
+  }
+
+  CAF_INTRUSIVE_PTR_FRIENDS(bench_consumer)
+
+  std::atomic<bool> wakeup = false;
+};
+
+struct sum_observer {
+  void on_next(int64_t x) {
+    sum += x;
+  }
+
+  void on_error(const error&) {
+    // nop
+  }
+
+  void on_complete() {
+    // nop
+  }
+
+  int64_t sum = 0;
+};
+
+// Pushes items from a producer thread through an SPSC buffer to the benchmark
+// thread. The producer pushes up to 32 items at once, as flow operators do.
+void flow_spsc_buffer_throughput(benchmark::State& state) {
+  constexpr size_t batch_size = 32;
+  constexpr size_t n = 1'000'000;
+  auto capacity = static_cast<uint32_t>(state.range(0));
+  for (auto _ : state) {
+    auto prod = make_counted<bench_producer>();
+    auto cons = make_counted<bench_consumer>();
+    auto buf = make_counted<async::spsc_buffer<int64_t>>(capacity,
+                                                         capacity / 4);
+    buf->set_consumer(cons);
+    auto producer_thread = std::thread{[buf, prod] {
+      buf->set_producer(prod);
+      std::vector<int64_t> batch;
+      auto credit = size_t{0};
+      auto next = size_t{0};
+      while (next < n) {
+        credit += prod->demand.exchange(0);
+        if (credit == 0) {
+          std::this_thread::yield();
+          continue;
+        }
+        auto k = std::min({credit, batch_size, n - next});
+        batch.clear();
+        for (size_t i = 0; i < k; ++i)
+          batch.push_back(static_cast<int64_t>(next++));
+        buf->push(make_span(batch));
+        credit -= k;
+      }
+      buf->close();
+    }};
+    sum_observer obs;
+    for (;;) {
+      auto [again, consumed] = buf->pull(async::delay_errors, capacity, obs);
+      if (!again)
+        break;
+      if (consumed == 0)
+        while (!cons->wakeup.exchange(false))
+          std::this_thread::yield();
+    }
+    producer_thread.join();
+    benchmark::DoNotOptimize(obs.sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * n));
+}
+
+BENCHMARK(flow_spsc_buffer_throughput)
+  ->Arg(64)
+  ->Arg(1'024)
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
+
+} // namespace
@@ -0,0 +1,98 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/http_route_trie.hpp"
+
+#include "caf/net/http/request_header.hpp"
+#include "caf/net/http/responder.hpp"
+#include "caf/net/http/route.hpp"
+#include "caf/net/http/router.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace caf;
+
+namespace http = caf::net::http;
+
+namespace {
+
+// Creates `n` routes in the style of a REST API, i.e., a collection route and
+// an item route with an integer ID for each resource.
+std::vector<http::route_ptr> make_routes(size_t n) {
+  std::vector<http::route_ptr> result;
+  result.reserve(n);
+  for (size_t i = 0; result.size() < n; ++i) {
+    auto path = "/api/v1/resource" + std::to_string(i);
+    result.push_back(*http::make_route(path, [](http::responder&) {}));
+    if (result.size() < n) {
+      path += "/<arg>";
+      result.push_back(*http::make_route(path, [](http::responder&, int) {}));
+    }
+  }
+  return result;
+}
+
+// Parses a GET request for the last route, i.e., the worst case for trying all
+// routes in order.
+http::request_header make_request(size_t n, std::string& buf) {
+  buf = "GET /api/v1/resource" + std::to_string((n - 1) / 2);
+  if (n % 2 == 0)
+    buf += "/42";
+  buf += " HTTP/1.1\r\nHost: localhost:8080\r\n\r\n";
+  http::request_header hdr;
+  auto [status, err_msg] = hdr.parse(buf);
+  if (status != http::status::ok) {
+    fprintf(stderr, "failed to parse request: %s\n", err_msg.data());
+    abort();
+  }
+  return hdr;
+}
+
+// Calls `exec` on each route until one accepts the request, i.e., the dispatch
+// prior to the route trie. Serves as baseline.
+void http_router_linear(benchmark::State& state) {
+  auto n = static_cast<size_t>(state.range(0));
+  auto routes = make_routes(n);
+  for (auto& ptr : routes)
+    ptr->init();
+  std::string buf;
+  auto hdr = make_request(n, buf);
+  http::router rt;
+  for (auto _ : state) {
+    auto accepted = false;
+    for (auto& ptr : routes)
+      if (ptr->exec(hdr, {}, &rt)) {
+        accepted = true;
+        break;
+      }
+    benchmark::DoNotOptimize(accepted);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(http_router_linear)->Arg(10)->Arg(100)->Arg(1000);
+
+void http_router_trie(benchmark::State& state) {
+  auto n = static_cast<size_t>(state.range(0));
+  detail::http_route_trie trie{make_routes(n)};
+  for (auto& ptr : trie.routes())
+    ptr->init();
+  std::string buf;
+  auto hdr = make_request(n, buf);
+  http::router rt;
+  std::vector<size_t> candidates;
+  for (auto _ : state) {
+    auto accepted = trie.exec(hdr, {}, &rt, candidates);
+    benchmark::DoNotOptimize(accepted);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(http_router_trie)->Arg(10)->Arg(100)->Arg(1000);
+
+} // namespace
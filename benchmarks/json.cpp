@@ -0,0 +1,87 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/expected.hpp"
+#include "caf/json_value.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+using namespace caf;
+
+namespace {
+
+// Generates a JSON array with `n` objects.
+std::string make_document(int64_t n) {
+  std::string result = "[";
+  for (int64_t i = 0; i < n; ++i) {
+    if (i > 0)
+      result += ',';
+    auto id = std::to_string(i);
+    result += R"({"id":)";
+    result += id;
+    result += R"(,"name":"user-)";
+    result += id;
+    result += R"(","score":)";
+    result += id;
+    result += R"(.5,"active":true,"tags":["a","b\n","c"],"parent":null})";
+  }
+  result += ']';
+  return result;
+}
+
+// Parses the document from a file. The file parser reads one character at a
+// time, i.e., never builds the structural index. Serves as baseline for
+// `json_parse`.
+void json_parse_file(benchmark::State& state) {
+  auto doc = make_document(state.range(0));
+  auto path = std::filesystem::temp_directory_path() / "caf-bench-json.json";
+  std::ofstream{path} << doc;
+  auto path_str = path.string();
+  for (auto _ : state) {
+    auto val = json_value::parse_file(path_str);
+    if (!val)
+      state.SkipWithError("failed to parse JSON");
+    benchmark::DoNotOptimize(val);
+  }
+  std::filesystem::remove(path);
+  auto total = state.iterations() * doc.size();
+  state.SetBytesProcessed(static_cast<int64_t>(total));
+}
+
+BENCHMARK(json_parse_file)->Arg(10)->Arg(10'000);
+
+void json_parse(benchmark::State& state) {
+  auto doc = make_document(state.range(0));
+  for (auto _ : state) {
+    auto val = json_value::parse(doc);
+    if (!val)
+      state.SkipWithError("failed to parse JSON");
+    benchmark::DoNotOptimize(val);
+  }
+  auto total = state.iterations() * doc.size();
+  state.SetBytesProcessed(static_cast<int64_t>(total));
+}
+
+BENCHMARK(json_parse)->Arg(10)->Arg(10'000);
+
+void json_parse_shallow(benchmark::State& state) {
+  auto doc = make_document(state.range(0));
+  for (auto _ : state) {
+    auto val = json_value::parse_shallow(doc);
+    if (!val)
+      state.SkipWithError("failed to parse JSON");
+    benchmark::DoNotOptimize(val);
+  }
+  auto total = state.iterations() * doc.size();
+  state.SetBytesProcessed(static_cast<int64_t>(total));
+}
+
+BENCHMARK(json_parse_shallow)->Arg(10)->Arg(10'000);
+
+} // namespace
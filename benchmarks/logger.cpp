@@ -0,0 +1,67 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/logger.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/log/level.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <string>
+
+using namespace caf;
+
+namespace {
+
+// Logs events with severity `level` to a file with verbosity `info`, i.e.,
+// `debug` and `trace` events measure the cost of filtered events. With
+// `range(0)` set, the logger writes its binary format instead of text.
+void logger_log(benchmark::State& state, unsigned level) {
+  auto path = std::filesystem::temp_directory_path() / "caf-bench.log";
+  {
+    actor_system_config cfg;
+    cfg.set("caf.logger.file.path", path.string());
+    cfg.set("caf.logger.file.verbosity", "info");
+    cfg.set("caf.logger.console.verbosity", "quiet");
+    cfg.set("caf.logger.file.binary", state.range(0) != 0);
+    actor_system sys{cfg};
+    logger::current_logger(&sys);
+    int64_t value = 0;
+    for (auto _ : state)
+      logger::log(level, "caf.bench", "event number {}", value++);
+    state.SetItemsProcessed(state.iterations());
+    logger::current_logger(nullptr);
+  }
+  std::filesystem::remove(path);
+}
+
+BENCHMARK_CAPTURE(logger_log, error, log::level::error)
+  ->ArgName("binary")
+  ->Arg(0)
+  ->Arg(1);
+
+BENCHMARK_CAPTURE(logger_log, warning, log::level::warning)
+  ->ArgName("binary")
+  ->Arg(0)
+  ->Arg(1);
+
+BENCHMARK_CAPTURE(logger_log, info, log::level::info)
+  ->ArgName("binary")
+  ->Arg(0)
+  ->Arg(1);
+
+BENCHMARK_CAPTURE(logger_log, debug, log::level::debug)
+  ->ArgName("binary")
+  ->Arg(0)
+  ->Arg(1);
+
+BENCHMARK_CAPTURE(logger_log, trace, log::level::trace)
+  ->ArgName("binary")
+  ->Arg(0)
+  ->Arg(1);
+
+} // namespace
@@ -0,0 +1,96 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/default_mailbox.hpp"
+
+#include "caf/error.hpp"
+#include "caf/mailbox_element.hpp"
+#include "caf/message_id.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <thread>
+
+using namespace caf;
+
+namespace {
+
+void mailbox_enqueue_dequeue(benchmark::State& state) {
+  auto n = static_cast<int32_t>(state.range(0));
+  detail::default_mailbox mbox;
+  for (auto _ : state) {
+    for (int32_t i = 0; i < n; ++i)
+      mbox.push_back(make_mailbox_element(nullptr, make_message_id(), i));
+    for (int32_t i = 0; i < n; ++i)
+      benchmark::DoNotOptimize(mbox.pop_front());
+  }
+  mbox.close(error{});
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(mailbox_enqueue_dequeue)->Arg(1)->Arg(64)->Arg(1024);
+
+void mailbox_enqueue_dequeue_batch(benchmark::State& state) {
+  auto n = static_cast<int32_t>(state.range(0));
+  detail::default_mailbox mbox;
+  intrusive::linked_list<mailbox_element> batch;
+  for (auto _ : state) {
+    for (int32_t i = 0; i < n; ++i)
+      mbox.push_back(make_mailbox_element(nullptr, make_message_id(), i));
+    benchmark::DoNotOptimize(mbox.pop_front_n(batch, static_cast<size_t>(n)));
+    batch.clear();
+  }
+  mbox.close(error{});
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(mailbox_enqueue_dequeue_batch)->Arg(1)->Arg(64)->Arg(1024);
+
+void mailbox_size(benchmark::State& state) {
+  // Reads the size of a mailbox with `n` pending messages.
+  auto n = static_cast<int32_t>(state.range(0));
+  detail::default_mailbox mbox;
+  for (int32_t i = 0; i < n; ++i)
+    mbox.push_back(make_mailbox_element(nullptr, make_message_id(), i));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(mbox.size());
+  mbox.close(error{});
+}
+
+BENCHMARK(mailbox_size)->Arg(1024);
+
+void mailbox_concurrent_enqueue(benchmark::State& state) {
+  // Measures how long the consumer needs to receive `n` messages from
+  // `producers` threads.
+  auto n = static_cast<int32_t>(state.range(0));
+  auto producers = static_cast<int32_t>(state.range(1));
+  for (auto _ : state) {
+    detail::default_mailbox mbox;
+    std::vector<std::thread> threads;
+    for (int32_t p = 0; p < producers; ++p)
+      threads.emplace_back([&mbox, n, producers] {
+        for (int32_t i = 0; i < n / producers; ++i)
+          mbox.push_back(make_mailbox_element(nullptr, make_message_id(), i));
+      });
+    auto received = int32_t{0};
+    auto total = n / producers * producers;
+    while (received < total) {
+      if (auto ptr = mbox.pop_front())
+        ++received;
+      else
+        std::this_thread::yield();
+    }
+    for (auto& thread : threads)
+      thread.join();
+    mbox.close(error{});
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK(mailbox_concurrent_enqueue)
+  ->Args({10'000, 1})
+  ->Args({10'000, 4})
+  ->UseRealTime();
+
+} // namespace
@@ -0,0 +1,22 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+// Entry point for the micro-benchmark suite. Run `caf-bench --help` for all
+// options of the benchmark runner. For comparing two commits, store the
+// results with `--benchmark_out=<file> --benchmark_out_format=json` and pass
+// both files to `scripts/compare_benchmarks.py`.
+
+#include "caf/init_global_meta_objects.hpp"
+
+#include <benchmark/benchmark.h>
+
+int main(int argc, char** argv) {
+  caf::core::init_global_meta_objects();
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,99 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/message.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+using namespace caf;
+
+namespace {
+
+// Cycles through a trivial, a non-trivial and a floating point type to get
+// messages with mixed element types and non-trivial offsets.
+using element_types = std::tuple<int32_t, std::string, double>;
+
+template <size_t I>
+using element_t
+  = std::tuple_element_t<I % std::tuple_size_v<element_types>, element_types>;
+
+template <size_t I>
+element_t<I> make_element() {
+  if constexpr (std::is_same_v<element_t<I>, std::string>)
+    return "hello world";
+  else
+    return static_cast<element_t<I>>(I);
+}
+
+template <size_t... Is>
+message make_test_message(std::index_sequence<Is...>) {
+  return make_message(make_element<Is>()...);
+}
+
+// Creates a message with `N` elements.
+template <size_t N>
+message make_test_message() {
+  return make_test_message(std::make_index_sequence<N>{});
+}
+
+template <size_t N>
+void message_create(benchmark::State& state) {
+  for (auto _ : state) {
+    message msg = make_test_message<N>();
+    benchmark::DoNotOptimize(msg);
+  }
+}
+
+BENCHMARK_TEMPLATE(message_create, 1);
+BENCHMARK_TEMPLATE(message_create, 4);
+BENCHMARK_TEMPLATE(message_create, 8);
+
+template <size_t N>
+void message_copy(benchmark::State& state) {
+  message msg = make_test_message<N>();
+  for (auto _ : state) {
+    message copy = msg;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+BENCHMARK_TEMPLATE(message_copy, 1);
+BENCHMARK_TEMPLATE(message_copy, 4);
+BENCHMARK_TEMPLATE(message_copy, 8);
+
+// Forces a deep copy of the message content by writing to a shared message.
+template <size_t N>
+void message_copy_on_write(benchmark::State& state) {
+  message msg = make_test_message<N>();
+  for (auto _ : state) {
+    message copy = msg;
+    copy.get_mutable_as<int32_t>(0) = 2;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+BENCHMARK_TEMPLATE(message_copy_on_write, 1);
+BENCHMARK_TEMPLATE(message_copy_on_write, 4);
+BENCHMARK_TEMPLATE(message_copy_on_write, 8);
+
+// Reads the last element, i.e., the element with the largest offset.
+template <size_t N>
+void message_access_last(benchmark::State& state) {
+  message msg = make_test_message<N>();
+  for (auto _ : state) {
+    auto& x = msg.get_as<element_t<N - 1>>(N - 1);
+    benchmark::DoNotOptimize(x);
+  }
+}
+
+BENCHMARK_TEMPLATE(message_access_last, 1);
+BENCHMARK_TEMPLATE(message_access_last, 4);
+BENCHMARK_TEMPLATE(message_access_last, 8);
+
+} // namespace
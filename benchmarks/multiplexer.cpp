@@ -0,0 +1,268 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/net/multiplexer.hpp"
+#include "caf/net/socket_event_layer.hpp"
+#include "caf/net/socket_manager.hpp"
+#include "caf/net/stream_socket.hpp"
+
+#include "caf/byte_buffer.hpp"
+#include "caf/config.hpp"
+#include "caf/error.hpp"
+#include "caf/expected.hpp"
+#include "caf/span.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#ifdef CAF_POSIX
+#  include <sys/resource.h>
+#endif
+
+using namespace caf;
+
+namespace {
+
+// Writes `remaining` bytes to its socket whenever the socket becomes writable.
+class writer : public net::socket_event_layer {
+public:
+  explicit writer(net::stream_socket fd) : fd_(fd), buf_(64 * 1024) {
+    // nop
+  }
+
+  error start(net::socket_manager* mgr) override {
+    mgr_ = mgr;
+    return none;
+  }
+
+  net::socket handle() const override {
+    return fd_;
+  }
+
+  void handle_read_event() override {
+    // nop
+  }
+
+  void handle_write_event() override {
+    auto chunk = std::min(remaining, buf_.size());
+    auto res = write(fd_, make_span(buf_.data(), chunk));
+    if (res > 0) {
+      remaining -= static_cast<size_t>(res);
+      if (remaining == 0)
+        mgr_->deregister_writing();
+    } else if (res == 0 || !net::last_socket_error_is_temporary()) {
+      mgr_->deregister();
+    }
+  }
+
+  void abort(const error&) override {
+    // nop
+  }
+
+  size_t remaining = 0;
+
+private:
+  net::stream_socket fd_;
+  byte_buffer buf_;
+  net::socket_manager* mgr_ = nullptr;
+};
+
+// Reads from its socket and counts the received bytes.
+class reader : public net::socket_event_layer {
+public:
+  explicit reader(net::stream_socket fd) : fd_(fd), buf_(64 * 1024) {
+    // nop
+  }
+
+  error start(net::socket_manager* mgr) override {
+    mgr_ = mgr;
+    return none;
+  }
+
+  net::socket handle() const override {
+    return fd_;
+  }
+
+  void handle_read_event() override {
+    auto res = read(fd_, buf_);
+    if (res > 0)
+      received += static_cast<size_t>(res);
+    else if (res == 0 || !net::last_socket_error_is_temporary())
+      mgr_->deregister();
+  }
+
+  void handle_write_event() override {
+    // nop
+  }
+
+  void abort(const error&) override {
+    // nop
+  }
+
+  size_t received = 0;
+
+private:
+  net::stream_socket fd_;
+  byte_buffer buf_;
+  net::socket_manager* mgr_ = nullptr;
+};
+
+// Sends `range(0)` bytes over a local socket pair, with a single thread
+// running the multiplexer for both ends.
+void multiplexer_loopback(benchmark::State& state, std::string backend) {
+  auto bytes_per_iteration = static_cast<size_t>(state.range(0));
+  auto mpx = net::multiplexer::make(nullptr, backend);
+  mpx->set_thread_id();
+  if (auto err = mpx->init()) {
+    state.SkipWithError("failed to initialize the multiplexer");
+    return;
+  }
+  auto fds = net::make_stream_socket_pair();
+  if (!fds) {
+    state.SkipWithError("failed to create a socket pair");
+    return;
+  }
+  auto [wr_fd, rd_fd] = *fds;
+  std::ignore = net::nonblocking(wr_fd, true);
+  std::ignore = net::nonblocking(rd_fd, true);
+  auto wr_layer = std::make_unique<writer>(wr_fd);
+  auto* wr = wr_layer.get();
+  auto wr_mgr = net::socket_manager::make(mpx.get(), std::move(wr_layer));
+  auto rd_layer = std::make_unique<reader>(rd_fd);
+  auto* rd = rd_layer.get();
+  auto rd_mgr = net::socket_manager::make(mpx.get(), std::move(rd_layer));
+  std::ignore = wr_mgr->start();
+  std::ignore = rd_mgr->start();
+  rd_mgr->register_reading();
+  mpx->apply_updates();
+  size_t expected = 0;
+  for (auto _ : state) {
+    expected += bytes_per_iteration;
+    wr->remaining = bytes_per_iteration;
+    wr_mgr->register_writing();
+    mpx->apply_updates();
+    while (rd->received < expected)
+      mpx->poll_once(true);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(expected));
+  mpx->shutdown();
+  mpx->apply_updates();
+  while (mpx->poll_once(false))
+    ; // Repeat.
+}
+
+BENCHMARK_CAPTURE(multiplexer_loopback, poll, std::string{"poll"})
+  ->Arg(64)
+  ->Arg(1 << 20);
+
+#ifdef CAF_LINUX
+BENCHMARK_CAPTURE(multiplexer_loopback, epoll, std::string{"epoll"})
+  ->Arg(64)
+  ->Arg(1 << 20);
+#endif
+
+// Raises the limit for open file descriptors to at least `n` if possible.
+bool reserve_file_descriptors([[maybe_unused]] size_t n) {
+#ifdef CAF_POSIX
+  rlimit limit;
+  if (getrlimit(RLIMIT_NOFILE, &limit) != 0)
+    return false;
+  if (limit.rlim_cur >= n)
+    return true;
+  if (limit.rlim_max < n)
+    return false;
+  limit.rlim_cur = n;
+  return setrlimit(RLIMIT_NOFILE, &limit) == 0;
+#else
+  return true;
+#endif
+}
+
+// Sends 64 bytes over a single active connection per iteration while
+// `range(0)` idle sockets remain registered for reading. Shows how the cost of
+// a wakeup scales with the number of idle connections.
+void multiplexer_idle_connections(benchmark::State& state,
+                                  std::string backend) {
+  auto num_idle = static_cast<size_t>(state.range(0));
+  // Each pair provides two idle sockets, plus some slack for the active pair,
+  // the pollset updater and the standard streams.
+  if (!reserve_file_descriptors(num_idle + 64)) {
+    state.SkipWithError("too many open files");
+    return;
+  }
+  auto mpx = net::multiplexer::make(nullptr, backend);
+  mpx->set_thread_id();
+  if (auto err = mpx->init()) {
+    state.SkipWithError("failed to initialize the multiplexer");
+    return;
+  }
+  std::vector<net::socket_manager_ptr> idle_mgrs;
+  idle_mgrs.reserve(num_idle);
+  while (idle_mgrs.size() < num_idle) {
+    auto fds = net::make_stream_socket_pair();
+    if (!fds) {
+      state.SkipWithError("failed to create a socket pair");
+      break;
+    }
+    for (auto fd : {fds->first, fds->second}) {
+      std::ignore = net::nonblocking(fd, true);
+      auto mgr = net::socket_manager::make(mpx.get(),
+                                           std::make_unique<reader>(fd));
+      std::ignore = mgr->start();
+      mgr->register_reading();
+      idle_mgrs.push_back(std::move(mgr));
+    }
+  }
+  auto fds = net::make_stream_socket_pair();
+  if (!fds) {
+    state.SkipWithError("failed to create a socket pair");
+  } else if (idle_mgrs.size() >= num_idle) {
+    auto [wr_fd, rd_fd] = *fds;
+    std::ignore = net::nonblocking(wr_fd, true);
+    std::ignore = net::nonblocking(rd_fd, true);
+    auto wr_layer = std::make_unique<writer>(wr_fd);
+    auto* wr = wr_layer.get();
+    auto wr_mgr = net::socket_manager::make(mpx.get(), std::move(wr_layer));
+    auto rd_layer = std::make_unique<reader>(rd_fd);
+    auto* rd = rd_layer.get();
+    auto rd_mgr = net::socket_manager::make(mpx.get(), std::move(rd_layer));
+    std::ignore = wr_mgr->start();
+    std::ignore = rd_mgr->start();
+    rd_mgr->register_reading();
+    mpx->apply_updates();
+    size_t expected = 0;
+    for (auto _ : state) {
+      expected += 64;
+      wr->remaining = 64;
+      wr_mgr->register_writing();
+      mpx->apply_updates();
+      while (rd->received < expected)
+        mpx->poll_once(true);
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+  mpx->shutdown();
+  mpx->apply_updates();
+  while (mpx->poll_once(false))
+    ; // Repeat.
+}
+
+BENCHMARK_CAPTURE(multiplexer_idle_connections, poll, std::string{"poll"})
+  ->Arg(10)
+  ->Arg(1'000)
+  ->Arg(10'000);
+
+#ifdef CAF_LINUX
+BENCHMARK_CAPTURE(multiplexer_idle_connections, epoll, std::string{"epoll"})
+  ->Arg(10)
+  ->Arg(1'000)
+  ->Arg(10'000);
+#endif
+
+} // namespace
@@ -0,0 +1,91 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/proxy_registry.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/forwarding_actor_proxy.hpp"
+#include "caf/make_actor.hpp"
+#include "caf/send.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+using namespace caf;
+
+namespace {
+
+constexpr size_t num_nodes = 16;
+
+constexpr actor_id num_actors_per_node = 256;
+
+// Creates forwarding proxies for a dummy broker and pre-populates the registry
+// with proxies for all nodes. Shared by all benchmark threads.
+struct proxy_registry_context : proxy_registry::backend {
+  actor_system_config cfg;
+  actor_system sys{cfg};
+  actor broker;
+  std::vector<node_id> nodes;
+  proxy_registry registry{sys, *this};
+
+  proxy_registry_context() {
+    broker = sys.spawn([]() -> behavior {
+      return {
+        [](int32_t) {},
+        [](message&) {},
+      };
+    });
+    auto host = node_id::default_data::host_id_type{};
+    for (size_t i = 0; i < num_nodes; ++i) {
+      host[0] = static_cast<uint8_t>(i + 1);
+      nodes.emplace_back(make_node_id(static_cast<uint32_t>(i + 1), host));
+      for (actor_id aid = 1; aid <= num_actors_per_node; ++aid)
+        registry.get_or_put(nodes.back(), aid);
+    }
+  }
+
+  ~proxy_registry_context() override {
+    registry.clear();
+    anon_send_exit(broker, exit_reason::user_shutdown);
+  }
+
+  strong_actor_ptr make_proxy(node_id nid, actor_id aid) override {
+    actor_config cfg;
+    return make_actor<forwarding_actor_proxy, strong_actor_ptr>(aid, nid, &sys,
+                                                                cfg, broker);
+  }
+
+  void set_last_hop(node_id*) override {
+    // nop
+  }
+};
+
+std::unique_ptr<proxy_registry_context> proxy_registry_ctx;
+
+// Looks up existing proxies from multiple threads, i.e., what the BASP workers
+// do when deserializing handles to remote actors.
+void proxy_registry_get_or_put(benchmark::State& state) {
+  if (state.thread_index() == 0)
+    proxy_registry_ctx = std::make_unique<proxy_registry_context>();
+  auto index = static_cast<size_t>(state.thread_index()) * 7919;
+  for (auto _ : state) {
+    // Note: the context becomes available once all threads enter the loop.
+    auto& ctx = *proxy_registry_ctx;
+    auto& nid = ctx.nodes[index % num_nodes];
+    auto aid = static_cast<actor_id>(index % num_actors_per_node) + 1;
+    benchmark::DoNotOptimize(ctx.registry.get_or_put(nid, aid));
+    ++index;
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0)
+    proxy_registry_ctx.reset();
+}
+
+BENCHMARK(proxy_registry_get_or_put)->ThreadRange(1, 8)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,96 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/io/middleman.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/behavior.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/scoped_actor.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+using namespace caf;
+using namespace std::literals;
+
+namespace {
+
+// Number of messages per iteration. The sender waits for a reply from the
+// receiver after each batch to keep the mailbox of the receiver bounded.
+constexpr int64_t batch_size = 64;
+
+// Generates a payload with `size` bytes of repetitive text, e.g., a list of
+// JSON records.
+std::string make_payload(size_t size) {
+  constexpr std::string_view record = R"({"sensor":"temperature","value":21},)";
+  std::string result;
+  result.reserve(size);
+  while (result.size() + record.size() <= size)
+    result += record;
+  result.resize(size, ' ');
+  return result;
+}
+
+void configure(actor_system_config& cfg, bool compress) {
+  cfg.load<io::middleman>();
+  if (compress)
+    cfg.set("caf.middleman.compression", "lz4");
+}
+
+// Sends messages from one actor system to another over a local TCP connection.
+// With `range(1)` set, both nodes compress payloads with LZ4.
+void remoting_send(benchmark::State& state) {
+  // Note: registering the meta objects is idempotent, but must happen while no
+  //       actor system is running.
+  io::middleman::init_global_meta_objects();
+  auto compress = state.range(1) != 0;
+  actor_system_config server_cfg;
+  configure(server_cfg, compress);
+  actor_system server_sys{server_cfg};
+  actor_system_config client_cfg;
+  configure(client_cfg, compress);
+  actor_system client_sys{client_cfg};
+  auto sink = server_sys.spawn([]() -> behavior {
+    return {
+      [](const std::string&) {},
+      [](int64_t n) { return n; },
+    };
+  });
+  auto port = server_sys.middleman().publish(sink, 0, "127.0.0.1");
+  if (!port) {
+    state.SkipWithError("failed to publish the receiver");
+    return;
+  }
+  auto proxy = client_sys.middleman().remote_actor("127.0.0.1", *port);
+  if (!proxy) {
+    state.SkipWithError("failed to connect to the receiver");
+    return;
+  }
+  auto payload = make_payload(static_cast<size_t>(state.range(0)));
+  scoped_actor self{client_sys};
+  for (auto _ : state) {
+    for (int64_t i = 0; i < batch_size; ++i)
+      self->mail(payload).send(*proxy);
+    self->mail(batch_size)
+      .request(*proxy, 10s)
+      .receive([](int64_t) {},
+               [&state](const error&) {
+                 state.SkipWithError("failed to receive a reply");
+               });
+  }
+  auto total = state.iterations() * batch_size;
+  state.SetItemsProcessed(total);
+  state.SetBytesProcessed(total * state.range(0));
+  self->send_exit(sink, exit_reason::user_shutdown);
+}
+
+BENCHMARK(remoting_send)
+  ->ArgNames({"size", "lz4"})
+  ->ArgsProduct({{1024, 64 * 1024}, {0, 1}})
+  ->UseRealTime();
+
+} // namespace
@@ -0,0 +1,196 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/behavior.hpp"
+#include "caf/binary_deserializer.hpp"
+#include "caf/binary_serializer.hpp"
+#include "caf/byte_buffer.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/message.hpp"
+#include "caf/send.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace caf;
+
+namespace {
+
+// Creates a message with a payload of `size` bytes.
+message make_payload(size_t size) {
+  byte_buffer bytes(size, std::byte{42});
+  return make_message(int32_t{1}, std::string{"hello world"}, std::move(bytes));
+}
+
+void binary_serializer_message(benchmark::State& state) {
+  auto msg = make_payload(static_cast<size_t>(state.range(0)));
+  byte_buffer buf;
+  for (auto _ : state) {
+    buf.clear();
+    binary_serializer sink{buf};
+    if (!sink.apply(msg))
+      state.SkipWithError("failed to serialize message");
+    benchmark::DoNotOptimize(buf.data());
+  }
+  auto total = state.iterations() * buf.size();
+  state.SetBytesProcessed(static_cast<int64_t>(total));
+}
+
+BENCHMARK(binary_serializer_message)->Range(64, 64 << 10);
+
+void binary_deserializer_message(benchmark::State& state) {
+  auto msg = make_payload(static_cast<size_t>(state.range(0)));
+  byte_buffer buf;
+  binary_serializer sink{buf};
+  if (!sink.apply(msg)) {
+    state.SkipWithError("failed to serialize message");
+    return;
+  }
+  for (auto _ : state) {
+    message result;
+    binary_deserializer source{buf};
+    if (!source.apply(result))
+      state.SkipWithError("failed to deserialize message");
+    benchmark::DoNotOptimize(result);
+  }
+  auto total = state.iterations() * buf.size();
+  state.SetBytesProcessed(static_cast<int64_t>(total));
+}
+
+BENCHMARK(binary_deserializer_message)->Range(64, 64 << 10);
+
+void binary_serializer_integers(benchmark::State& state) {
+  std::vector<uint64_t> xs(static_cast<size_t>(state.range(0)), 0x0102030405);
+  byte_buffer buf;
+  for (auto _ : state) {
+    buf.clear();
+    binary_serializer sink{buf};
+    if (!sink.apply(xs))
+      state.SkipWithError("failed to serialize integers");
+    benchmark::DoNotOptimize(buf.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * xs.size()));
+}
+
+BENCHMARK(binary_serializer_integers)->Range(64, 64 << 10);
+
+template <class T>
+std::vector<T> make_numbers(benchmark::State& state) {
+  std::vector<T> xs(static_cast<size_t>(state.range(0)));
+  for (size_t i = 0; i < xs.size(); ++i)
+    xs[i] = static_cast<T>(i * 3 + 1);
+  return xs;
+}
+
+// Baseline: serializes each element individually.
+template <class T>
+void binary_serializer_numbers_element_wise(benchmark::State& state) {
+  auto xs = make_numbers<T>(state);
+  byte_buffer buf;
+  for (auto _ : state) {
+    buf.clear();
+    binary_serializer sink{buf};
+    sink.begin_sequence(xs.size());
+    for (auto x : xs)
+      sink.value(x);
+    sink.end_sequence();
+    benchmark::DoNotOptimize(buf.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()
+                                               * xs.size() * sizeof(T)));
+}
+
+BENCHMARK_TEMPLATE(binary_serializer_numbers_element_wise, int64_t)
+  ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(binary_serializer_numbers_element_wise, double)
+  ->Range(1 << 10, 1 << 20);
+
+template <class T>
+void binary_serializer_numbers(benchmark::State& state) {
+  auto xs = make_numbers<T>(state);
+  byte_buffer buf;
+  for (auto _ : state) {
+    buf.clear();
+    binary_serializer sink{buf};
+    if (!sink.apply(xs))
+      state.SkipWithError("failed to serialize numbers");
+    benchmark::DoNotOptimize(buf.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()
+                                               * xs.size() * sizeof(T)));
+}
+
+BENCHMARK_TEMPLATE(binary_serializer_numbers, int64_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(binary_serializer_numbers, double)->Range(1 << 10, 1 << 20);
+
+template <class T>
+void binary_deserializer_numbers(benchmark::State& state) {
+  auto xs = make_numbers<T>(state);
+  byte_buffer buf;
+  binary_serializer sink{buf};
+  if (!sink.apply(xs)) {
+    state.SkipWithError("failed to serialize numbers");
+    return;
+  }
+  std::vector<T> result;
+  for (auto _ : state) {
+    binary_deserializer source{buf};
+    if (!source.apply(result))
+      state.SkipWithError("failed to deserialize numbers");
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()
+                                               * xs.size() * sizeof(T)));
+}
+
+BENCHMARK_TEMPLATE(binary_deserializer_numbers, int64_t)
+  ->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(binary_deserializer_numbers, double)
+  ->Range(1 << 10, 1 << 20);
+
+// Serializing a local actor handle registers the actor at the registry, e.g.,
+// for each sender of a remote message. Shared by all benchmark threads.
+struct actor_handle_context {
+  actor_system_config cfg;
+  actor_system sys{cfg};
+  std::vector<actor> actors;
+};
+
+std::unique_ptr<actor_handle_context> actor_handle_ctx;
+
+void binary_serializer_actor_handle(benchmark::State& state) {
+  if (state.thread_index() == 0) {
+    actor_handle_ctx = std::make_unique<actor_handle_context>();
+    for (int i = 0; i < 64; ++i)
+      actor_handle_ctx->actors.emplace_back(
+        actor_handle_ctx->sys.spawn([]() -> behavior {
+          return {[](int32_t) {}};
+        }));
+  }
+  byte_buffer buf;
+  size_t index = static_cast<size_t>(state.thread_index());
+  for (auto _ : state) {
+    auto& hdl = actor_handle_ctx->actors[index++ % 64];
+    buf.clear();
+    binary_serializer sink{actor_handle_ctx->sys, buf};
+    if (!sink.apply(hdl))
+      state.SkipWithError("failed to serialize actor handle");
+    benchmark::DoNotOptimize(buf.data());
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    for (auto& hdl : actor_handle_ctx->actors)
+      anon_send_exit(hdl, exit_reason::user_shutdown);
+    actor_handle_ctx.reset();
+  }
+}
+
+BENCHMARK(binary_serializer_actor_handle)->ThreadRange(1, 8)->UseRealTime();
+
+} // namespace
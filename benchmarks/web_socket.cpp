@@ -0,0 +1,147 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/rfc3629.hpp"
+#include "caf/detail/rfc6455.hpp"
+
+#include "caf/byte_buffer.hpp"
+#include "caf/byte_span.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+using namespace caf;
+
+namespace {
+
+// -- masking ------------------------------------------------------------------
+
+// Masks the data one byte at a time, i.e., the implementation prior to
+// processing the payload in blocks. Serves as baseline.
+void scalar_mask_data(uint32_t key, byte_span data) {
+  std::byte arr[4];
+  for (size_t i = 0; i < 4; ++i)
+    arr[i] = static_cast<std::byte>(key >> (24 - i * 8));
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] ^= arr[i % 4];
+}
+
+void web_socket_mask_scalar(benchmark::State& state) {
+  byte_buffer payload(static_cast<size_t>(state.range(0)), std::byte{0x2A});
+  for (auto _ : state) {
+    scalar_mask_data(0xDEADC0DE, payload);
+    benchmark::DoNotOptimize(payload.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(web_socket_mask_scalar)->RangeMultiplier(8)->Range(16, 64 * 1024);
+
+void web_socket_mask(benchmark::State& state) {
+  byte_buffer payload(static_cast<size_t>(state.range(0)), std::byte{0x2A});
+  for (auto _ : state) {
+    detail::rfc6455::mask_data(0xDEADC0DE, payload);
+    benchmark::DoNotOptimize(payload.data());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(web_socket_mask)->RangeMultiplier(8)->Range(16, 64 * 1024);
+
+// -- UTF-8 validation ---------------------------------------------------------
+
+// Validates UTF-8 one character at a time based on the table of well-formed
+// byte sequences in the Unicode standard (table 3-7). Serves as baseline.
+std::pair<size_t, bool> scalar_validate(const_byte_span bytes) {
+  auto in_range = [](std::byte x, int lo, int hi) {
+    auto val = std::to_integer<int>(x);
+    return val >= lo && val <= hi;
+  };
+  size_t pos = 0;
+  while (pos < bytes.size()) {
+    auto lead = std::to_integer<int>(bytes[pos]);
+    size_t num_tail = 0;
+    int lo = 0x80;
+    int hi = 0xBF;
+    if (lead <= 0x7F) {
+      ++pos;
+      continue;
+    } else if (lead >= 0xC2 && lead <= 0xDF) {
+      num_tail = 1;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+      num_tail = 2;
+      if (lead == 0xE0)
+        lo = 0xA0;
+      else if (lead == 0xED)
+        hi = 0x9F;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+      num_tail = 3;
+      if (lead == 0xF0)
+        lo = 0x90;
+      else if (lead == 0xF4)
+        hi = 0x8F;
+    } else {
+      return {pos, false};
+    }
+    for (size_t i = 1; i <= num_tail; ++i) {
+      if (pos + i == bytes.size())
+        return {pos, true};
+      if (!in_range(bytes[pos + i], lo, hi))
+        return {pos, false};
+      lo = 0x80;
+      hi = 0xBF;
+    }
+    pos += num_tail + 1;
+  }
+  return {pos, false};
+}
+
+// Fills a buffer with `size` bytes of text. With `multi_byte` set, every
+// fourth character is a multi-byte sequence, otherwise the text is ASCII only,
+// e.g., JSON updates of a stock ticker.
+byte_buffer make_text(size_t size, bool multi_byte) {
+  constexpr std::string_view ascii = R"({"symbol":"CAF","price":42.23},)";
+  constexpr std::string_view mixed = "abc\xC3\xA4"
+                                     "def\xE2\x82\xAC"
+                                     "ghi\xF0\x9F\x98\x80";
+  auto text = as_bytes(make_span(multi_byte ? mixed : ascii));
+  byte_buffer result;
+  while (result.size() + text.size() <= size)
+    result.insert(result.end(), text.begin(), text.end());
+  result.resize(size, std::byte{' '});
+  return result;
+}
+
+void web_socket_validate_utf8_scalar(benchmark::State& state) {
+  auto text = make_text(static_cast<size_t>(state.range(0)),
+                        state.range(1) != 0);
+  for (auto _ : state) {
+    auto res = scalar_validate(text);
+    benchmark::DoNotOptimize(res);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(web_socket_validate_utf8_scalar)
+  ->ArgNames({"size", "multi_byte"})
+  ->ArgsProduct({{64, 1024, 64 * 1024}, {0, 1}});
+
+void web_socket_validate_utf8(benchmark::State& state) {
+  auto text = make_text(static_cast<size_t>(state.range(0)),
+                        state.range(1) != 0);
+  for (auto _ : state) {
+    auto res = detail::rfc3629::validate(text);
+    benchmark::DoNotOptimize(res);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(web_socket_validate_utf8)
+  ->ArgNames({"size", "multi_byte"})
+  ->ArgsProduct({{64, 1024, 64 * 1024}, {0, 1}});
+
+} // namespace
@@ -158,7 +158,7 @@ bool abstract_actor::cleanup(error&& reason, scheduler* sched) {
       if (&fail_state_ != &reason)
         fail_state_ = std::move(reason);
       attachables_head_.swap(head);
-      flags(fs | is_terminated_flag);
+      setf(is_terminated_flag);
       return true;
     }
     return false;
@@ -186,20 +186,24 @@ mailbox_element* abstract_actor::peek_at_next_mailbox_element() {
   return nullptr;
 }
 
+size_t abstract_actor::approximate_mailbox_size() const noexcept {
+  return 0;
+}
+
 void abstract_actor::register_at_system() {
   if (getf(is_registered_flag))
     return;
   setf(is_registered_flag);
-  [[maybe_unused]] auto count = home_system().registry().inc_running();
-  log::system::debug("actor {} increased running count to {}", id(), count);
+  home_system().registry().inc_running();
+  log::system::debug("actor {} increased running count", id());
 }
 
 void abstract_actor::unregister_from_system() {
   if (!getf(is_registered_flag))
     return;
   unsetf(is_registered_flag);
-  [[maybe_unused]] auto count = home_system().registry().dec_running();
-  log::system::debug("actor {} decreased running count to {}", id(), count);
+  home_system().registry().dec_running();
+  log::system::debug("actor {} decreased running count", id());
 }
 
 void abstract_actor::add_link(abstract_actor* x) {
@@ -154,6 +154,11 @@ public:
   ///          mailbox is empty or the actor does not have a mailbox.
   virtual mailbox_element* peek_at_next_mailbox_element();
 
+  /// Returns the approximate number of messages in the mailbox of this actor.
+  /// Safe to call from any thread. The default implementation always returns
+  /// 0 for actors without a mailbox.
+  virtual size_t approximate_mailbox_size() const noexcept;
+
   /// Called by the runtime system to perform cleanup actions for this actor.
   /// Subtypes should always call this member function when overriding it.
   /// This member function is thread-safe, and if the actor has already exited
@@ -199,14 +204,19 @@ public:
   /// Indicates that the actor is currently inactive.
   static constexpr int is_inactive_flag = 0b0010'0000'0000;
 
+  /// Indicates that the actor registry stores this actor under its ID. Unlike
+  /// the other flags, the registry may set or unset this flag from any thread.
+  static constexpr int is_in_registry_flag = 0b0100'0000'0000;
+
+  /// Indicates that the actor contributes to the gauge for the mailbox size.
+  static constexpr int reports_mailbox_size_flag = 0b1000'0000'0000;
+
   void setf(int flag) {
-    auto x = flags();
-    flags(x | flag);
+    flags_.fetch_or(flag, std::memory_order_relaxed);
   }
 
   void unsetf(int flag) {
-    auto x = flags();
-    flags(x & ~flag);
+    flags_.fetch_and(~flag, std::memory_order_relaxed);
   }
 
   bool getf(int flag) const {
@@ -274,7 +284,8 @@ protected:
   // from other actors or threads is always read-only; further, only
   // flags that are considered constant after an actor has launched are
   // read by others, i.e., there is no acquire/release semantic between
-  // setting and reading flags
+  // setting and reading flags; the only exception is `is_in_registry_flag`,
+  // which is why `setf` and `unsetf` use atomic read-modify-write operations
   int flags() const {
     return flags_.load(std::memory_order_relaxed);
   }
@@ -10,4 +10,18 @@ abstract_mailbox::~abstract_mailbox() {
   // nop
 }
 
+size_t
+abstract_mailbox::pop_front_n(intrusive::linked_list<mailbox_element>& out,
+                              size_t max_count) {
+  size_t result = 0;
+  while (result < max_count) {
+    auto ptr = pop_front();
+    if (!ptr)
+      break;
+    out.push_back(ptr.release());
+    ++result;
+  }
+  return result;
+}
+
 } // namespace caf
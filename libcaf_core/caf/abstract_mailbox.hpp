@@ -7,6 +7,7 @@
 #include "caf/detail/core_export.hpp"
 #include "caf/fwd.hpp"
 #include "caf/intrusive/inbox_result.hpp"
+#include "caf/intrusive/linked_list.hpp"
 #include "caf/mailbox_element.hpp"
 
 namespace caf {
@@ -19,8 +20,9 @@ public:
   /// Adds a new element to the mailbox.
   /// @returns `inbox_result::success` if the element has been added to the
   ///          mailbox, `inbox_result::unblocked_reader` if the reader has been
-  ///          unblocked, or `inbox_result::queue_closed` if the mailbox has
-  ///          been closed.
+  ///          unblocked, `inbox_result::queue_closed` if the mailbox has
+  ///          been closed, or `inbox_result::queue_full` if the mailbox
+  ///          dropped the element because it reached its capacity.
   /// @threadsafe
   virtual intrusive::inbox_result push_back(mailbox_element_ptr ptr) = 0;
 
@@ -34,6 +36,15 @@ public:
   /// @note Only the owning actor is allowed to call this function.
   virtual mailbox_element_ptr pop_front() = 0;
 
+  /// Removes up to `max_count` elements from the mailbox and appends them to
+  /// `out` in the order `pop_front` would return them. The default
+  /// implementation calls `pop_front` repeatedly. Implementations may override
+  /// this function to move all elements at once.
+  /// @returns The number of elements appended to `out`.
+  /// @note Only the owning actor is allowed to call this function.
+  virtual size_t pop_front_n(intrusive::linked_list<mailbox_element>& out,
+                             size_t max_count);
+
   /// Checks whether the mailbox has been closed.
   /// @note Only the owning actor is allowed to call this function.
   virtual bool closed() const noexcept = 0;
@@ -60,6 +71,10 @@ public:
   /// @note Only the owning actor is allowed to call this function.
   virtual size_t size() = 0;
 
+  /// Returns the approximate number of pending messages. Unlike `size`, this
+  /// function never modifies the mailbox and is safe to call from any thread.
+  virtual size_t approximate_size() const noexcept = 0;
+
   /// Increases the reference count by one.
   virtual void ref_mailbox() noexcept = 0;
 
@@ -7,9 +7,9 @@
 #include "caf/anon_mail.hpp"
 #include "caf/default_attachable.hpp"
 #include "caf/detail/assert.hpp"
-#include "caf/detail/sync_request_bouncer.hpp"
 #include "caf/mailbox_element.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <random>
 
@@ -17,6 +17,27 @@ CAF_PUSH_DEPRECATED_WARNING
 
 namespace caf {
 
+namespace {
+
+/// Returns a random index in the range [0, n).
+size_t random_index(size_t n) {
+  // Note: multiple senders may run a policy concurrently.
+  thread_local std::minstd_rand engine{std::random_device{}()};
+  return std::uniform_int_distribution<size_t>{0, n - 1}(engine);
+}
+
+/// Scrambles the bits of `x` (SplitMix64 finalizer).
+uint64_t mix(uint64_t x) noexcept {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111eb;
+  x ^= x >> 31;
+  return x;
+}
+
+} // namespace
+
 actor_pool::policy actor_pool::round_robin() {
   struct impl {
     impl() : pos_(0) {
@@ -28,7 +49,8 @@ actor_pool::policy actor_pool::round_robin() {
     void operator()(actor_system&, guard_type& guard, const actor_vec& vec,
                     mailbox_element_ptr& ptr, scheduler* sched) {
       CAF_ASSERT(!vec.empty());
-      actor selected = vec[pos_++ % vec.size()];
+      auto pos = pos_.fetch_add(1, std::memory_order_relaxed);
+      actor selected = vec[pos % vec.size()];
       guard.unlock();
       selected->enqueue(std::move(ptr), sched);
     }
@@ -48,6 +70,35 @@ void broadcast_dispatch(actor_system&, actor_pool::guard_type&,
     worker->enqueue(make_mailbox_element(ptr->sender, ptr->mid, msg), sched);
 }
 
+void random_dispatch(actor_system&, actor_pool::guard_type& guard,
+                     const actor_pool::actor_vec& vec, mailbox_element_ptr& ptr,
+                     scheduler* sched) {
+  CAF_ASSERT(!vec.empty());
+  actor selected = vec[random_index(vec.size())];
+  guard.unlock();
+  selected->enqueue(std::move(ptr), sched);
+}
+
+void power_of_two_choices_dispatch(actor_system&,
+                                   actor_pool::guard_type& guard,
+                                   const actor_pool::actor_vec& vec,
+                                   mailbox_element_ptr& ptr, scheduler* sched) {
+  CAF_ASSERT(!vec.empty());
+  auto* selected = &vec[random_index(vec.size())];
+  if (vec.size() > 1) {
+    // Pick a second worker that differs from the first one.
+    auto* other = &vec[random_index(vec.size() - 1)];
+    if (other >= selected)
+      ++other;
+    if ((*other)->approximate_mailbox_size()
+        < (*selected)->approximate_mailbox_size())
+      selected = other;
+  }
+  actor worker = *selected;
+  guard.unlock();
+  worker->enqueue(std::move(ptr), sched);
+}
+
 } // namespace
 
 actor_pool::policy actor_pool::broadcast() {
@@ -55,28 +106,74 @@ actor_pool::policy actor_pool::broadcast() {
 }
 
 actor_pool::policy actor_pool::random() {
+  return random_dispatch;
+}
+
+actor_pool::policy actor_pool::least_loaded() {
   struct impl {
-    impl() : rd_() {
+    impl() : pos_(0) {
       // nop
     }
-    impl(const impl&) : rd_() {
+    impl(const impl&) : pos_(0) {
       // nop
     }
     void operator()(actor_system&, guard_type& guard, const actor_vec& vec,
                     mailbox_element_ptr& ptr, scheduler* sched) {
-      auto selected
-        = vec[dis_(rd_, decltype(dis_)::param_type(0, vec.size() - 1))];
+      CAF_ASSERT(!vec.empty());
+      // Start at a different position each time to break ties in a round-robin
+      // fashion. Otherwise, idle pools would always pick the first worker.
+      auto offset = pos_.fetch_add(1, std::memory_order_relaxed);
+      auto n = vec.size();
+      auto selected = offset % n;
+      auto min_load = vec[selected]->approximate_mailbox_size();
+      for (size_t i = 1; i < n && min_load > 0; ++i) {
+        auto index = (offset + i) % n;
+        auto load = vec[index]->approximate_mailbox_size();
+        if (load < min_load) {
+          selected = index;
+          min_load = load;
+        }
+      }
+      actor worker = vec[selected];
       guard.unlock();
-      selected->enqueue(std::move(ptr), sched);
+      worker->enqueue(std::move(ptr), sched);
     }
-    std::random_device rd_;
-    std::uniform_int_distribution<size_t> dis_;
+    std::atomic<size_t> pos_;
   };
   return impl{};
 }
 
+actor_pool::policy actor_pool::power_of_two_choices() {
+  return power_of_two_choices_dispatch;
+}
+
+actor_pool::policy actor_pool::consistent_hashing(key_function key_fn) {
+  // Uses rendezvous hashing: each message goes to the worker with the highest
+  // score for the key. Removing a worker only affects the keys that previously
+  // mapped to this worker and the pool needs no additional state.
+  return [key_fn = std::move(key_fn)](actor_system&, guard_type& guard,
+                                      const actor_vec& vec,
+                                      mailbox_element_ptr& ptr,
+                                      scheduler* sched) {
+    CAF_ASSERT(!vec.empty());
+    auto key = mix(key_fn(ptr->payload));
+    const actor* selected = nullptr;
+    uint64_t max_score = 0;
+    for (auto& worker : vec) {
+      auto score = mix(key ^ mix(worker->id()));
+      if (selected == nullptr || score > max_score) {
+        selected = &worker;
+        max_score = score;
+      }
+    }
+    actor worker = *selected;
+    guard.unlock();
+    worker->enqueue(std::move(ptr), sched);
+  };
+}
+
 actor_pool::~actor_pool() {
-  // nop
+  delete workers_.load();
 }
 
 actor actor_pool::make(actor_system& sys, policy pol) {
@@ -93,25 +190,47 @@ actor actor_pool::make(actor_system& sys, size_t num_workers,
   auto res = make(sys, std::move(pol));
   auto ptr = actor_cast<actor_pool*>(res);
   auto res_addr = ptr->address();
+  actor_vec workers;
   for (size_t i = 0; i < num_workers; ++i) {
     auto worker = fac();
     worker->attach(
       default_attachable::make_monitor(worker.address(), res_addr));
-    ptr->workers_.push_back(std::move(worker));
+    workers.push_back(std::move(worker));
   }
+  lock_type guard{ptr->workers_mtx_};
+  ptr->publish(std::move(workers));
   return res;
 }
 
 bool actor_pool::enqueue(mailbox_element_ptr what, scheduler* sched) {
-  guard_type guard{workers_mtx_};
-  if (filter(guard, what->sender, what->mid, what->payload, sched))
+  if (is_system_message(what->payload)) {
+    lock_type guard{workers_mtx_};
+    if (handle_system_message(guard, what->sender, what->mid, what->payload,
+                              sched))
+      return false;
+  }
+  guard_type guard{epoch_, readers_};
+  auto& workers = *workers_.load();
+  if (workers.empty()) {
+    guard.unlock();
+    if (what->mid.is_request() && what->sender != nullptr) {
+      // Tell client we have ignored this request message by sending and empty
+      // message back.
+      what->sender->enqueue(make_mailbox_element(nullptr,
+                                                 what->mid.response_id(),
+                                                 message{}),
+                            sched);
+    }
     return false;
-  policy_(home_system(), guard, workers_, what, sched);
+  }
+  policy_(home_system(), guard, workers, what, sched);
   return true;
 }
 
 actor_pool::actor_pool(actor_config& cfg)
-  : abstract_actor(cfg), planned_reason_(exit_reason::normal) {
+  : abstract_actor(cfg),
+    workers_(new actor_vec),
+    planned_reason_(exit_reason::normal) {
   register_at_system();
 }
 
@@ -124,17 +243,26 @@ void actor_pool::on_cleanup([[maybe_unused]] const error& reason) {
   CAF_LOG_TERMINATE_EVENT(this, reason);
 }
 
-bool actor_pool::filter(guard_type& guard, const strong_actor_ptr& sender,
-                        message_id mid, message& content, scheduler* sched) {
+bool actor_pool::is_system_message(const message& msg) noexcept {
+  return msg.match_elements<exit_msg>() || msg.match_elements<down_msg>()
+         || (!msg.empty() && msg.match_element<sys_atom>(0));
+}
+
+bool actor_pool::handle_system_message(lock_type& guard,
+                                       const strong_actor_ptr& sender,
+                                       message_id mid, message& content,
+                                       scheduler* sched) {
   auto lg = log::core::trace("mid = {}, content = {}", mid, content);
+  // Note: we only read the current set of workers while holding the lock.
+  //       Hence, it cannot change concurrently.
+  const auto& current = *workers_.load();
   if (auto view = make_const_typed_message_view<exit_msg>(content)) {
-    // acquire second mutex as well
-    std::vector<actor> workers;
     auto reason = get<0>(view).reason;
     if (cleanup(std::move(reason), sched)) {
       // send exit messages *always* to all workers and clear vector afterwards
       // but first swap workers_ out of the critical section
-      workers_.swap(workers);
+      auto workers = current;
+      publish(actor_vec{});
       guard.unlock();
       for (auto& w : workers)
         anon_mail(content).send(w);
@@ -145,12 +273,15 @@ bool actor_pool::filter(guard_type& guard, const strong_actor_ptr& sender,
   if (auto view = make_const_typed_message_view<down_msg>(content)) {
     // remove failed worker from pool
     const auto& dm = get<0>(view);
-    auto last = workers_.end();
-    auto i = std::find(workers_.begin(), workers_.end(), dm.source);
+    auto last = current.end();
+    auto i = std::find(current.begin(), last, dm.source);
     CAF_LOG_DEBUG_IF(i == last, "received down message for an unknown worker");
-    if (i != last)
-      workers_.erase(i);
-    if (workers_.empty()) {
+    if (i != last) {
+      auto workers = current;
+      workers.erase(workers.begin() + (i - current.begin()));
+      publish(std::move(workers));
+    }
+    if (workers_.load()->empty()) {
       planned_reason_ = exit_reason::out_of_workers;
       guard.unlock();
       quit(sched);
@@ -162,51 +293,61 @@ bool actor_pool::filter(guard_type& guard, const strong_actor_ptr& sender,
     const auto& worker = get<2>(view);
     worker->attach(
       default_attachable::make_monitor(worker.address(), address()));
-    workers_.push_back(worker);
+    auto workers = current;
+    workers.push_back(worker);
+    publish(std::move(workers));
     return true;
   }
   if (auto view
       = make_const_typed_message_view<sys_atom, delete_atom, actor>(content)) {
     auto& what = get<2>(view);
-    auto last = workers_.end();
-    auto i = std::find(workers_.begin(), last, what);
+    auto last = current.end();
+    auto i = std::find(current.begin(), last, what);
     if (i != last) {
       default_attachable::observe_token tk{address(),
                                            default_attachable::monitor};
       what->detach(tk);
-      workers_.erase(i);
+      auto workers = current;
+      workers.erase(workers.begin() + (i - current.begin()));
+      publish(std::move(workers));
     }
     return true;
   }
   if (content.match_elements<sys_atom, delete_atom>()) {
-    for (auto& worker : workers_) {
+    for (auto& worker : current) {
       default_attachable::observe_token tk{address(),
                                            default_attachable::monitor};
       worker->detach(tk);
     }
-    workers_.clear();
+    publish(actor_vec{});
     return true;
   }
   if (content.match_elements<sys_atom, get_atom>()) {
-    auto cpy = workers_;
+    auto cpy = current;
     guard.unlock();
     sender->enqueue(
       make_mailbox_element(nullptr, mid.response_id(), std::move(cpy)), sched);
     return true;
   }
-  if (workers_.empty()) {
-    guard.unlock();
-    if (mid.is_request() && sender != nullptr) {
-      // Tell client we have ignored this request message by sending and empty
-      // message back.
-      sender->enqueue(
-        make_mailbox_element(nullptr, mid.response_id(), message{}), sched);
-    }
-    return true;
-  }
   return false;
 }
 
+void actor_pool::publish(actor_vec workers) {
+  auto next = std::make_unique<actor_vec>(std::move(workers));
+  auto epoch = epoch_.load();
+  retired_.emplace_back(epoch, workers_.exchange(next.release()));
+  // Guards register in an epoch before loading `workers_`. Hence, only guards
+  // of the current or an earlier epoch may refer to a retired set. The next
+  // epoch re-uses the counter of the previous one, so we may only advance
+  // after all guards of the previous epoch are gone. Once the epoch is two
+  // steps ahead of a retired set, no guard can refer to it anymore.
+  for (int i = 0; i < 2 && readers_[(epoch + 1) % 2].load() == 0; ++i)
+    epoch_ = ++epoch;
+  auto pred = [epoch](const auto& entry) { return entry.first + 2 > epoch; };
+  retired_.erase(retired_.begin(),
+                 std::find_if(retired_.begin(), retired_.end(), pred));
+}
+
 void actor_pool::quit(scheduler* sched) {
   // we can safely run our cleanup code here without holding
   // workers_mtx_ because abstract_actor has its own lock
@@ -9,8 +9,12 @@
 #include "caf/detail/split_join.hpp"
 #include "caf/mailbox_element.hpp"
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <utility>
 #include <vector>
 
 namespace caf {
@@ -35,17 +39,71 @@ namespace caf {
 /// Neither does it live in its own thread. Messages are dispatched immediately
 /// during the enqueue operation. Any user-defined policy thus has to dispatch
 /// messages with as little overhead as possible, because the dispatching
-/// runs in the context of the sender.
+/// runs in the context of the sender. Since dispatching does not acquire a
+/// lock, multiple senders may run a policy concurrently.
 /// @experimental
 class CAF_CORE_EXPORT actor_pool : public abstract_actor {
 public:
   using actor_vec = std::vector<actor>;
+
   using factory = std::function<actor()>;
-  using guard_type = std::unique_lock<std::mutex>;
+
+  /// Grants a dispatch policy read access to the current set of workers. The
+  /// pool never modifies a set of workers after publishing it. Adding or
+  /// removing workers publishes a new set instead and the pool destroys the
+  /// old set only after all guards referring to it have been released.
+  /// Policies should release the guard as early as possible and must not
+  /// access the set of workers afterwards.
+  class guard_type {
+  public:
+    /// Registers a new reader in the current epoch. Readers of epoch `e`
+    /// increment `readers[e % 2]`.
+    guard_type(const std::atomic<size_t>& epoch,
+               std::atomic<size_t>* readers) noexcept {
+      for (;;) {
+        auto current = epoch.load();
+        readers_ = readers + current % 2;
+        readers_->fetch_add(1);
+        // The pool may have advanced the epoch concurrently, in which case we
+        // might have incremented the counter for a new epoch.
+        if (epoch.load() == current)
+          return;
+        readers_->fetch_sub(1);
+      }
+    }
+
+    guard_type(const guard_type&) = delete;
+
+    guard_type& operator=(const guard_type&) = delete;
+
+    ~guard_type() {
+      unlock();
+    }
+
+    /// Releases the guard.
+    void unlock() noexcept {
+      if (readers_ != nullptr) {
+        readers_->fetch_sub(1);
+        readers_ = nullptr;
+      }
+    }
+
+    /// Checks whether the guard still grants access to the set of workers.
+    bool owns_lock() const noexcept {
+      return readers_ != nullptr;
+    }
+
+  private:
+    std::atomic<size_t>* readers_ = nullptr;
+  };
+
   using policy
     = std::function<void(actor_system&, guard_type&, const actor_vec&,
                          mailbox_element_ptr&, scheduler*)>;
 
+  /// Function object for extracting a key from a message.
+  using key_function = std::function<uint64_t(const message&)>;
+
   /// Returns a simple round robin dispatching policy.
   static policy round_robin();
 
@@ -55,6 +113,22 @@ public:
   /// Returns a random dispatching policy.
   static policy random();
 
+  /// Returns a dispatching policy that sends each message to the worker with
+  /// the least number of messages in its mailbox.
+  static policy least_loaded();
+
+  /// Returns a dispatching policy that picks two workers at random and sends
+  /// each message to the worker with the least number of messages in its
+  /// mailbox. Balances load almost as well as `least_loaded` while checking
+  /// only two mailboxes per message.
+  static policy power_of_two_choices();
+
+  /// Returns a dispatching policy that always sends messages with the same key
+  /// to the same worker. Adding or removing a worker only re-assigns the keys
+  /// of that particular worker.
+  /// @param key_fn Extracts the key from a message.
+  static policy consistent_hashing(key_function key_fn);
+
   /// Returns a split/join dispatching policy. The function object `sf`
   /// distributes a work item to all workers (split step) and the function
   /// object `jf` joins individual results into a single one with `init`
@@ -99,17 +173,45 @@ protected:
   void on_cleanup(const error& reason) override;
 
 private:
-  bool filter(guard_type&, const strong_actor_ptr& sender, message_id mid,
-              message& msg, scheduler* sched);
+  using lock_type = std::unique_lock<std::mutex>;
+
+  /// Checks whether `msg` may manage the pool or its workers.
+  static bool is_system_message(const message& msg) noexcept;
+
+  /// Handles a message that manages the pool or its workers.
+  /// @returns `true` if the pool consumed the message, `false` if the message
+  ///          should get dispatched to the workers instead.
+  bool handle_system_message(lock_type& guard, const strong_actor_ptr& sender,
+                             message_id mid, message& msg, scheduler* sched);
+
+  /// Replaces the current set of workers with `workers`.
+  /// @pre `workers_mtx_` is locked
+  void publish(actor_vec workers);
 
   // call without workers_mtx_ held
   void quit(scheduler* sched);
 
   void force_close_mailbox() override;
 
+  /// Protects updates to the set of workers.
   std::mutex workers_mtx_;
-  std::vector<actor> workers_;
+
+  /// Points to the current set of workers. Senders read the set without
+  /// acquiring `workers_mtx_`.
+  std::atomic<actor_vec*> workers_;
+
+  /// Advances whenever all guards of the previous epoch have been released.
+  std::atomic<size_t> epoch_ = 0;
+
+  /// Counts the guards per epoch. Guards of epoch `e` use `readers_[e % 2]`.
+  std::atomic<size_t> readers_[2] = {0, 0};
+
+  /// Stores previous sets of workers that may still be in use along with the
+  /// epoch in which the pool replaced them.
+  std::vector<std::pair<size_t, std::unique_ptr<actor_vec>>> retired_;
+
   policy policy_;
+
   exit_reason planned_reason_;
 };
 
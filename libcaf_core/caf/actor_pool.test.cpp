@@ -11,6 +11,10 @@
 #include "caf/log/test.hpp"
 #include "caf/scoped_actor.hpp"
 
+#include <set>
+#include <thread>
+#include <vector>
+
 using namespace caf;
 using namespace std::literals;
 
@@ -163,4 +167,124 @@ TEST("random_actor_pool") {
   self->send_exit(pool, exit_reason::user_shutdown);
 }
 
+TEST("least_loaded_actor_pool") {
+  scoped_actor self{sys};
+  auto pool = actor_pool::make(sys, 5, spawn_worker,
+                               actor_pool::least_loaded());
+  std::set<actor> workers;
+  for (int32_t i = 0; i < 5; ++i) {
+    self->mail(i, i)
+      .request(pool, infinite)
+      .receive(
+        [&](int32_t res) {
+          check_eq(res, i + i);
+          auto sender = actor_cast<actor>(self->current_sender());
+          require(static_cast<bool>(sender));
+          workers.insert(sender);
+        },
+        HANDLE_ERROR);
+  }
+  // All workers are idle, so the pool breaks ties in round-robin order.
+  check_eq(workers.size(), 5u);
+  self->send_exit(pool, exit_reason::user_shutdown);
+}
+
+TEST("power_of_two_choices_actor_pool") {
+  scoped_actor self{sys};
+  auto pool = actor_pool::make(sys, 5, spawn_worker,
+                               actor_pool::power_of_two_choices());
+  for (int i = 0; i < 5; ++i) {
+    self->mail(1, 2)
+      .request(pool, 250ms)
+      .receive([&](int res) { check_eq(res, 3); }, HANDLE_ERROR);
+  }
+  self->send_exit(pool, exit_reason::user_shutdown);
+}
+
+TEST("consistent_hashing_actor_pool") {
+  scoped_actor self{sys};
+  auto key = [](const message& msg) -> uint64_t {
+    if (auto view = make_const_typed_message_view<int32_t, int32_t>(msg))
+      return static_cast<uint64_t>(get<0>(view));
+    return 0;
+  };
+  auto pool = actor_pool::make(sys, 5, spawn_worker,
+                               actor_pool::consistent_hashing(key));
+  auto worker_for = [&](int32_t x) {
+    actor result;
+    self->mail(x, 1)
+      .request(pool, infinite)
+      .receive(
+        [&](int32_t res) {
+          check_eq(res, x + 1);
+          result = actor_cast<actor>(self->current_sender());
+        },
+        HANDLE_ERROR);
+    return result;
+  };
+  SECTION("messages with the same key always reach the same worker") {
+    for (int32_t x = 0; x < 10; ++x) {
+      auto first = worker_for(x);
+      require(static_cast<bool>(first));
+      for (int i = 0; i < 3; ++i)
+        check_eq(worker_for(x), first);
+    }
+  }
+  SECTION("removing a worker only remaps the keys of that worker") {
+    std::vector<actor> before;
+    for (int32_t x = 0; x < 20; ++x)
+      before.push_back(worker_for(x));
+    auto removed = before.front();
+    self->mail(sys_atom_v, delete_atom_v, removed).send(pool);
+    for (int32_t x = 0; x < 20; ++x) {
+      auto after = worker_for(x);
+      if (before[x] == removed)
+        check_ne(after, removed);
+      else
+        check_eq(after, before[x]);
+    }
+    anon_send_exit(removed, exit_reason::user_shutdown);
+  }
+  self->send_exit(pool, exit_reason::user_shutdown);
+}
+
+TEST("senders dispatch concurrently while the set of workers changes") {
+  scoped_actor self{sys};
+  auto pool = actor_pool::make(sys, 2, spawn_worker, actor_pool::round_robin());
+  constexpr int num_senders = 4;
+  constexpr int num_requests = 100;
+  std::atomic<int> results = 0;
+  std::vector<std::thread> senders;
+  for (int i = 0; i < num_senders; ++i)
+    senders.emplace_back([this, &pool, &results] {
+      scoped_actor client{sys};
+      for (int j = 0; j < num_requests; ++j)
+        client->mail(1, 2).request(pool, infinite).receive(
+          [&results](int32_t res) {
+            if (res == 3)
+              ++results;
+          },
+          // Workers that the pool removes may receive requests before
+          // shutting down.
+          [&results](const error&) { ++results; });
+    });
+  std::vector<actor> extra;
+  for (int i = 0; i < 50; ++i) {
+    extra.push_back(spawn_worker());
+    self->mail(sys_atom_v, put_atom_v, extra.back()).send(pool);
+    if (i % 2 == 1) {
+      self->mail(sys_atom_v, delete_atom_v, extra.front()).send(pool);
+      anon_send_exit(extra.front(), exit_reason::user_shutdown);
+      extra.erase(extra.begin());
+    }
+    std::this_thread::yield();
+  }
+  for (auto& sender : senders)
+    sender.join();
+  check_eq(results.load(), num_senders * num_requests);
+  for (auto& worker : extra)
+    anon_send_exit(worker, exit_reason::user_shutdown);
+  self->send_exit(pool, exit_reason::user_shutdown);
+}
+
 } // WITH_FIXTURE(fixture)
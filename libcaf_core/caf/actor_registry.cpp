@@ -7,12 +7,14 @@
 #include "caf/actor_system.hpp"
 #include "caf/attachable.hpp"
 #include "caf/detail/assert.hpp"
+#include "caf/detail/thread_shard.hpp"
 #include "caf/event_based_actor.hpp"
 #include "caf/exit_reason.hpp"
 #include "caf/log/core.hpp"
 #include "caf/scoped_actor.hpp"
 #include "caf/sec.hpp"
 #include "caf/stateful_actor.hpp"
+#include "caf/telemetry/metric_registry.hpp"
 
 #include <limits>
 #include <mutex>
@@ -33,32 +35,48 @@ actor_registry::~actor_registry() {
   // nop
 }
 
-actor_registry::actor_registry(actor_system& sys) : system_(sys) {
+actor_registry::actor_registry(actor_system& sys)
+  : num_running_shards_(detail::thread_shard_count()),
+    running_shards_(new running_shard[num_running_shards_]),
+    system_(sys) {
   // nop
 }
 
 strong_actor_ptr actor_registry::get_impl(actor_id key) const {
-  shared_guard guard(instances_mtx_);
-  auto i = entries_.find(key);
-  if (i != entries_.end())
+  auto& sh = shard_for(key);
+  shared_guard guard(sh.mtx);
+  auto i = sh.items.find(key);
+  if (i != sh.items.end())
     return i->second;
   log::core::debug("key invalid, assume actor no longer exists: key = {}", key);
   return nullptr;
 }
 
 void actor_registry::put_impl(actor_id key, strong_actor_ptr val) {
-  auto lg = log::core::trace("key = {}", key);
   if (!val)
     return;
+  // Fast path: serializing actor handles puts the same actors over and over
+  // again. The flag allows us to skip the lock after the first time.
+  auto* ptr = val->get();
+  auto by_id = key == val->id();
+  if (by_id && ptr->getf(abstract_actor::is_in_registry_flag))
+    return;
+  auto lg = log::core::trace("key = {}", key);
   { // lifetime scope of guard
-    exclusive_guard guard(instances_mtx_);
-    if (!entries_.emplace(key, val).second)
+    auto& sh = shard_for(key);
+    exclusive_guard guard(sh.mtx);
+    auto added = sh.items.emplace(key, val).second;
+    // Set the flag only after the actor is visible in the registry to make
+    // sure that no other thread skips a put that has not yet happened.
+    if (by_id)
+      ptr->setf(abstract_actor::is_in_registry_flag);
+    if (!added)
       return;
   }
   // attach functor without lock
   log::core::debug("added actor: key = {}", key);
   actor_registry* reg = this;
-  val->get()->attach_functor([key, reg]() { reg->erase(key); });
+  ptr->attach_functor([key, reg]() { reg->erase(key); });
 }
 
 void actor_registry::erase(actor_id key) {
@@ -68,40 +86,89 @@ void actor_registry::erase(actor_id key) {
   // that in turn calls this function and we can end up in a deadlock.
   strong_actor_ptr ref;
   { // Lifetime scope of guard.
-    exclusive_guard guard{instances_mtx_};
-    auto i = entries_.find(key);
-    if (i != entries_.end()) {
+    auto& sh = shard_for(key);
+    exclusive_guard guard{sh.mtx};
+    auto i = sh.items.find(key);
+    if (i != sh.items.end()) {
       ref.swap(i->second);
-      entries_.erase(i);
+      sh.items.erase(i);
+      if (ref->id() == key)
+        ref->get()->unsetf(abstract_actor::is_in_registry_flag);
     }
   }
 }
 
-size_t actor_registry::inc_running() {
-  return ++*system_.base_metrics().running_actors;
+void actor_registry::inc_running() {
+  auto& shard = running_shards_[detail::thread_shard() % num_running_shards_];
+  shard.delta.fetch_add(1, std::memory_order_relaxed);
 }
 
 size_t actor_registry::running() const {
-  return static_cast<size_t>(system_.base_metrics().running_actors->value());
+  std::unique_lock<std::mutex> guard{running_mtx_};
+  merge_running();
+  return running_gauge_value();
 }
 
-size_t actor_registry::dec_running() {
-  size_t new_val = --*system_.base_metrics().running_actors;
-  if (new_val <= 1) {
+void actor_registry::dec_running() {
+  auto& shard = running_shards_[detail::thread_shard() % num_running_shards_];
+  // Sequential consistency guarantees that either we see the waiter or the
+  // waiter sees our update when merging the counters.
+  shard.delta.fetch_sub(1, std::memory_order_seq_cst);
+  if (running_waiters_.load(std::memory_order_seq_cst) > 0) {
     std::unique_lock<std::mutex> guard(running_mtx_);
     running_cv_.notify_all();
   }
-  return new_val;
+}
+
+bool actor_registry::merge_running() const {
+  auto* gauge = system_.base_metrics().running_actors;
+  auto changed = false;
+  for (size_t i = 0; i < num_running_shards_; ++i) {
+    auto& delta = running_shards_[i].delta;
+    if (auto n = delta.exchange(0, std::memory_order_seq_cst); n != 0) {
+      gauge->inc(n);
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+size_t actor_registry::running_gauge_value() const {
+  // The gauge may drop below zero for a moment when merging the decrement
+  // before the matching increment.
+  auto n = system_.base_metrics().running_actors->value();
+  return n > 0 ? static_cast<size_t>(n) : 0;
 }
 
 void actor_registry::await_running_count_equal(size_t expected) const {
   CAF_ASSERT(expected == 0 || expected == 1);
   auto lg = log::core::trace("expected = {}", expected);
   std::unique_lock<std::mutex> guard{running_mtx_};
-  while (running() != expected) {
-    log::core::debug("running = {}", running());
+  running_waiters_.fetch_add(1, std::memory_order_seq_cst);
+  for (;;) {
+    merge_running();
+    auto n = running_gauge_value();
+    // Merging visits one shard at a time. Hence, the gauge may miss an
+    // increment on a shard that we have visited before the matching decrement
+    // on a later shard. We only accept the total if a second pass finds no
+    // pending updates, i.e., if the gauge did not change in the meantime.
+    if (n == expected) {
+      if (!merge_running())
+        break;
+      continue;
+    }
+    log::core::debug("running = {}", n);
     running_cv_.wait(guard);
   }
+  running_waiters_.fetch_sub(1, std::memory_order_seq_cst);
+}
+
+void actor_registry::set_running_shard_count(size_t n) {
+  CAF_ASSERT(n > 0);
+  std::unique_lock<std::mutex> guard{running_mtx_};
+  merge_running();
+  running_shards_.reset(new running_shard[n]);
+  num_running_shards_ = n;
 }
 
 strong_actor_ptr actor_registry::get_impl(const std::string& key) const {
@@ -141,13 +208,19 @@ auto actor_registry::named_actors() const -> name_map {
 }
 
 void actor_registry::start() {
-  // nop
+  system_.metrics().add_collect_hook([this] { running(); });
 }
 
 void actor_registry::stop() {
-  {
-    exclusive_guard guard{instances_mtx_};
-    entries_.clear();
+  for (auto& sh : shards_) {
+    entries tmp;
+    {
+      exclusive_guard guard{sh.mtx};
+      tmp.swap(sh.items);
+    }
+    for (auto& [key, ref] : tmp)
+      if (ref->id() == key)
+        ref->get()->unsetf(abstract_actor::is_in_registry_flag);
   }
   {
     exclusive_guard guard{named_entries_mtx_};
@@ -8,13 +8,16 @@
 #include "caf/actor.hpp"
 #include "caf/actor_cast.hpp"
 #include "caf/actor_control_block.hpp"
+#include "caf/config.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/fwd.hpp"
 #include "caf/telemetry/int_gauge.hpp"
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
@@ -41,7 +44,8 @@ public:
     return actor_cast<T>(get_impl(key));
   }
 
-  /// Associates a local actor with its ID.
+  /// Associates a local actor with its ID. Putting an actor under its own ID
+  /// again only reads a flag of the actor and does not acquire any lock.
   template <class T>
   void put(actor_id key, const T& val) {
     put_impl(key, actor_cast<strong_actor_ptr>(val));
@@ -51,21 +55,28 @@ public:
   /// leaving `reason` for future reference.
   void erase(actor_id key);
 
-  /// Increases running-actors-count by one.
-  /// @returns the increased count.
-  size_t inc_running();
+  /// Increases running-actors-count by one. Only updates a counter for the
+  /// calling thread, i.e., does not compute the new total.
+  void inc_running();
 
-  /// Decreases running-actors-count by one.
-  /// @returns the decreased count.
-  size_t dec_running();
+  /// Decreases running-actors-count by one. Only updates a counter for the
+  /// calling thread, i.e., does not compute the new total.
+  void dec_running();
 
-  /// Returns the number of currently running actors.
+  /// Returns the number of currently running actors. Merges the counters of
+  /// all threads into the gauge `caf.system.running-actors`.
   size_t running() const;
 
   /// Blocks the caller until running-actors-count becomes `expected`
   /// (must be either 0 or 1).
   void await_running_count_equal(size_t expected) const;
 
+  /// Spreads the running-actors-count over `n` counters, regardless of the
+  /// number of available cores.
+  /// @warning intended for unit testing only! Requires that no other thread
+  ///          updates the running-actors-count while calling this function.
+  void set_running_shard_count(size_t n);
+
   /// Returns the actor associated with `key` or `invalid_actor`.
   template <class T = strong_actor_ptr>
   T get(const std::string& key) const {
@@ -108,13 +119,52 @@ private:
 
   using entries = std::unordered_map<actor_id, strong_actor_ptr>;
 
+  /// Stores a subset of the ID-to-actor mapping. Each shard lives on its own
+  /// cache line to avoid false sharing between the mutexes.
+  struct alignas(CAF_CACHE_LINE_SIZE) shard {
+    mutable std::shared_mutex mtx;
+    entries items;
+  };
+
+  /// Number of shards for the ID-to-actor mapping.
+  static constexpr size_t num_shards = 16;
+
   actor_registry(actor_system& sys);
 
+  shard& shard_for(actor_id key) noexcept {
+    return shards_[key % num_shards];
+  }
+
+  const shard& shard_for(actor_id key) const noexcept {
+    return shards_[key % num_shards];
+  }
+
+  /// Stores how much a group of threads changed the running-actors-count since
+  /// the last merge.
+  struct alignas(CAF_CACHE_LINE_SIZE) running_shard {
+    std::atomic<int64_t> delta{0};
+  };
+
+  /// Adds all deltas to the gauge.
+  /// @returns `true` if at least one delta was not zero.
+  /// @pre `running_mtx_` is locked.
+  bool merge_running() const;
+
+  /// Returns the value of the gauge, whereas negative values map to 0.
+  /// @pre `running_mtx_` is locked.
+  size_t running_gauge_value() const;
+
   mutable std::mutex running_mtx_;
   mutable std::condition_variable running_cv_;
 
-  mutable std::shared_mutex instances_mtx_;
-  entries entries_;
+  size_t num_running_shards_;
+  std::unique_ptr<running_shard[]> running_shards_;
+
+  /// Counts threads in `await_running_count_equal`. Allows `dec_running` to
+  /// skip the notification when no one is waiting.
+  mutable std::atomic<size_t> running_waiters_{0};
+
+  std::array<shard, num_shards> shards_;
 
   name_map named_entries_;
   mutable std::shared_mutex named_entries_mtx_;
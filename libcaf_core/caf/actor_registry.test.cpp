@@ -60,4 +60,38 @@ TEST("serialization roundtrips go through the registry") {
   dispatch_messages();
 }
 
+TEST("serializing an actor handle registers the actor only once") {
+  auto hdl = sys.spawn(dummy);
+  auto* ptr = actor_cast<abstract_actor*>(hdl);
+  auto serialize = [this, &hdl] {
+    byte_buffer buf;
+    binary_serializer sink{sys, buf};
+    if (!sink.apply(hdl))
+      fail("serialization failed: {}", sink.get_error());
+  };
+  check(!ptr->getf(abstract_actor::is_in_registry_flag));
+  check_eq(sys.registry().get(hdl->id()), nullptr);
+  serialize();
+  check(ptr->getf(abstract_actor::is_in_registry_flag));
+  check_eq(sys.registry().get<actor>(hdl->id()), hdl);
+  serialize();
+  check_eq(sys.registry().get<actor>(hdl->id()), hdl);
+  SECTION("erasing the actor allows registering it again") {
+    sys.registry().erase(hdl->id());
+    check(!ptr->getf(abstract_actor::is_in_registry_flag));
+    check_eq(sys.registry().get(hdl->id()), nullptr);
+    serialize();
+    check(ptr->getf(abstract_actor::is_in_registry_flag));
+    check_eq(sys.registry().get<actor>(hdl->id()), hdl);
+  }
+  SECTION("terminated actors leave the registry") {
+    anon_send_exit(hdl, exit_reason::user_shutdown);
+    dispatch_messages();
+    check(!ptr->getf(abstract_actor::is_in_registry_flag));
+    check_eq(sys.registry().get(hdl->id()), nullptr);
+  }
+  anon_send_exit(hdl, exit_reason::user_shutdown);
+  dispatch_messages();
+}
+
 } // WITH_FIXTURE(test::fixture::deterministic)
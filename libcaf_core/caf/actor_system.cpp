@@ -13,13 +13,18 @@
 #include "caf/defaults.hpp"
 #include "caf/detail/actor_system_access.hpp"
 #include "caf/detail/assert.hpp"
+#include "caf/detail/bounded_mailbox.hpp"
 #include "caf/detail/critical.hpp"
 #include "caf/detail/daemons.hpp"
+#include "caf/detail/mailbox_size_collector.hpp"
+#include "caf/detail/message_pool.hpp"
 #include "caf/detail/meta_object.hpp"
 #include "caf/detail/private_thread_pool.hpp"
 #include "caf/detail/test_coordinator.hpp"
 #include "caf/detail/thread_safe_actor_clock.hpp"
+#include "caf/detail/timing_wheel_actor_clock.hpp"
 #include "caf/event_based_actor.hpp"
+#include "caf/mailbox_overflow_policy.hpp"
 #include "caf/raise_error.hpp"
 #include "caf/scheduler.hpp"
 #include "caf/spawn_options.hpp"
@@ -32,6 +37,7 @@
 #include <cstdio>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -263,6 +269,11 @@ auto make_base_metrics(telemetry::metric_registry& reg) {
   };
 }
 
+auto make_mailbox_size_family(telemetry::metric_registry& reg) {
+  return reg.gauge_family("caf.actor", "mailbox-size", {"name"},
+                          "Number of messages in the mailbox.");
+}
+
 auto make_actor_metric_families(telemetry::metric_registry& reg) {
   // Handling a single message generally should take microseconds. Going up to
   // several milliseconds usually indicates a problem (or blocking operations)
@@ -288,8 +299,7 @@ auto make_actor_metric_families(telemetry::metric_registry& reg) {
     reg.histogram_family<double>(
       "caf.actor", "mailbox-time", {"name"}, default_buckets,
       "Time a message waits in the mailbox before processing.", "seconds"),
-    reg.gauge_family("caf.actor", "mailbox-size", {"name"},
-                     "Number of messages in the mailbox."),
+    make_mailbox_size_family(reg),
     {
       reg.counter_family("caf.actor.stream", "processed-elements",
                          {"name", "type"},
@@ -380,6 +390,23 @@ private:
   cleanup do_cleanup_ = nullptr;
 };
 
+/// Number of actor IDs that a thread reserves at once.
+constexpr size_t actor_id_block_size = 32;
+
+/// Assigns a unique number to each actor system in the process.
+std::atomic<size_t> next_actor_system_instance;
+
+/// A block of reserved actor IDs in the range `[next, end)`.
+struct actor_id_block {
+  size_t instance = 0;
+  actor_id next = 0;
+  actor_id end = 0;
+};
+
+/// Allows threads to assign IDs to new actors without touching the global
+/// counter of the actor system for each spawn.
+thread_local actor_id_block current_actor_id_block;
+
 } // namespace
 
 class actor_system::impl {
@@ -391,6 +418,7 @@ public:
   impl(actor_system* parent, actor_system_config& cfg,
        custom_setup_fn custom_setup, void* custom_setup_data)
     : ids(0),
+      instance(next_actor_system_instance.fetch_add(1) + 1),
       metrics(cfg),
       base_metrics(make_base_metrics(metrics)),
       registry(*parent),
@@ -411,8 +439,14 @@ public:
     if (auto lst = get_as<string_list>(cfg,
                                        "caf.metrics-filters.actors.excludes"))
       metrics_actors_excludes = std::move(*lst);
+    // The mailbox size is cheap to collect and thus always enabled.
     if (!metrics_actors_includes.empty())
       actor_metric_families = make_actor_metric_families(metrics);
+    else
+      actor_metric_families.mailbox_size = make_mailbox_size_family(metrics);
+    mailbox_sizes = std::make_unique<detail::mailbox_size_collector>(
+      actor_metric_families.mailbox_size);
+    metrics.add_collect_hook([ptr = mailbox_sizes.get()] { ptr->collect(); });
     // Spin up modules.
     for (auto fn : cfg.module_factories()) {
       auto mod_ptr = fn(*parent);
@@ -440,6 +474,48 @@ public:
     if (custom_setup != nullptr) {
       custom_setup(*parent, cfg, custom_setup_data);
     }
+    // Enable the process-wide message pool before spawning any actor. The pool
+    // stays enabled until all actor systems that use it have shut down.
+    uses_message_pool = get_or(cfg, "caf.message-pool.enabled",
+                               defaults::message_pool::enabled);
+    if (uses_message_pool) {
+      detail::message_pool::enable();
+      detail::message_pool::max_cached_blocks(
+        get_or(cfg, "caf.message-pool.max-cached-blocks",
+               defaults::message_pool::max_cached_blocks));
+      auto* hits = metrics.counter_singleton(
+        "caf.system", "message-pool-hits",
+        "Number of message allocations served from a memory pool.", "1", true);
+      auto* misses = metrics.counter_singleton(
+        "caf.system", "message-pool-misses",
+        "Number of message allocations that missed the memory pool.", "1",
+        true);
+      // Concurrent collectors must not add the same delta twice.
+      auto mtx = std::make_shared<std::mutex>();
+      metrics.add_collect_hook([mtx, hits, misses] {
+        std::lock_guard guard{*mtx};
+        hits->inc(detail::message_pool::hits() - hits->value());
+        misses->inc(detail::message_pool::misses() - misses->value());
+      });
+    }
+    // Set up bounded mailboxes before anything may spawn actors. Hidden actors
+    // always opt out (see `hidden_mailbox_factory`).
+    if (cfg.mailbox_factory() == nullptr) {
+      auto capacity = get_or(cfg, "caf.mailbox.capacity",
+                             defaults::mailbox::capacity);
+      if (capacity > 0) {
+        auto policy_name = get_or(cfg, "caf.mailbox.overflow-policy",
+                                  defaults::mailbox::overflow_policy);
+        auto policy = mailbox_overflow_policy::drop_newest;
+        if (!from_string(policy_name, policy))
+          fprintf(stderr,
+                  "[WARNING] '%s' is an unrecognized mailbox overflow policy, "
+                  "falling back to 'drop_newest'\n",
+                  policy_name.c_str());
+        mailbox_factory = std::make_unique<detail::bounded_mailbox_factory>(
+          *parent, capacity, policy);
+      }
+    }
     // Initialize the logger before any other module.
     if (!logger) {
       logger = logger::make(*parent);
@@ -448,7 +524,24 @@ public:
     }
     // Make sure we have a clock.
     if (!clock) {
-      clock = std::make_unique<detail::thread_safe_actor_clock>(*parent);
+      using defaults::clock::policy;
+      auto config_policy = get_or(cfg, "caf.clock.policy", policy);
+      if (config_policy == "timing-wheel") {
+        auto resolution = get_or(cfg, "caf.clock.resolution",
+                                 defaults::clock::resolution);
+        if (resolution.count() <= 0)
+          resolution = defaults::clock::resolution;
+        clock = std::make_unique<detail::timing_wheel_actor_clock>(*parent,
+                                                                   resolution);
+      } else {
+        // Any invalid configuration falls back to the default clock.
+        if (config_policy != "default")
+          fprintf(stderr,
+                  "[WARNING] '%s' is an unrecognized clock policy, falling "
+                  "back to 'default'\n",
+                  config_policy.c_str());
+        clock = std::make_unique<detail::thread_safe_actor_clock>(*parent);
+      }
     }
     // Make sure we have a scheduler up and running.
     if (!scheduler) {
@@ -459,6 +552,8 @@ public:
         scheduler.reset(new detail::test_coordinator(*parent));
       } else if (config_policy == "sharing") {
         scheduler = scheduler::make_work_sharing(*parent);
+      } else if (config_policy == "lock-free-stealing") {
+        scheduler = scheduler::make_lock_free_work_stealing(*parent);
       } else {
         // Any invalid configuration falls back to work stealing.
         if (config_policy != "stealing")
@@ -529,11 +624,25 @@ public:
     CAF_SET_LOGGER_SYS(nullptr);
     logger->stop();
     logger = nullptr;
+    if (uses_message_pool)
+      detail::message_pool::disable();
   }
 
-  /// Used to generate ascending actor IDs.
+  /// Used to reserve blocks of actor IDs.
   std::atomic<size_t> ids;
 
+  /// Stores whether this actor system has enabled the message pool.
+  bool uses_message_pool = false;
+
+  /// Identifies this actor system for the thread-local actor ID blocks.
+  size_t instance;
+
+  /// Sums up the mailbox sizes of all actors when collecting metrics. Declared
+  /// before `metrics`, because `metrics` holds a collect hook that points to
+  /// the collector, and before all members that may release actors when
+  /// destroying them.
+  std::unique_ptr<detail::mailbox_size_collector> mailbox_sizes;
+
   /// Manages all metrics collected by the system.
   telemetry::metric_registry metrics;
 
@@ -591,6 +700,10 @@ public:
   detail::global_meta_objects_guard_type meta_objects_guard;
 
   std::unique_ptr<print_state_impl> print_state;
+
+  /// Creates mailboxes for new actors if the user did not provide a custom
+  /// factory. Stays `nullptr` for unbounded mailboxes.
+  std::unique_ptr<detail::mailbox_factory> mailbox_factory;
 };
 
 actor_system::networking_module::~networking_module() {
@@ -735,7 +848,12 @@ net::middleman& actor_system::network_manager() {
 }
 
 actor_id actor_system::next_actor_id() {
-  return ++impl_->ids;
+  auto& block = current_actor_id_block;
+  if (block.instance != impl_->instance || block.next == block.end) {
+    auto first = impl_->ids.fetch_add(actor_id_block_size) + 1;
+    block = actor_id_block{impl_->instance, first, first + actor_id_block_size};
+  }
+  return block.next++;
 }
 
 actor_id actor_system::latest_actor_id() const {
@@ -853,7 +971,20 @@ detail::actor_local_printer_ptr actor_system::printer_for(local_actor* self) {
 }
 
 detail::mailbox_factory* actor_system::mailbox_factory() {
-  return impl_->cfg->mailbox_factory();
+  if (auto* factory = impl_->cfg->mailbox_factory())
+    return factory;
+  return impl_->mailbox_factory.get();
+}
+
+detail::mailbox_size_collector& actor_system::mailbox_sizes() noexcept {
+  return *impl_->mailbox_sizes;
+}
+
+detail::mailbox_factory*
+actor_system::hidden_mailbox_factory(detail::mailbox_factory* requested) {
+  if (requested == impl_->mailbox_factory.get())
+    return nullptr;
+  return requested;
 }
 
 void actor_system::redirect_text_output(void* out,
@@ -172,7 +172,7 @@ public:
 
   /// Metrics that some actors may collect in addition to the base metrics. All
   /// families in this set use the label dimension *name* (the user-defined name
-  /// of the actor).
+  /// of the actor). Only `mailbox_size` is available for all actors.
   struct actor_metric_families_t {
     /// Samples how long the actor needs to process messages.
     telemetry::dbl_histogram_family* processing_time = nullptr;
@@ -342,10 +342,12 @@ public:
   /// @throws `std::logic_error` if module is not loaded.
   net::middleman& network_manager();
 
-  /// Returns a new actor ID.
+  /// Returns a new actor ID. Each thread reserves IDs in blocks. Hence, IDs are
+  /// unique but only ascending for actors spawned by the same thread.
   actor_id next_actor_id();
 
-  /// Returns the last given actor ID.
+  /// Returns the highest actor ID reserved so far. Since threads reserve IDs
+  /// in blocks, no actor may have this ID yet.
   actor_id latest_actor_id() const;
 
   /// Blocks this caller until all actors are done.
@@ -511,8 +513,10 @@ public:
                   "top-level spawns cannot have monitor or link flag");
     if constexpr (has_detach_flag(Os) || std::is_base_of_v<blocking_actor, C>)
       cfg.flags |= abstract_actor::is_detached_flag;
-    if constexpr (has_hide_flag(Os))
+    if constexpr (has_hide_flag(Os)) {
       cfg.flags |= abstract_actor::is_hidden_flag;
+      cfg.mbox_factory = hidden_mailbox_factory(cfg.mbox_factory);
+    }
     if (cfg.sched == nullptr)
       cfg.sched = &scheduler();
     CAF_SET_LOGGER_SYS(this);
@@ -605,9 +609,11 @@ public:
     cfg.flags = abstract_actor::is_inactive_flag;
     if constexpr (has_detach_flag(Os))
       cfg.flags |= abstract_actor::is_detached_flag;
-    if constexpr (has_hide_flag(Os))
-      cfg.flags |= abstract_actor::is_hidden_flag;
     cfg.mbox_factory = mailbox_factory();
+    if constexpr (has_hide_flag(Os)) {
+      cfg.flags |= abstract_actor::is_hidden_flag;
+      cfg.mbox_factory = hidden_mailbox_factory(cfg.mbox_factory);
+    }
     auto res = make_actor<Impl>(next_actor_id(), node(), this, cfg,
                                 std::forward<Ts>(xs)...);
     auto* rptr = actor_cast<Impl*>(res);
@@ -657,6 +663,15 @@ private:
 
   detail::mailbox_factory* mailbox_factory();
 
+  /// Returns the mailbox factory for a hidden actor that would otherwise use
+  /// `requested`. Hidden actors are internal to CAF and never use the bounded
+  /// mailboxes configured via `caf.mailbox.capacity`.
+  detail::mailbox_factory*
+  hidden_mailbox_factory(detail::mailbox_factory* requested);
+
+  /// Returns the collector for the gauge `caf.actor.mailbox-size`.
+  detail::mailbox_size_collector& mailbox_sizes() noexcept;
+
   void do_print(term color, const char* buf, size_t num_bytes);
 
   strong_actor_ptr legacy_printer_actor() const;
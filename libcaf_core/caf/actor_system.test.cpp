@@ -11,7 +11,12 @@
 #include "caf/event_based_actor.hpp"
 #include "caf/scoped_actor.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <set>
+#include <thread>
+#include <vector>
 
 using namespace caf;
 
@@ -54,6 +59,124 @@ TEST("spawn_inactive creates an actor without launching it") {
   //       on to a reference as well that may not be dropped yet.
 }
 
+TEST("actor IDs are unique across threads") {
+  actor_system_config cfg;
+  put(cfg.content, "caf.scheduler.max-threads", 1);
+  actor_system sys{cfg};
+  constexpr size_t num_threads = 4;
+  constexpr size_t ids_per_thread = 1000;
+  std::vector<std::vector<actor_id>> ids(num_threads);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < num_threads; ++i)
+    threads.emplace_back([&sys, &xs = ids[i]] {
+      for (size_t n = 0; n < ids_per_thread; ++n)
+        xs.push_back(sys.next_actor_id());
+    });
+  for (auto& thread : threads)
+    thread.join();
+  std::set<actor_id> unique_ids;
+  for (auto& xs : ids) {
+    // Each thread observes ascending IDs.
+    check(std::is_sorted(xs.begin(), xs.end()));
+    unique_ids.insert(xs.begin(), xs.end());
+  }
+  check_eq(unique_ids.size(), num_threads * ids_per_thread);
+  check_eq(unique_ids.count(invalid_actor_id), 0u);
+  check_ge(sys.latest_actor_id(), *unique_ids.rbegin());
+}
+
+TEST("the running count merges the counters of all threads") {
+  actor_system_config cfg;
+  put(cfg.content, "caf.scheduler.max-threads", 1);
+  actor_system sys{cfg};
+  auto& reg = sys.registry();
+  auto baseline = reg.running();
+  constexpr size_t num_threads = 4;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < num_threads; ++i)
+    threads.emplace_back([&reg] {
+      for (size_t n = 0; n < 100; ++n)
+        reg.inc_running();
+      for (size_t n = 0; n < 90; ++n)
+        reg.dec_running();
+    });
+  for (auto& thread : threads)
+    thread.join();
+  check_eq(reg.running(), baseline + num_threads * 10);
+  auto gauge = sys.base_metrics().running_actors;
+  check_eq(gauge->value(), static_cast<int64_t>(baseline + num_threads * 10));
+  SECTION("threads may terminate actors that other threads have spawned") {
+    for (size_t n = 0; n < num_threads * 10; ++n)
+      reg.dec_running();
+    reg.await_running_count_equal(baseline);
+    check_eq(reg.running(), baseline);
+  }
+}
+
+TEST("awaiting the running count ignores partially merged counters") {
+  actor_system_config cfg;
+  put(cfg.content, "caf.scheduler.max-threads", 1);
+  actor_system sys{cfg};
+  auto& reg = sys.registry();
+  // Use several shards even if the machine has only a single core.
+  reg.set_running_shard_count(4);
+  auto baseline = reg.running();
+  require_le(baseline, 1u);
+  // Keeps the count above the baseline until we are done.
+  reg.inc_running();
+  std::atomic<bool> returned = false;
+  std::thread waiter{[&reg, &returned, baseline] {
+    reg.await_running_count_equal(baseline);
+    returned = true;
+  }};
+  // Two threads spawn actors that the other thread terminates, i.e., each
+  // decrement goes to another shard than the matching increment.
+  constexpr size_t num_actors = 10'000;
+  std::atomic<size_t> spawned[2] = {0, 0};
+  auto worker = [&reg, &spawned](size_t id) {
+    auto& theirs = spawned[1 - id];
+    size_t terminated = 0;
+    auto terminate = [&] {
+      for (auto n = theirs.load(); terminated < n; ++terminated)
+        reg.dec_running();
+    };
+    for (size_t n = 0; n < num_actors; ++n) {
+      reg.inc_running();
+      ++spawned[id];
+      terminate();
+    }
+    while (terminated < num_actors) {
+      std::this_thread::yield();
+      terminate();
+    }
+  };
+  std::thread worker1{worker, 0};
+  std::thread worker2{worker, 1};
+  worker1.join();
+  worker2.join();
+  check(!returned);
+  reg.dec_running();
+  waiter.join();
+  check(returned);
+  check_eq(reg.running(), baseline);
+}
+
+TEST("the running count never drops below zero") {
+  actor_system_config cfg;
+  put(cfg.content, "caf.scheduler.max-threads", 1);
+  actor_system sys{cfg};
+  auto& reg = sys.registry();
+  auto baseline = reg.running();
+  // Merging a decrement before the matching increment may push the gauge
+  // below zero for a moment.
+  for (size_t n = 0; n <= baseline; ++n)
+    reg.dec_running();
+  check_eq(reg.running(), 0u);
+  for (size_t n = 0; n <= baseline; ++n)
+    reg.inc_running();
+  check_eq(reg.running(), baseline);
+}
+
 TEST("println renders its arguments to a text stream") {
   actor_system_config cfg;
   put(cfg.content, "caf.scheduler.max-threads", 1);
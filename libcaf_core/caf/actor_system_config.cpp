@@ -110,10 +110,23 @@ actor_system_config::actor_system_config() {
     .add<bool>("dump-config,,", "print configuration and exit")
     .add<std::string>("config-file", "sets a path to a configuration file");
   opt_group{custom_options_, "caf.scheduler"}
-    .add<std::string>("policy", "'stealing' (default) or 'sharing'")
+    .add<std::string>("policy", "'stealing' (default), 'lock-free-stealing' "
+                                "or 'sharing'")
     .add<size_t>("max-threads", "maximum number of worker threads")
     .add<size_t>("max-throughput",
                  "nr. of messages actors can consume per run");
+  opt_group{custom_options_, "caf.clock"}
+    .add<std::string>("policy", "'default' or 'timing-wheel'")
+    .add<timespan>("resolution", "tick length of the timing wheel");
+  opt_group{custom_options_, "caf.mailbox"}
+    .add<size_t>("capacity", "max. nr. of pending messages (0 = unbounded)")
+    .add<std::string>("overflow-policy",
+                      "'drop_newest' (default), 'drop_oldest', 'reject' or "
+                      "'back_off'");
+  opt_group{custom_options_, "caf.message-pool"}
+    .add<bool>("enabled", "allocate messages from per-thread memory pools")
+    .add<size_t>("max-cached-blocks",
+                 "max. nr. of free blocks per size class and thread");
   opt_group(custom_options_, "caf.work-stealing")
     .add<size_t>("aggressive-poll-attempts", "nr. of aggressive steal attempts")
     .add<size_t>("aggressive-steal-interval",
@@ -130,6 +143,7 @@ actor_system_config::actor_system_config() {
   opt_group{custom_options_, "caf.logger.file"}
     .add<std::string>("path", "filesystem path for the log file")
     .add<std::string>("format", "format for individual log file entries")
+    .add<bool>("binary", "writes a compact binary format instead of text")
     .add<std::string>("verbosity", "minimum severity level for file output")
     .add<std::vector<std::string>>("excluded-components",
                                    "excluded components in files");
@@ -166,6 +180,20 @@ settings actor_system_config::dump_content() const {
   put_missing(scheduler_group, "policy", defaults::scheduler::policy);
   put_missing(scheduler_group, "max-throughput",
               defaults::scheduler::max_throughput);
+  // -- clock parameters
+  auto& clock_group = caf_group["clock"].as_dictionary();
+  put_missing(clock_group, "policy", defaults::clock::policy);
+  put_missing(clock_group, "resolution", defaults::clock::resolution);
+  // -- mailbox parameters
+  auto& mailbox_group = caf_group["mailbox"].as_dictionary();
+  put_missing(mailbox_group, "capacity", defaults::mailbox::capacity);
+  put_missing(mailbox_group, "overflow-policy",
+              defaults::mailbox::overflow_policy);
+  // -- message pool parameters
+  auto& message_pool_group = caf_group["message-pool"].as_dictionary();
+  put_missing(message_pool_group, "enabled", defaults::message_pool::enabled);
+  put_missing(message_pool_group, "max-cached-blocks",
+              defaults::message_pool::max_cached_blocks);
   // -- work-stealing parameters
   auto& work_stealing_group = caf_group["work-stealing"].as_dictionary();
   put_missing(work_stealing_group, "aggressive-poll-attempts",
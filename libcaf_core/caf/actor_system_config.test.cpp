@@ -8,6 +8,7 @@
 #include "caf/test/scenario.hpp"
 #include "caf/test/test.hpp"
 
+#include "caf/defaults.hpp"
 #include "caf/log/test.hpp"
 
 #include <deque>
@@ -349,4 +350,18 @@ SCENARIO("config files allow both nested and dot-separated values") {
   }
 }
 
+TEST("dumping the content includes the clock resolution") {
+  SECTION("without user input, the dump contains the default resolution") {
+    auto dump = cfg.dump_content();
+    check_eq(get_or(dump, "caf.clock.resolution", timespan{0}),
+             defaults::clock::resolution);
+  }
+  SECTION("the dump contains a user-defined resolution") {
+    cfg.set("caf.clock.resolution", timespan{5'000'000});
+    auto dump = cfg.dump_content();
+    check_eq(get_or(dump, "caf.clock.resolution", timespan{0}),
+             timespan{5'000'000});
+  }
+}
+
 } // WITH_FIXTURE(fixture)
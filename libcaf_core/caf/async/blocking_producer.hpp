@@ -38,11 +38,14 @@ public:
         if (demand_ < 0) {
           return false;
         } else {
+          // Reserve the demand before releasing the lock. Otherwise, multiple
+          // threads sharing this producer could push more items than the
+          // consumer has requested.
           auto n = std::min(static_cast<size_t>(demand_), items.size());
+          demand_ -= static_cast<ptrdiff_t>(n);
           guard.unlock();
           buf_->push(items.subspan(0, n));
           guard.lock();
-          demand_ -= static_cast<ptrdiff_t>(n);
           items = items.subspan(n);
         }
       }
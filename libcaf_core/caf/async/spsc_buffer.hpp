@@ -19,9 +19,15 @@
 #include "caf/span.hpp"
 #include "caf/unit.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <cstdlib>
+#include <iterator>
+#include <memory>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 namespace caf::async {
 
@@ -35,6 +41,13 @@ namespace caf::async {
 /// Aside from providing storage, this buffer also resumes the consumer if data
 /// is available and signals demand to the producer whenever the consumer takes
 /// data out of the buffer.
+///
+/// Items travel through a lock-free ring of fixed-size segments. The producer
+/// and the consumer only acquire the mutex of the buffer for the handshake, for
+/// closing or canceling the buffer, for waking up the consumer when the buffer
+/// becomes non-empty and for signaling demand in batches of `min_pull_size`.
+/// Calls to `push` additionally serialize on a producer-side mutex that the
+/// consumer never acquires.
 template <class T>
 class spsc_buffer : public ref_counted {
 public:
@@ -42,38 +55,57 @@ public:
 
   using lock_type = std::unique_lock<std::mutex>;
 
-  /// Packs various status flags for the buffer into a single struct.
-  struct flags {
-    /// Stores whether `close` has been called.
-    bool closed : 1;
-    /// Stores whether `cancel` has been called.
-    bool canceled : 1;
-  };
-
   spsc_buffer(uint32_t capacity, uint32_t min_pull_size)
     : capacity_(capacity), min_pull_size_(min_pull_size) {
-    memset(&flags_, 0, sizeof(flags));
-    // Allocate some extra space in the buffer in case the producer goes beyond
-    // the announced capacity.
-    buf_.reserve(capacity + (capacity / 2));
+    // Each segment holds at least `capacity` items. Hence, the ring consists of
+    // two segments unless the producer goes beyond the announced capacity.
+    size_t segment_size = 1;
+    while (segment_size < capacity)
+      segment_size <<= 1;
+    mask_ = segment_size - 1;
+    head_ = tail_ = new segment(segment_size);
     // Note: this buffer can never go above its limit since it's a short-term
     // buffer for the consumer that cannot ask for more than capacity
     // items.
     consumer_buf_.reserve(capacity);
   }
 
+  ~spsc_buffer() override {
+    auto rd_pos = rd_pos_.load();
+    take(rd_pos, wr_pos_.load() - rd_pos);
+    consumer_buf_.clear();
+    while (head_ != nullptr)
+      delete std::exchange(head_, head_->next.load());
+    delete spare_.load();
+  }
+
   /// Appends to the buffer and calls `on_producer_wakeup` on the consumer if
   /// the buffer becomes non-empty.
+  /// @note The ring itself supports only a single writer. A producer that is
+  ///       shared between threads, e.g., a `blocking_producer` or a producer
+  ///       for multiple connections, may still call `push` concurrently,
+  ///       because all calls serialize on `producer_mtx_`.
   /// @returns the remaining capacity after inserting the items.
   size_t push(span<const T> items) {
-    lock_type guard{mtx_};
+    lock_type producer_guard{producer_mtx_};
     CAF_ASSERT(producer_ != nullptr);
-    CAF_ASSERT(!flags_.closed);
-    buf_.insert(buf_.end(), items.begin(), items.end());
-    if (buf_.size() == items.size() && consumer_)
-      consumer_->on_producer_wakeup();
-    if (capacity_ > buf_.size())
-      return capacity_ - buf_.size();
+    CAF_ASSERT(!closed_.load());
+    auto wr_pos = wr_pos_.load(std::memory_order_relaxed);
+    append(wr_pos, items);
+    // Note: we use sequential consistency for publishing the new write position
+    // and reading the read position. The consumer does the same in reverse
+    // order. Hence, either the consumer sees the new items or we see that it
+    // drained the buffer and wake it up.
+    wr_pos_.store(wr_pos + items.size());
+    auto rd_pos = rd_pos_.load();
+    if (rd_pos == wr_pos) {
+      lock_type guard{mtx_};
+      if (consumer_)
+        consumer_->on_producer_wakeup();
+    }
+    auto size = wr_pos + items.size() - rd_pos;
+    if (capacity_ > size)
+      return capacity_ - size;
     else
       return 0;
   }
@@ -91,28 +123,26 @@ public:
   ///          `on_error` on the observer.
   template <class Policy, class Observer>
   std::pair<bool, size_t> pull(Policy policy, size_t demand, Observer& dst) {
-    lock_type guard{mtx_};
-    return pull_unsafe(guard, policy, demand, dst);
+    lock_type guard{mtx_, std::defer_lock};
+    return do_pull(guard, policy, demand, dst);
   }
 
   /// Checks whether there is any pending data in the buffer.
   bool has_data() const noexcept {
-    lock_type guard{mtx_};
-    return !buf_.empty();
+    return available() > 0;
   }
 
   /// Checks whether the there is data available or whether the producer has
   /// closed or aborted the flow.
   bool has_consumer_event() const noexcept {
-    lock_type guard{mtx_};
-    return !buf_.empty() || flags_.closed;
+    return has_data() || closed_.load();
   }
 
   /// Returns how many items are currently available. This may be greater than
   /// the `capacity`.
   size_t available() const noexcept {
-    lock_type guard{mtx_};
-    return buf_.size();
+    auto rd_pos = rd_pos_.load();
+    return wr_pos_.load() - rd_pos;
   }
 
   /// Returns the error from the producer or a default-constructed error if
@@ -130,12 +160,13 @@ public:
   /// Closes the buffer by request of the producer and signals an error to the
   /// consumer.
   void abort(error reason) {
+    lock_type producer_guard{producer_mtx_};
     lock_type guard{mtx_};
-    if (!flags_.closed) {
-      flags_.closed = true;
+    if (!closed_.load()) {
       err_ = std::move(reason);
+      closed_.store(true);
       producer_ = nullptr;
-      if (buf_.empty() && consumer_)
+      if (!has_data() && consumer_)
         consumer_->on_producer_wakeup();
     }
   }
@@ -143,8 +174,8 @@ public:
   /// Closes the buffer by request of the consumer.
   void cancel() {
     lock_type guard{mtx_};
-    if (!flags_.canceled) {
-      flags_.canceled = true;
+    if (!canceled_) {
+      canceled_ = true;
       consumer_ = nullptr;
       if (producer_)
         producer_->on_consumer_cancel();
@@ -160,7 +191,7 @@ public:
     consumer_ = std::move(consumer);
     if (producer_)
       ready();
-    else if (flags_.closed)
+    else if (closed_.load())
       consumer_->on_producer_wakeup();
   }
 
@@ -173,7 +204,7 @@ public:
     producer_ = std::move(producer);
     if (consumer_)
       ready();
-    else if (flags_.canceled)
+    else if (canceled_)
       producer_->on_consumer_cancel();
   }
 
@@ -192,7 +223,7 @@ public:
   /// Returns how many items are currently available.
   /// @pre 'mtx()' is locked.
   size_t available_unsafe() const noexcept {
-    return buf_.size();
+    return available();
   }
 
   /// Returns the error from the producer.
@@ -204,7 +235,7 @@ public:
   /// Blocks until there is at least one item available or the producer stopped.
   /// @pre the consumer calls `cv.notify_all()` in its `on_producer_wakeup`
   void await_consumer_ready(lock_type& guard, std::condition_variable& cv) {
-    while (!flags_.closed && buf_.empty()) {
+    while (!closed_.load() && !has_data()) {
       cv.wait(guard);
     }
   }
@@ -215,52 +246,140 @@ public:
   template <class TimePoint>
   bool await_consumer_ready(lock_type& guard, std::condition_variable& cv,
                             TimePoint timeout) {
-    while (!flags_.closed && buf_.empty())
+    while (!closed_.load() && !has_data())
       if (cv.wait_until(guard, timeout) == std::cv_status::timeout)
         return false;
     return true;
   }
 
+  /// Consumes up to `demand` items from the buffer.
+  /// @pre 'mtx()' is locked.
+  /// @post 'mtx()' is locked.
   template <class Policy, class Observer>
   std::pair<bool, size_t>
-  pull_unsafe(lock_type& guard, Policy, size_t demand, Observer& dst) {
+  pull_unsafe(lock_type& guard, Policy policy, size_t demand, Observer& dst) {
+    guard.unlock();
+    auto result = do_pull(guard, policy, demand, dst);
+    guard.lock();
+    return result;
+  }
+
+private:
+  /// A fixed-size part of the ring. The producer links a new segment once it
+  /// reaches the end of the current one and the consumer recycles segments
+  /// after reading all of their items.
+  struct segment {
+    explicit segment(size_t size)
+      : items(std::allocator<T>{}.allocate(size)), size(size) {
+      // nop
+    }
+
+    ~segment() {
+      std::allocator<T>{}.deallocate(items, size);
+    }
+
+    std::atomic<segment*> next = nullptr;
+
+    /// Points to uninitialized storage for `size` items. Only the items
+    /// between the read and the write position are alive.
+    T* items;
+
+    size_t size;
+  };
+
+  /// Copies `items` to the ring, starting at position `pos`.
+  /// @pre Only called by the producer.
+  void append(size_t pos, span<const T> items) {
+    auto first = items.begin();
+    auto remaining = items.size();
+    while (remaining > 0) {
+      auto index = pos & mask_;
+      if (index == 0 && pos != 0) {
+        auto next = spare_.exchange(nullptr, std::memory_order_acquire);
+        if (next == nullptr)
+          next = new segment(mask_ + 1);
+        tail_->next.store(next, std::memory_order_release);
+        tail_ = next;
+      }
+      auto n = std::min(remaining, mask_ + 1 - index);
+      std::uninitialized_copy_n(first, n, tail_->items + index);
+      first += n;
+      pos += n;
+      remaining -= n;
+    }
+  }
+
+  /// Moves `n` items from the ring to `consumer_buf_`, starting at position
+  /// `pos`.
+  /// @pre Only called by the consumer.
+  void take(size_t pos, size_t n) {
+    while (n > 0) {
+      auto index = pos & mask_;
+      if (index == 0 && pos != 0) {
+        auto prev = head_;
+        head_ = prev->next.load(std::memory_order_acquire);
+        prev->next.store(nullptr, std::memory_order_relaxed);
+        delete spare_.exchange(prev, std::memory_order_acq_rel);
+      }
+      auto k = std::min(n, mask_ + 1 - index);
+      auto first = head_->items + index;
+      consumer_buf_.insert(consumer_buf_.end(), std::make_move_iterator(first),
+                           std::make_move_iterator(first + k));
+      std::destroy_n(first, k);
+      pos += k;
+      n -= k;
+    }
+  }
+
+  /// Implements `pull` and `pull_unsafe`.
+  /// @pre 'guard' is unlocked.
+  /// @post 'guard' is unlocked.
+  template <class Policy, class Observer>
+  std::pair<bool, size_t>
+  do_pull(lock_type& guard, Policy, size_t demand, Observer& dst) {
     CAF_ASSERT(consumer_ != nullptr);
     CAF_ASSERT(consumer_buf_.empty());
+    // Note: the producer never changes `err_` after setting `closed_`.
     if constexpr (std::is_same_v<Policy, prioritize_errors_t>) {
-      if (err_) {
+      if (closed_.load() && err_) {
+        guard.lock();
         consumer_ = nullptr;
+        guard.unlock();
         dst.on_error(err_);
         return {false, 0};
       }
     }
-    // We must not signal demand to the producer when reading excess elements
-    // from the buffer. Otherwise, we end up generating more demand than
-    // capacity_ allows us to.
-    auto overflow = buf_.size() <= capacity_ ? 0u : buf_.size() - capacity_;
-    auto next_n = [this, &demand] { return std::min(demand, buf_.size()); };
     size_t consumed = 0;
-    for (auto n = next_n(); n > 0; n = next_n()) {
-      using std::make_move_iterator;
-      consumer_buf_.assign(make_move_iterator(buf_.begin()),
-                           make_move_iterator(buf_.begin() + n));
-      buf_.erase(buf_.begin(), buf_.begin() + n);
+    for (;;) {
+      auto rd_pos = rd_pos_.load(std::memory_order_relaxed);
+      auto size = wr_pos_.load() - rd_pos;
+      auto n = std::min(demand, size);
+      if (n == 0)
+        break;
+      // We must not signal demand to the producer when reading excess elements
+      // from the buffer. Otherwise, we end up generating more demand than
+      // capacity_ allows us to.
+      auto overflow = size <= capacity_ ? 0u : size - capacity_;
+      take(rd_pos, n);
+      rd_pos_.store(rd_pos + n);
       if (n > overflow) {
-        signal_demand(n - overflow);
+        signal_demand(guard, static_cast<uint32_t>(n - overflow));
       }
-      guard.unlock();
       auto items = span<const T>{consumer_buf_.data(), n};
       for (auto& item : items)
         dst.on_next(item);
       demand -= n;
       consumed += n;
       consumer_buf_.clear();
-      guard.lock();
-      overflow = buf_.size() <= capacity_ ? 0u : buf_.size() - capacity_;
     }
-    if (!buf_.empty() || !flags_.closed) {
+    // Note: checking `closed_` before `has_data` makes sure that we see all
+    //       items that the producer has pushed prior to closing the buffer.
+    if (!closed_.load() || has_data()) {
       return {true, consumed};
     }
+    guard.lock();
     consumer_ = nullptr;
+    guard.unlock();
     if (!err_)
       dst.on_complete();
     else
@@ -268,32 +387,34 @@ public:
     return {false, consumed};
   }
 
-private:
+  /// @pre 'mtx()' is locked.
   void ready() {
     producer_->on_consumer_ready();
     consumer_->on_producer_ready();
-    if (!buf_.empty()) {
+    auto size = available();
+    if (size > 0)
       consumer_->on_producer_wakeup();
-      if (capacity_ > buf_.size())
-        signal_demand(capacity_ - buf_.size());
-    } else {
-      signal_demand(capacity_);
-    }
+    if (capacity_ > size)
+      producer_->on_consumer_demand(capacity_ - size);
   }
 
-  void signal_demand(uint32_t new_demand) {
+  /// @pre 'guard' is unlocked.
+  void signal_demand(lock_type& guard, uint32_t new_demand) {
     demand_ += new_demand;
-    if (demand_ >= min_pull_size_ && producer_) {
-      producer_->on_consumer_demand(demand_);
+    if (demand_ >= min_pull_size_) {
+      guard.lock();
+      if (producer_)
+        producer_->on_consumer_demand(demand_);
+      guard.unlock();
       demand_ = 0;
     }
   }
 
-  /// Guards access to all other member variables.
-  mutable std::mutex mtx_;
+  // -- state shared by producer and consumer ----------------------------------
 
-  /// Caches in-flight items.
-  std::vector<T> buf_;
+  /// Guards access to the handshake and shutdown state (`canceled_`, `err_`,
+  /// `consumer_` and `producer_`) and serializes all callbacks.
+  mutable std::mutex mtx_;
 
   /// Stores how many items the buffer may hold at any time.
   uint32_t capacity_;
@@ -302,11 +423,15 @@ private:
   /// producer.
   uint32_t min_pull_size_;
 
-  /// Demand that has not yet been signaled back to the producer.
-  uint32_t demand_ = 0;
+  /// Maps positions to slot indexes. The segment size is `mask_ + 1`.
+  size_t mask_;
+
+  /// Stores whether `cancel` has been called.
+  bool canceled_ = false;
 
-  /// Stores whether `close` has been called.
-  flags flags_;
+  /// Stores whether `close` has been called. Written only while holding the
+  /// mutex but read without it.
+  std::atomic<bool> closed_ = false;
 
   /// Stores the abort reason.
   error err_;
@@ -317,6 +442,32 @@ private:
   /// Callback handle to the producer.
   producer_ptr producer_;
 
+  /// Stores a drained segment for reuse by the producer.
+  std::atomic<segment*> spare_ = nullptr;
+
+  // -- producer state ---------------------------------------------------------
+
+  /// Serializes `push` and `abort` for producers that run on multiple threads.
+  /// Always acquired before `mtx_`.
+  alignas(CAF_CACHE_LINE_SIZE) std::mutex producer_mtx_;
+
+  /// Stores how many items the producer has pushed so far.
+  std::atomic<size_t> wr_pos_ = 0;
+
+  /// Points to the segment that the producer currently writes to.
+  segment* tail_;
+
+  // -- consumer state ---------------------------------------------------------
+
+  /// Stores how many items the consumer has pulled so far.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> rd_pos_ = 0;
+
+  /// Points to the segment that the consumer currently reads from.
+  segment* head_;
+
+  /// Demand that has not yet been signaled back to the producer.
+  uint32_t demand_ = 0;
+
   /// Caches items before passing them to the consumer (without lock).
   std::vector<T> consumer_buf_;
 };
@@ -14,7 +14,11 @@
 #include "caf/flow/observer.hpp"
 #include "caf/scheduled_actor/flow.hpp"
 
+#include <atomic>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace caf;
 
@@ -105,6 +109,77 @@ struct dummy_observer {
   error err;
 };
 
+// Producer that may receive demand from another thread.
+class concurrent_producer : public async::producer {
+public:
+  void on_consumer_ready() {
+    // nop
+  }
+
+  void on_consumer_cancel() {
+    // nop
+  }
+
+  void on_consumer_demand(size_t new_demand) {
+    demand += new_demand;
+  }
+
+  void ref_producer() const noexcept {
+    ++rc;
+  }
+
+  void deref_producer() const noexcept {
+    if (--rc == 0)
+      delete this;
+  }
+
+  mutable std::atomic<size_t> rc = 1;
+  std::atomic<size_t> demand = 0;
+};
+
+// Consumer that may receive wakeups from another thread.
+class concurrent_consumer : public async::consumer {
+public:
+  void on_producer_ready() {
+    // nop
+  }
+
+  void on_producer_wakeup() {
+    wakeup = true;
+  }
+
+  void ref_consumer() const noexcept {
+    ++rc;
+  }
+
+  void deref_consumer() const noexcept {
+    if (--rc == 0)
+      delete this;
+  }
+
+  mutable std::atomic<size_t> rc = 1;
+  std::atomic<bool> wakeup = false;
+};
+
+template <class T>
+struct collecting_observer {
+  void on_next(const T& item) {
+    items.push_back(item);
+  }
+
+  void on_error(const error&) {
+    done = true;
+  }
+
+  void on_complete() {
+    done = true;
+  }
+
+  std::vector<T> items;
+
+  bool done = false;
+};
+
 } // namespace
 
 WITH_FIXTURE(test::fixture::deterministic) {
@@ -480,6 +555,197 @@ SCENARIO("consumer resources may be converted to flows only once") {
   }
 }
 
+SCENARIO("SPSC buffers grow beyond their capacity on demand") {
+  GIVEN("an SPSC buffer with a capacity of four items") {
+    auto prod = make_counted<dummy_producer>();
+    auto cons = make_counted<dummy_consumer>();
+    auto buf = make_counted<async::spsc_buffer<std::string>>(4, 1);
+    buf->set_producer(prod);
+    buf->set_consumer(cons);
+    WHEN("pushing many more items than the capacity") {
+      THEN("the consumer receives all items in order") {
+        auto inputs = std::vector<std::string>{};
+        for (int i = 0; i < 100; ++i)
+          inputs.push_back(std::to_string(i));
+        check_eq(buf->push(make_span(inputs)), 0u);
+        check_eq(buf->available(), 100u);
+        collecting_observer<std::string> obs;
+        auto [ok, consumed] = buf->pull(async::delay_errors, 30, obs);
+        check(ok);
+        check_eq(consumed, 30u);
+        buf->push(make_span(inputs));
+        std::tie(ok, consumed) = buf->pull(async::delay_errors, 500, obs);
+        check(ok);
+        check_eq(consumed, 170u);
+        check_eq(buf->available(), 0u);
+        auto expected = inputs;
+        expected.insert(expected.end(), inputs.begin(), inputs.end());
+        check_eq(obs.items, expected);
+      }
+    }
+    WHEN("destroying the buffer with pending items") {
+      THEN("the buffer releases all items") {
+        auto item = std::make_shared<int>(42);
+        auto items = make_counted<async::spsc_buffer<std::shared_ptr<int>>>(4,
+                                                                            1);
+        items->set_producer(prod);
+        for (int i = 0; i < 10; ++i)
+          items->push(item);
+        check_eq(item.use_count(), 11);
+        items.reset();
+        check_eq(item.use_count(), 1);
+      }
+    }
+  }
+}
+
+SCENARIO("SPSC buffers only wake up the consumer if they become non-empty") {
+  GIVEN("an SPSC buffer with consumer and producer") {
+    auto prod = make_counted<dummy_producer>();
+    auto cons = make_counted<dummy_consumer>();
+    auto buf = make_counted<async::spsc_buffer<int>>(10, 5);
+    buf->set_producer(prod);
+    buf->set_consumer(cons);
+    WHEN("alternating between pushing and draining the buffer") {
+      THEN("each push to an empty buffer triggers a single wakeup") {
+        dummy_observer obs;
+        buf->push(1);
+        buf->push(2);
+        check_eq(cons->producer_wakeups, 1u);
+        buf->pull(async::delay_errors, 10, obs);
+        check_eq(obs.consumed, 2u);
+        buf->push(3);
+        check_eq(cons->producer_wakeups, 2u);
+        buf->pull(async::delay_errors, 1, obs);
+        buf->push(4);
+        buf->push(5);
+        check_eq(cons->producer_wakeups, 3u);
+      }
+    }
+    WHEN("pulling items") {
+      THEN("the buffer signals demand in batches of min_pull_size") {
+        auto tmp = std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+        buf->push(make_span(tmp));
+        prod->demand = 0;
+        dummy_observer obs;
+        buf->pull(async::delay_errors, 3, obs);
+        check_eq(prod->demand, 0u);
+        buf->pull(async::delay_errors, 3, obs);
+        check_eq(prod->demand, 6u);
+        buf->pull(async::delay_errors, 3, obs);
+        check_eq(prod->demand, 6u);
+      }
+    }
+    WHEN("closing the buffer while it still has items") {
+      THEN("the consumer receives all items before on_complete") {
+        buf->push(1);
+        buf->push(2);
+        buf->close();
+        check_eq(cons->producer_wakeups, 1u);
+        dummy_observer obs;
+        auto [ok, consumed] = buf->pull(async::delay_errors, 10, obs);
+        check(!ok);
+        check_eq(consumed, 2u);
+        check(obs.on_complete_called);
+      }
+    }
+  }
+}
+
+TEST("SPSC buffers transfer items between threads") {
+  constexpr int num_items = 100'000;
+  auto prod = make_counted<concurrent_producer>();
+  auto cons = make_counted<concurrent_consumer>();
+  auto buf = make_counted<async::spsc_buffer<int>>(64, 16);
+  buf->set_consumer(cons);
+  auto producer_thread = std::thread{[buf, prod] {
+    buf->set_producer(prod);
+    auto credit = size_t{0};
+    auto next = 0;
+    int batch[16];
+    while (next < num_items) {
+      credit += prod->demand.exchange(0);
+      if (credit == 0) {
+        std::this_thread::yield();
+        continue;
+      }
+      auto n = std::min({credit, size_t{16},
+                         static_cast<size_t>(num_items - next)});
+      for (size_t i = 0; i < n; ++i)
+        batch[i] = next++;
+      buf->push(make_span(batch, n));
+      credit -= n;
+    }
+    buf->close();
+  }};
+  collecting_observer<int> obs;
+  for (;;) {
+    auto [again, consumed] = buf->pull(async::delay_errors, 64, obs);
+    if (!again)
+      break;
+    if (consumed == 0)
+      while (!cons->wakeup.exchange(false))
+        std::this_thread::yield();
+  }
+  producer_thread.join();
+  check(obs.done);
+  if (check_eq(obs.items.size(), static_cast<size_t>(num_items))) {
+    auto in_order = true;
+    for (int i = 0; i < num_items; ++i)
+      in_order = in_order && obs.items[static_cast<size_t>(i)] == i;
+    check(in_order);
+  }
+}
+
+TEST("SPSC buffers accept pushes from a producer shared between threads") {
+  constexpr int num_threads = 4;
+  constexpr int items_per_thread = 25'000;
+  auto prod = make_counted<concurrent_producer>();
+  auto cons = make_counted<concurrent_consumer>();
+  auto buf = make_counted<async::spsc_buffer<int>>(64, 16);
+  buf->set_consumer(cons);
+  buf->set_producer(prod);
+  std::atomic<int> running = num_threads;
+  std::vector<std::thread> producer_threads;
+  for (int id = 0; id < num_threads; ++id) {
+    producer_threads.emplace_back([buf, id, &running] {
+      // Ignore demand: the soft bound allows going past the capacity.
+      int batch[8];
+      for (int i = 0; i < items_per_thread; i += 8) {
+        for (int j = 0; j < 8; ++j)
+          batch[j] = id * items_per_thread + i + j;
+        buf->push(make_span(batch, 8));
+      }
+      if (--running == 0)
+        buf->close();
+    });
+  }
+  collecting_observer<int> obs;
+  for (;;) {
+    auto [again, consumed] = buf->pull(async::delay_errors, 64, obs);
+    if (!again)
+      break;
+    if (consumed == 0)
+      while (!cons->wakeup.exchange(false) && !buf->has_consumer_event())
+        std::this_thread::yield();
+  }
+  for (auto& hdl : producer_threads)
+    hdl.join();
+  check(obs.done);
+  if (check_eq(obs.items.size(),
+               static_cast<size_t>(num_threads * items_per_thread))) {
+    // Each thread pushes its items in order, so each subsequence must arrive
+    // in order as well.
+    std::vector<int> next(num_threads);
+    auto in_order = true;
+    for (auto item : obs.items) {
+      auto id = item / items_per_thread;
+      in_order = in_order && item == id * items_per_thread + next[id]++;
+    }
+    check(in_order);
+  }
+}
+
 #ifdef CAF_ENABLE_EXCEPTIONS
 
 // Note: this basically checks that buffer protects against misuse and is not
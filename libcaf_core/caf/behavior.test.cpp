@@ -165,6 +165,57 @@ TEST("a handler that takes a message argument is a catch-all handler") {
   }
 }
 
+TEST("behaviors with many handlers select handlers by message type") {
+  // Behaviors with this many handlers use a dispatch table.
+  static_assert(detail::behavior_dispatch_table_threshold <= 10);
+  SECTION("the first matching handler wins") {
+    auto f = behavior{
+      [](int8_t) { return 1; },
+      [](int16_t) { return 2; },
+      [](int) { return 3; },
+      [](int64_t) { return 4; },
+      [](int, int) { return 5; },
+      [](int) { return 6; },
+      [](int, int, int) { return 7; },
+      [](double) { return 8; },
+      [](float) { return 9; },
+      [](int, int) { return 10; },
+    };
+    check_eq(res_of(f, m1), 3);
+    check_eq(res_of(f, m2), 5);
+    check_eq(res_of(f, m3), 7);
+    auto m4 = make_message(int8_t{1});
+    check_eq(res_of(f, m4), 1);
+    auto m5 = make_message(1.0f);
+    check_eq(res_of(f, m5), 9);
+    auto m6 = make_message("hello"s);
+    check_eq(res_of(f, m6), std::nullopt);
+  }
+  SECTION("a catch-all handler receives all messages after its position") {
+    auto f = behavior{
+      [](int8_t) { return 1; },
+      [](int16_t) { return 2; },
+      [](int, int) { return 3; },
+      [](message) { return 4; },
+      [](int) { return 5; },
+      [](int64_t) { return 6; },
+      [](int, int, int) { return 7; },
+      [](double) { return 8; },
+      [](float) { return 9; },
+      [](exit_msg&) { return 10; },
+    };
+    check_eq(res_of(f, m1), 4);
+    check_eq(res_of(f, m2), 3);
+    check_eq(res_of(f, m3), 4);
+    auto m4 = make_message(int16_t{1});
+    check_eq(res_of(f, m4), 2);
+    auto m5 = make_message(exit_msg{actor_addr{}, exit_reason::user_shutdown});
+    check_eq(res_of(f, m5), 10);
+    auto m6 = make_message(down_msg{actor_addr{}, exit_reason::user_shutdown});
+    check_eq(res_of(f, m6), std::nullopt);
+  }
+}
+
 TEST("mutable references in a message handler forces a message to detach") {
   auto str = cow_string{"hello"s};
   auto msg = make_message(str);
@@ -49,6 +49,43 @@ void unsafe_int_value(binary_deserializer& source, T& x) {
   x = static_cast<T>(detail::from_network_order(tmp));
 }
 
+// Reads `xs.size()` packed values in network byte order and converts each value
+// with `fn`.
+template <class Packed, class T, class F>
+bool bulk_convert(binary_deserializer& source, span<T> xs, F fn) {
+  auto num_bytes = xs.size() * sizeof(Packed);
+  if (source.remaining() < num_bytes) {
+    source.emplace_error(sec::end_of_stream);
+    return false;
+  }
+  auto* in = source.current();
+  // Simple loop that the compiler can turn into vectorized byte swaps.
+  for (auto& x : xs) {
+    Packed tmp;
+    memcpy(&tmp, in, sizeof(tmp));
+    x = fn(detail::from_network_order(tmp));
+    in += sizeof(tmp);
+  }
+  source.skip(num_bytes);
+  return true;
+}
+
+template <class T>
+bool bulk_int_value(binary_deserializer& source, span<T> xs) {
+  using unsigned_type = std::make_unsigned_t<T>;
+  return bulk_convert<unsigned_type>(source, xs, [](unsigned_type x) {
+    return static_cast<T>(x);
+  });
+}
+
+template <class T>
+bool bulk_float_value(binary_deserializer& source, span<T> xs) {
+  using packed_type = typename detail::ieee_754_trait<T>::packed_type;
+  return bulk_convert<packed_type>(source, xs, [](packed_type x) {
+    return detail::unpack754(x);
+  });
+}
+
 } // namespace
 
 bool binary_deserializer::fetch_next_object_type(type_id_t& type) noexcept {
@@ -247,6 +284,50 @@ bool binary_deserializer::value(span<std::byte> x) noexcept {
   return true;
 }
 
+bool binary_deserializer::bulk_value(span<std::byte> xs) noexcept {
+  return value(xs);
+}
+
+bool binary_deserializer::bulk_value(span<int8_t> xs) noexcept {
+  return value(as_writable_bytes(xs));
+}
+
+bool binary_deserializer::bulk_value(span<uint8_t> xs) noexcept {
+  return value(as_writable_bytes(xs));
+}
+
+bool binary_deserializer::bulk_value(span<int16_t> xs) noexcept {
+  return bulk_int_value(*this, xs);
+}
+
+bool binary_deserializer::bulk_value(span<uint16_t> xs) noexcept {
+  return bulk_int_value(*this, xs);
+}
+
+bool binary_deserializer::bulk_value(span<int32_t> xs) noexcept {
+  return bulk_int_value(*this, xs);
+}
+
+bool binary_deserializer::bulk_value(span<uint32_t> xs) noexcept {
+  return bulk_int_value(*this, xs);
+}
+
+bool binary_deserializer::bulk_value(span<int64_t> xs) noexcept {
+  return bulk_int_value(*this, xs);
+}
+
+bool binary_deserializer::bulk_value(span<uint64_t> xs) noexcept {
+  return bulk_int_value(*this, xs);
+}
+
+bool binary_deserializer::bulk_value(span<float> xs) noexcept {
+  return bulk_float_value(*this, xs);
+}
+
+bool binary_deserializer::bulk_value(span<double> xs) noexcept {
+  return bulk_float_value(*this, xs);
+}
+
 bool binary_deserializer::value(std::string& x) {
   x.clear();
   size_t str_size = 0;
@@ -6,6 +6,7 @@
 
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/squashed_int.hpp"
+#include "caf/detail/type_traits.hpp"
 #include "caf/error_code.hpp"
 #include "caf/fwd.hpp"
 #include "caf/load_inspector_base.hpp"
@@ -206,6 +207,61 @@ public:
 
   bool value(std::vector<bool>& x);
 
+  template <class T>
+  bool list(T& xs) {
+    if constexpr (detail::is_bulk_sequence_v<T>) {
+      using value_type = typename T::value_type;
+      auto size = size_t{0};
+      if (!begin_sequence(size))
+        return false;
+      // Check the size before allocating memory for the elements.
+      if (!range_check(size * sizeof(value_type))) {
+        emplace_error(sec::end_of_stream);
+        return false;
+      }
+      xs.resize(size);
+      return bulk_value(make_span(xs.data(), size)) && end_sequence();
+    } else {
+      return super::list(xs);
+    }
+  }
+
+  // -- bulk conversion --------------------------------------------------------
+
+  /// Reads `xs.size()` elements into `xs`. Accepts the same input as calling
+  /// `value` for each element, but converts all elements in a single pass.
+  bool bulk_value(span<std::byte> xs) noexcept;
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<int8_t> xs) noexcept;
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<uint8_t> xs) noexcept;
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<int16_t> xs) noexcept;
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<uint16_t> xs) noexcept;
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<int32_t> xs) noexcept;
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<uint32_t> xs) noexcept;
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<int64_t> xs) noexcept;
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<uint64_t> xs) noexcept;
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<float> xs) noexcept;
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<double> xs) noexcept;
+
 private:
   explicit binary_deserializer(actor_system& sys) noexcept;
 
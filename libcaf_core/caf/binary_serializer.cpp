@@ -10,7 +10,9 @@
 #include "caf/detail/network_order.hpp"
 #include "caf/detail/squashed_int.hpp"
 
+#include <cstring>
 #include <iomanip>
+#include <utility>
 
 namespace caf {
 
@@ -23,6 +25,35 @@ auto int_value(binary_serializer& sink, T x) {
   return sink.value(as_bytes(make_span(&y, 1)));
 }
 
+// Converts each element with `fn` and stores the results in network byte order
+// at the current write position.
+template <class T, class F>
+bool bulk_convert(binary_serializer& sink, span<const T> xs, F fn) {
+  using packed_type = decltype(fn(std::declval<T>()));
+  auto pos = sink.write_pos();
+  sink.skip(xs.size() * sizeof(packed_type));
+  auto* out = sink.buf().data() + pos;
+  // Simple loop that the compiler can turn into vectorized byte swaps.
+  for (auto x : xs) {
+    auto y = detail::to_network_order(fn(x));
+    memcpy(out, &y, sizeof(y));
+    out += sizeof(y);
+  }
+  return true;
+}
+
+template <class T>
+bool bulk_int_value(binary_serializer& sink, span<const T> xs) {
+  using unsigned_type = detail::squashed_int_t<std::make_unsigned_t<T>>;
+  return bulk_convert(sink, xs,
+                      [](T x) { return static_cast<unsigned_type>(x); });
+}
+
+template <class T>
+bool bulk_float_value(binary_serializer& sink, span<const T> xs) {
+  return bulk_convert(sink, xs, [](T x) { return detail::pack754(x); });
+}
+
 } // namespace
 
 void binary_serializer::skip(size_t num_bytes) {
@@ -119,6 +150,50 @@ bool binary_serializer::value(span<const std::byte> x) {
   return true;
 }
 
+bool binary_serializer::bulk_value(span<const std::byte> xs) {
+  return value(xs);
+}
+
+bool binary_serializer::bulk_value(span<const int8_t> xs) {
+  return value(as_bytes(xs));
+}
+
+bool binary_serializer::bulk_value(span<const uint8_t> xs) {
+  return value(as_bytes(xs));
+}
+
+bool binary_serializer::bulk_value(span<const int16_t> xs) {
+  return bulk_int_value(*this, xs);
+}
+
+bool binary_serializer::bulk_value(span<const uint16_t> xs) {
+  return bulk_int_value(*this, xs);
+}
+
+bool binary_serializer::bulk_value(span<const int32_t> xs) {
+  return bulk_int_value(*this, xs);
+}
+
+bool binary_serializer::bulk_value(span<const uint32_t> xs) {
+  return bulk_int_value(*this, xs);
+}
+
+bool binary_serializer::bulk_value(span<const int64_t> xs) {
+  return bulk_int_value(*this, xs);
+}
+
+bool binary_serializer::bulk_value(span<const uint64_t> xs) {
+  return bulk_int_value(*this, xs);
+}
+
+bool binary_serializer::bulk_value(span<const float> xs) {
+  return bulk_float_value(*this, xs);
+}
+
+bool binary_serializer::bulk_value(span<const double> xs) {
+  return bulk_float_value(*this, xs);
+}
+
 bool binary_serializer::value(std::byte x) {
   if (write_pos_ == buf_.size())
     buf_.emplace_back(x);
@@ -7,6 +7,7 @@
 #include "caf/byte_buffer.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/squashed_int.hpp"
+#include "caf/detail/type_traits.hpp"
 #include "caf/fwd.hpp"
 #include "caf/save_inspector_base.hpp"
 #include "caf/span.hpp"
@@ -187,6 +188,53 @@ public:
 
   bool value(const std::vector<bool>& x);
 
+  template <class T>
+  bool list(const T& xs) {
+    if constexpr (detail::is_bulk_sequence_v<T>) {
+      return begin_sequence(xs.size())
+             && bulk_value(make_span(xs.data(), xs.size())) && end_sequence();
+    } else {
+      return super::list(xs);
+    }
+  }
+
+  // -- bulk conversion --------------------------------------------------------
+
+  /// Writes all elements of `xs` without a size prefix. Produces the same
+  /// output as calling `value` for each element, but converts all elements in
+  /// a single pass over a pre-allocated block of the buffer.
+  bool bulk_value(span<const std::byte> xs);
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<const int8_t> xs);
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<const uint8_t> xs);
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<const int16_t> xs);
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<const uint16_t> xs);
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<const int32_t> xs);
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<const uint32_t> xs);
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<const int64_t> xs);
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<const uint64_t> xs);
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<const float> xs);
+
+  /// @copydoc bulk_value
+  bool bulk_value(span<const double> xs);
+
 private:
   /// Stores the serialized output.
   byte_buffer& buf_;
@@ -59,18 +59,13 @@ bool blocking_actor::enqueue(mailbox_element_ptr ptr, scheduler*) {
   CAF_LOG_SEND_EVENT(ptr);
   auto mid = ptr->mid;
   auto src = ptr->sender;
-  auto collects_metrics = getf(abstract_actor::collects_metrics_flag);
-  if (collects_metrics) {
+  if (getf(abstract_actor::collects_metrics_flag))
     ptr->set_enqueue_time();
-    metrics_.mailbox_size->inc();
-  }
   // returns false if mailbox has been closed
   switch (mailbox().push_back(std::move(ptr))) {
     case intrusive::inbox_result::queue_closed: {
       CAF_LOG_REJECT_EVENT();
       home_system().base_metrics().rejected_messages->inc();
-      if (collects_metrics)
-        metrics_.mailbox_size->dec();
       if (mid.is_request()) {
         detail::sync_request_bouncer srb{exit_reason()};
         srb(src, mid);
@@ -83,6 +78,10 @@ bool blocking_actor::enqueue(mailbox_element_ptr ptr, scheduler*) {
       cv_.notify_one();
       return true;
     }
+    case intrusive::inbox_result::queue_full:
+      // The mailbox dropped the message and took care of the sender.
+      CAF_LOG_REJECT_EVENT();
+      return false;
     default:
       CAF_LOG_ACCEPT_EVENT(false);
       return true;
@@ -93,6 +92,10 @@ mailbox_element* blocking_actor::peek_at_next_mailbox_element() {
   return mailbox_.peek(make_message_id());
 }
 
+size_t blocking_actor::approximate_mailbox_size() const noexcept {
+  return mailbox_.approximate_size();
+}
+
 const char* blocking_actor::name() const {
   return "user.blocking-actor";
 }
@@ -137,8 +140,8 @@ public:
     intrusive_ptr_release(self_->ctrl());
     sys.release_private_thread(thread_);
     if (!hidden_) {
-      [[maybe_unused]] auto count = sys.registry().dec_running();
-      log::system::debug("actor {} decreased running count to {}", id, count);
+      sys.registry().dec_running();
+      log::system::debug("actor {} decreased running count", id);
     }
     return resumable::done;
   }
@@ -170,8 +173,8 @@ void blocking_actor::launch(scheduler*, bool, bool hide) {
   // Note: must *not* call register_at_system() to stop actor cleanup from
   // decrementing the count before releasing the thread.
   if (!hide) {
-    [[maybe_unused]] auto count = sys.registry().inc_running();
-    log::system::debug("actor {} increased running count to {}", id(), count);
+    sys.registry().inc_running();
+    log::system::debug("actor {} increased running count", id());
   }
   thread->resume(new blocking_actor_runner(this, thread, hide));
 }
@@ -286,7 +289,6 @@ void blocking_actor::receive_impl(receive_cond& rcc, message_id mid,
         auto& builtins = builtin_metrics();
         telemetry::timer::observe(builtins.processing_time, t0);
         builtins.mailbox_time->observe(mbox_time);
-        builtins.mailbox_size->dec();
       }
       // Check whether we are done.
       if (!rcc.post() || !rcc.pre()) {
@@ -374,9 +376,8 @@ void blocking_actor::unstash() {
 void blocking_actor::close_mailbox(const error& reason) {
   if (!mailbox_.closed()) {
     unstash();
-    auto dropped = mailbox_.close(reason);
-    if (dropped > 0 && metrics_.mailbox_size)
-      metrics_.mailbox_size->dec(static_cast<int64_t>(dropped));
+    mailbox_.close(reason);
+    stop_reporting_mailbox_size();
   }
 }
 
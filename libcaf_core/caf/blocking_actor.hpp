@@ -168,6 +168,8 @@ public:
 
   mailbox_element* peek_at_next_mailbox_element() override;
 
+  size_t approximate_mailbox_size() const noexcept override;
+
   // -- overridden functions of local_actor ------------------------------------
 
   const char* name() const override;
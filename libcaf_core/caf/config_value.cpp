@@ -477,10 +477,8 @@ config_value::parse_msg_impl(std::string_view str,
       auto unused = size_t{0};
       reader.begin_sequence(unused);
       CAF_ASSERT(unused == ls_size);
-      intrusive_ptr<detail::message_data> ptr;
-      if (auto vptr = malloc(sizeof(detail::message_data) + ls.data_size()))
-        ptr.reset(new (vptr) detail::message_data(ls), false);
-      else
+      auto ptr = detail::message_data::try_make_uninitialized(ls);
+      if (ptr == nullptr)
         return false;
       auto pos = ptr->storage();
       for (auto type : ls) {
@@ -98,6 +98,33 @@ constexpr auto max_throughput = std::numeric_limits<size_t>::max();
 
 } // namespace caf::defaults::scheduler
 
+namespace caf::defaults::clock {
+
+constexpr auto policy = std::string_view{"default"};
+constexpr auto resolution = timespan{1'000'000};
+
+} // namespace caf::defaults::clock
+
+namespace caf::defaults::mailbox {
+
+/// Maximum number of pending messages per actor. Zero disables the limit.
+constexpr auto capacity = size_t{0};
+
+/// Configures what happens to new messages once a mailbox reached capacity.
+constexpr auto overflow_policy = std::string_view{"drop_newest"};
+
+} // namespace caf::defaults::mailbox
+
+namespace caf::defaults::message_pool {
+
+/// Configures whether CAF allocates messages from per-thread memory pools.
+constexpr auto enabled = false;
+
+/// Maximum number of free blocks each thread caches per size class.
+constexpr auto max_cached_blocks = size_t{1024};
+
+} // namespace caf::defaults::message_pool
+
 namespace caf::defaults::work_stealing {
 
 constexpr auto aggressive_poll_attempts = size_t{100};
@@ -112,6 +139,7 @@ constexpr auto relaxed_sleep_duration = timespan{10'000'000};
 
 namespace caf::defaults::logger::file {
 
+constexpr auto binary = false;
 constexpr auto format = std::string_view{"%r %c %p %a %t %M %F:%L %m%n"};
 constexpr auto path
   = std::string_view{"actor_log_[PID]_[TIMESTAMP]_[NODE].log"};
@@ -129,6 +157,8 @@ namespace caf::defaults::middleman {
 
 constexpr auto app_identifier = std::string_view{"generic-caf-app"};
 constexpr auto cached_udp_buffers = size_t{10};
+constexpr auto compression = std::string_view{""};
+constexpr auto compression_threshold = size_t{1024};
 constexpr auto connection_timeout = timespan{30'000'000'000};
 constexpr auto heartbeat_interval = timespan{10'000'000'000};
 constexpr auto max_consecutive_reads = size_t{50};
@@ -174,4 +204,10 @@ constexpr auto https_default_port = uint16_t{443};
 /// The default buffer size for reading and writing octet streams.
 constexpr auto octet_stream_buffer_size = uint32_t{1024};
 
+/// The default implementation for the multiplexer of the middleman.
+constexpr auto multiplexer_backend = std::string_view{"poll"};
+
+/// The default number of multiplexer threads of the middleman.
+constexpr auto multiplexer_threads = size_t{1};
+
 } // namespace caf::defaults::net
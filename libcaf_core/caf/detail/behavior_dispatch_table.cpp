@@ -0,0 +1,63 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/behavior_dispatch_table.hpp"
+
+namespace caf::detail {
+
+behavior_dispatch_table::behavior_dispatch_table(
+  span<const type_id_list> cases) {
+  // Keep the load factor at or below 50% to keep probe sequences short.
+  size_t capacity = 4;
+  while (capacity < cases.size() * 2)
+    capacity *= 2;
+  slots_.resize(capacity, slot{0, nullptr, 0});
+  mask_ = capacity - 1;
+  for (size_t index = 0; index < cases.size(); ++index) {
+    auto types = cases[index];
+    if (!types) {
+      if (catch_all_ == npos)
+        catch_all_ = index;
+      continue;
+    }
+    auto hash = hash_of(types);
+    auto pos = static_cast<size_t>(hash) & mask_;
+    for (;; pos = (pos + 1) & mask_) {
+      auto& entry = slots_[pos];
+      if (entry.index == 0) {
+        entry = slot{hash, types.data(), index + 1};
+        break;
+      }
+      // Handlers that come later never receive a message if a previous
+      // handler accepts the same types.
+      if (entry.hash == hash && type_id_list{entry.types} == types)
+        break;
+    }
+  }
+}
+
+size_t behavior_dispatch_table::find(type_id_list types) const noexcept {
+  auto hash = hash_of(types);
+  auto pos = static_cast<size_t>(hash) & mask_;
+  for (;; pos = (pos + 1) & mask_) {
+    auto& entry = slots_[pos];
+    if (entry.index == 0)
+      return npos;
+    if (entry.hash == hash && type_id_list{entry.types} == types)
+      return entry.index - 1;
+  }
+}
+
+uint64_t behavior_dispatch_table::hash_of(type_id_list types) noexcept {
+  // FNV-1a over the type IDs. The low bits of the FNV hash only depend on the
+  // low bits of the input, so we fold the high bits in at the end.
+  auto result = uint64_t{0xcbf29ce484222325};
+  for (auto id : types) {
+    result ^= id;
+    result *= uint64_t{0x100000001b3};
+  }
+  return result ^ (result >> 32);
+}
+
+} // namespace caf::detail
@@ -0,0 +1,67 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/detail/core_export.hpp"
+#include "caf/span.hpp"
+#include "caf/type_id_list.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace caf::detail {
+
+/// Maps the types of a message to the first handler of a behavior that
+/// accepts them. Behaviors with many handlers use this table to select a
+/// handler with a single lookup instead of comparing the types of the message
+/// to each handler in turn.
+class CAF_CORE_EXPORT behavior_dispatch_table {
+public:
+  /// Signals that no handler accepts a message.
+  static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+  /// Creates a table for a behavior with `cases.size()` handlers.
+  /// @param cases Contains the argument types for each handler or an invalid
+  ///              `type_id_list` (`nullptr`) for handlers that accept any
+  ///              message.
+  explicit behavior_dispatch_table(span<const type_id_list> cases);
+
+  /// Returns the index of the first handler with argument types `types` or
+  /// `npos` if no such handler exists. Ignores catch-all handlers.
+  size_t find(type_id_list types) const noexcept;
+
+  /// Returns the index of the first catch-all handler or `npos` if the
+  /// behavior has no catch-all handler.
+  size_t catch_all() const noexcept {
+    return catch_all_;
+  }
+
+private:
+  struct slot {
+    /// Stores the hash of `types`.
+    uint64_t hash;
+
+    /// Stores the argument types of the handler.
+    const type_id_t* types;
+
+    /// Stores the index of the handler plus one or 0 for empty slots.
+    size_t index;
+  };
+
+  static uint64_t hash_of(type_id_list types) noexcept;
+
+  /// Stores all handlers in an open-addressing hash table.
+  std::vector<slot> slots_;
+
+  /// Stores `slots_.size() - 1`.
+  size_t mask_ = 0;
+
+  /// Stores the index of the first catch-all handler.
+  size_t catch_all_ = npos;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,99 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/behavior_dispatch_table.hpp"
+
+#include "caf/test/test.hpp"
+
+#include "caf/message.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace caf;
+
+using detail::behavior_dispatch_table;
+
+namespace {
+
+constexpr auto npos = behavior_dispatch_table::npos;
+
+type_id_list catch_all() {
+  return type_id_list{nullptr};
+}
+
+} // namespace
+
+TEST("an empty table finds no handler") {
+  behavior_dispatch_table uut{span<const type_id_list>{}};
+  check_eq(uut.find(make_type_id_list<int32_t>()), npos);
+  check_eq(uut.find(make_type_id_list<>()), npos);
+  check_eq(uut.catch_all(), npos);
+}
+
+TEST("the table maps type lists to the index of the first matching handler") {
+  std::vector<type_id_list> cases{
+    make_type_id_list<int32_t>(),
+    make_type_id_list<int32_t, int32_t>(),
+    make_type_id_list<std::string>(),
+    make_type_id_list<int32_t>(),
+    make_type_id_list<>(),
+    make_type_id_list<std::string, int32_t>(),
+  };
+  behavior_dispatch_table uut{cases};
+  check_eq(uut.find(make_type_id_list<int32_t>()), 0u);
+  check_eq(uut.find(make_type_id_list<int32_t, int32_t>()), 1u);
+  check_eq(uut.find(make_type_id_list<std::string>()), 2u);
+  check_eq(uut.find(make_type_id_list<>()), 4u);
+  check_eq(uut.find(make_type_id_list<std::string, int32_t>()), 5u);
+  check_eq(uut.find(make_type_id_list<int32_t, std::string>()), npos);
+  check_eq(uut.find(make_type_id_list<double>()), npos);
+  check_eq(uut.catch_all(), npos);
+}
+
+TEST("the table compares type lists by value") {
+  std::vector<type_id_list> cases{make_type_id_list<int32_t, double>()};
+  behavior_dispatch_table uut{cases};
+  auto msg = make_message(int32_t{1}, 2.0);
+  check_eq(uut.find(msg.types()), 0u);
+}
+
+TEST("the table stores the index of the first catch-all handler") {
+  std::vector<type_id_list> cases{
+    make_type_id_list<int32_t>(),
+    catch_all(),
+    make_type_id_list<double>(),
+    catch_all(),
+  };
+  behavior_dispatch_table uut{cases};
+  check_eq(uut.catch_all(), 1u);
+  check_eq(uut.find(make_type_id_list<int32_t>()), 0u);
+  check_eq(uut.find(make_type_id_list<double>()), 2u);
+}
+
+TEST("the table supports many handlers") {
+  // Generate distinct type lists by combining four types in all orders.
+  std::vector<type_id_list> cases;
+  cases.push_back(make_type_id_list<int8_t, int16_t, int32_t, int64_t>());
+  cases.push_back(make_type_id_list<int8_t, int16_t, int64_t, int32_t>());
+  cases.push_back(make_type_id_list<int8_t, int32_t, int16_t, int64_t>());
+  cases.push_back(make_type_id_list<int8_t, int32_t, int64_t, int16_t>());
+  cases.push_back(make_type_id_list<int8_t, int64_t, int16_t, int32_t>());
+  cases.push_back(make_type_id_list<int8_t, int64_t, int32_t, int16_t>());
+  cases.push_back(make_type_id_list<int8_t>());
+  cases.push_back(make_type_id_list<int16_t>());
+  cases.push_back(make_type_id_list<int32_t>());
+  cases.push_back(make_type_id_list<int64_t>());
+  cases.push_back(make_type_id_list<uint8_t>());
+  cases.push_back(make_type_id_list<uint16_t>());
+  cases.push_back(make_type_id_list<uint32_t>());
+  cases.push_back(make_type_id_list<uint64_t>());
+  cases.push_back(make_type_id_list<float>());
+  cases.push_back(make_type_id_list<double>());
+  cases.push_back(make_type_id_list<std::string>());
+  behavior_dispatch_table uut{cases};
+  for (size_t index = 0; index < cases.size(); ++index)
+    check_eq(uut.find(cases[index]), index);
+  check_eq(uut.find(make_type_id_list<bool>()), npos);
+}
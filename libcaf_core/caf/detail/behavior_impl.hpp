@@ -6,6 +6,7 @@
 
 #include "caf/const_typed_message_view.hpp"
 #include "caf/detail/apply_args.hpp"
+#include "caf/detail/behavior_dispatch_table.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/int_list.hpp"
 #include "caf/detail/invoke_result_visitor.hpp"
@@ -23,6 +24,7 @@
 #include "caf/typed_message_view.hpp"
 #include "caf/typed_response_promise.hpp"
 
+#include <array>
 #include <optional>
 #include <tuple>
 #include <type_traits>
@@ -87,6 +89,11 @@ struct dummy_timeout_definition {
   }
 };
 
+/// Behaviors with at least this many handlers select the handler for a
+/// message with a lookup in a `behavior_dispatch_table` instead of trying each
+/// handler in turn.
+constexpr size_t behavior_dispatch_table_threshold = 8;
+
 template <class Tuple, class TimeoutDefinition = dummy_timeout_definition>
 class default_behavior_impl;
 
@@ -106,68 +113,114 @@ public:
   }
 
   virtual bool invoke(detail::invoke_result_visitor& f, message& xs) override {
-    return invoke_impl(f, xs, std::make_index_sequence<sizeof...(Ts)>{});
+    std::make_index_sequence<sizeof...(Ts)> indexes;
+    if constexpr (sizeof...(Ts) >= behavior_dispatch_table_threshold)
+      return invoke_indexed(f, xs, indexes);
+    else
+      return invoke_impl(f, xs, indexes);
   }
 
   template <size_t... Is>
   bool invoke_impl(detail::invoke_result_visitor& f, message& msg,
                    std::index_sequence<Is...>) {
-    [[maybe_unused]] auto dispatch = [&](auto& fun) {
-      using fun_type = std::decay_t<decltype(fun)>;
-      using trait = get_callable_trait_t<fun_type>;
-      using fn_args = typename trait::arg_types;
-      using decayed_args = typename trait::decayed_arg_types;
-      if constexpr (std::is_same_v<decayed_args, type_list<message>>) {
-        using fun_result = decltype(fun(msg));
-        if (auto types = msg.types();
-            types.size() == 1 && is_system_message(types[0])) {
-          // The fallback handler must not consume system messages such as
-          // exit_msg. They must be handled explicitly by the actor or else use
-          // the hard-coded default.
-          return false;
-        }
+    return (invoke_case<Is>(f, msg) || ...);
+  }
+
+  template <size_t... Is>
+  bool invoke_indexed(detail::invoke_result_visitor& f, message& msg,
+                      std::index_sequence<Is...>) {
+    // The table only depends on the types of the handlers. Hence, all
+    // instances of this class share a single table.
+    static const behavior_dispatch_table table{case_types()};
+    using case_fn = bool (default_behavior_impl::*)(invoke_result_visitor&,
+                                                    message&);
+    static constexpr case_fn cases[] = {
+      &default_behavior_impl::invoke_case<Is>...,
+    };
+    constexpr auto npos = behavior_dispatch_table::npos;
+    auto index = table.find(msg.types());
+    auto catch_all = table.catch_all();
+    if (index < catch_all)
+      return (this->*cases[index])(f, msg);
+    // A catch-all handler in front of the matching handler gets the message
+    // first unless it rejects system messages.
+    if (catch_all != npos && (this->*cases[catch_all])(f, msg))
+      return true;
+    if (index != npos)
+      return (this->*cases[index])(f, msg);
+    return false;
+  }
+
+  /// Returns the argument types for each handler or an invalid list for
+  /// catch-all handlers.
+  static std::array<type_id_list, sizeof...(Ts)> case_types() {
+    auto case_type = [](auto* ptr) {
+      using fun_type = std::remove_pointer_t<decltype(ptr)>;
+      using decayed_args = typename get_callable_trait_t<
+        fun_type>::decayed_arg_types;
+      if constexpr (std::is_same_v<decayed_args, type_list<message>>)
+        return type_id_list{nullptr};
+      else
+        return to_type_id_list<decayed_args>();
+    };
+    return {{case_type(static_cast<Ts*>(nullptr))...}};
+  }
+
+  template <size_t I>
+  bool invoke_case(detail::invoke_result_visitor& f, message& msg) {
+    auto& fun = std::get<I>(cases_);
+    using fun_type = std::decay_t<decltype(fun)>;
+    using trait = get_callable_trait_t<fun_type>;
+    using fn_args = typename trait::arg_types;
+    using decayed_args = typename trait::decayed_arg_types;
+    if constexpr (std::is_same_v<decayed_args, type_list<message>>) {
+      using fun_result = decltype(fun(msg));
+      if (auto types = msg.types();
+          types.size() == 1 && is_system_message(types[0])) {
+        // The fallback handler must not consume system messages such as
+        // exit_msg. They must be handled explicitly by the actor or else use
+        // the hard-coded default.
+        return false;
+      }
+      if constexpr (std::is_same_v<void, fun_result>) {
+        fun(msg);
+        f(unit);
+      } else {
+        auto invoke_res = fun(msg);
+        f(invoke_res);
+      }
+      return true;
+    } else {
+      using detail::apply_args_auto_move;
+      auto arg_types = to_type_id_list<decayed_args>();
+      if (arg_types != msg.types())
+        return false;
+      auto do_invoke = [&](auto& xs) {
+        using fun_result = decltype(detail::apply_args(fun, xs));
+        auto token = detail::get_indices(xs);
         if constexpr (std::is_same_v<void, fun_result>) {
-          fun(msg);
+          apply_args_auto_move(fun, fn_args{}, token, xs);
           f(unit);
         } else {
-          auto invoke_res = fun(msg);
+          auto invoke_res = apply_args_auto_move(fun, fn_args{}, token, xs);
           f(invoke_res);
         }
-        return true;
-      } else {
-        using detail::apply_args_auto_move;
-        auto arg_types = to_type_id_list<decayed_args>();
-        if (arg_types != msg.types())
-          return false;
-        auto do_invoke = [&](auto& xs) {
-          using fun_result = decltype(detail::apply_args(fun, xs));
-          auto token = detail::get_indices(xs);
-          if constexpr (std::is_same_v<void, fun_result>) {
-            apply_args_auto_move(fun, fn_args{}, token, xs);
-            f(unit);
-          } else {
-            auto invoke_res = apply_args_auto_move(fun, fn_args{}, token, xs);
-            f(invoke_res);
-          }
-        };
-        using view_type = typename trait::message_view_type;
-        // If we have the only reference to a message, we can safely modify it
-        // in place, i.e., use the mutable view type and move values from the
-        // message to the function arguments.
-        if constexpr (view_type::is_const) {
-          if (msg.unique()) {
-            typename trait::mutable_message_view_type xs{msg};
-            do_invoke(xs);
-            return true;
-          }
+      };
+      using view_type = typename trait::message_view_type;
+      // If we have the only reference to a message, we can safely modify it
+      // in place, i.e., use the mutable view type and move values from the
+      // message to the function arguments.
+      if constexpr (view_type::is_const) {
+        if (msg.unique()) {
+          typename trait::mutable_message_view_type xs{msg};
+          do_invoke(xs);
+          return true;
         }
-        view_type xs{msg};
-        do_invoke(xs);
-        return true;
       }
-      return false;
-    };
-    return (dispatch(std::get<Is>(cases_)) || ...);
+      view_type xs{msg};
+      do_invoke(xs);
+      return true;
+    }
   }
 
   void handle_timeout() override {
@@ -0,0 +1,146 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/binary_log_writer.hpp"
+
+#include "caf/chunked_string.hpp"
+#include "caf/detail/assert.hpp"
+
+#include <cstring>
+#include <iterator>
+#include <sstream>
+
+namespace caf::detail {
+
+binary_log_writer::binary_log_writer(timestamp t0) : t0_(t0) {
+  for (auto ch : magic)
+    write_byte(static_cast<uint8_t>(ch));
+  write_byte(version);
+  write_byte(0); // reserved
+  write_signed_varint(t0.time_since_epoch().count());
+}
+
+void binary_log_writer::append(const log::event& event) {
+  // Write string records for new strings before starting the event record.
+  auto thread = thread_string_id(event.thread_id());
+  auto component = string_id(event.component());
+  auto file = string_id(event.file_name());
+  auto function = string_id(event.function_name());
+  intern_keys(event.fields());
+  write_byte(event_record);
+  write_varint(event.level());
+  write_signed_varint((event.timestamp() - t0_).count());
+  write_varint(event.actor_id());
+  write_varint(thread);
+  write_varint(component);
+  write_varint(file);
+  write_varint(event.line_number());
+  write_varint(function);
+  auto msg = event.message();
+  write_varint(msg.size());
+  for (auto chunk : msg)
+    for (auto ch : chunk)
+      write_byte(static_cast<uint8_t>(ch));
+  write_fields(event.fields());
+}
+
+void binary_log_writer::write_byte(uint8_t value) {
+  buf_.push_back(static_cast<std::byte>(value));
+}
+
+void binary_log_writer::write_varint(uint64_t value) {
+  while (value > 0x7f) {
+    write_byte(static_cast<uint8_t>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  write_byte(static_cast<uint8_t>(value));
+}
+
+void binary_log_writer::write_signed_varint(int64_t value) {
+  write_varint((static_cast<uint64_t>(value) << 1)
+               ^ static_cast<uint64_t>(value >> 63));
+}
+
+void binary_log_writer::write_string(std::string_view str) {
+  write_varint(str.size());
+  for (auto ch : str)
+    write_byte(static_cast<uint8_t>(ch));
+}
+
+void binary_log_writer::write_fields(log::event::field_list fields) {
+  write_varint(static_cast<uint64_t>(std::distance(fields.begin(),
+                                                   fields.end())));
+  for (const auto& field : fields) {
+    // Note: `intern_keys` has added all keys to the string table already.
+    auto key = strings_.find(field.key);
+    CAF_ASSERT(key != strings_.end());
+    write_varint(key->second);
+    auto fn = [this](const auto& value) {
+      using value_t = std::decay_t<decltype(value)>;
+      if constexpr (std::is_same_v<value_t, std::nullopt_t>) {
+        write_byte(null_field);
+      } else if constexpr (std::is_same_v<value_t, bool>) {
+        write_byte(bool_field);
+        write_byte(value ? 1 : 0);
+      } else if constexpr (std::is_same_v<value_t, int64_t>) {
+        write_byte(int_field);
+        write_signed_varint(value);
+      } else if constexpr (std::is_same_v<value_t, uint64_t>) {
+        write_byte(uint_field);
+        write_varint(value);
+      } else if constexpr (std::is_same_v<value_t, double>) {
+        write_byte(double_field);
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        for (int i = 0; i < 8; ++i)
+          write_byte(static_cast<uint8_t>(bits >> (i * 8)));
+      } else if constexpr (std::is_same_v<value_t, std::string_view>) {
+        write_byte(string_field);
+        write_string(value);
+      } else if constexpr (std::is_same_v<value_t, chunked_string>) {
+        write_byte(string_field);
+        write_varint(value.size());
+        for (auto chunk : value)
+          for (auto ch : chunk)
+            write_byte(static_cast<uint8_t>(ch));
+      } else {
+        static_assert(std::is_same_v<value_t, log::event::field_list>);
+        write_byte(list_field);
+        write_fields(value);
+      }
+    };
+    std::visit(fn, field.value);
+  }
+}
+
+void binary_log_writer::intern_keys(log::event::field_list fields) {
+  for (const auto& field : fields) {
+    string_id(field.key);
+    if (auto* nested = std::get_if<log::event::field_list>(&field.value))
+      intern_keys(*nested);
+  }
+}
+
+uint64_t binary_log_writer::string_id(std::string_view str) {
+  if (auto i = strings_.find(str); i != strings_.end())
+    return i->second;
+  auto id = static_cast<uint64_t>(strings_.size());
+  strings_.emplace(std::string{str}, id);
+  write_byte(string_record);
+  write_varint(id);
+  write_string(str);
+  return id;
+}
+
+uint64_t binary_log_writer::thread_string_id(std::thread::id tid) {
+  if (auto i = threads_.find(tid); i != threads_.end())
+    return i->second;
+  std::ostringstream str;
+  str << tid;
+  auto id = string_id(str.str());
+  threads_.emplace(tid, id);
+  return id;
+}
+
+} // namespace caf::detail
@@ -0,0 +1,123 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/byte_buffer.hpp"
+#include "caf/byte_span.hpp"
+#include "caf/detail/core_export.hpp"
+#include "caf/fwd.hpp"
+#include "caf/log/event.hpp"
+#include "caf/timestamp.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+namespace caf::detail {
+
+/// Encodes log events in a compact binary format. The script
+/// `scripts/decode_binary_log.py` converts the output back to text.
+///
+/// The output starts with a header that consists of the magic string `CAFLOG`,
+/// the version of the format (one byte), a reserved byte and the start time of
+/// the logger (nanoseconds since the UNIX epoch). After the header, the output
+/// contains a sequence of records. Each record starts with a tag byte:
+/// - `string_record`: assigns the next ID to a string. Events refer to
+///   component names, file names, function names, thread IDs and field keys
+///   only by ID, so each of these strings appears only once in the output.
+/// - `event_record`: the level, the timestamp (relative to the start time),
+///   the actor ID, the string IDs for thread, component, file, line and
+///   function as well as the message and the list of user-defined fields.
+///
+/// All integers use the variable-length LEB128 encoding, signed integers are
+/// zigzag-encoded first. Strings are prefixed with their size.
+class CAF_CORE_EXPORT binary_log_writer {
+public:
+  // -- constants --------------------------------------------------------------
+
+  /// Identifies the binary log format.
+  static constexpr std::string_view magic = "CAFLOG";
+
+  /// The current version of the binary log format.
+  static constexpr uint8_t version = 1;
+
+  // -- member types -----------------------------------------------------------
+
+  /// Tags for the records in the binary log format.
+  enum record_type : uint8_t {
+    string_record = 1,
+    event_record = 2,
+  };
+
+  /// Tags for the types of user-defined fields.
+  enum field_type : uint8_t {
+    null_field = 0,
+    bool_field = 1,
+    int_field = 2,
+    uint_field = 3,
+    double_field = 4,
+    string_field = 5,
+    list_field = 6,
+  };
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  /// Creates a new writer and writes the header to the buffer.
+  explicit binary_log_writer(timestamp t0);
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns the encoded bytes that have not been cleared yet.
+  const_byte_span bytes() const noexcept {
+    return buf_;
+  }
+
+  // -- modifiers --------------------------------------------------------------
+
+  /// Appends `event` to the buffer.
+  void append(const log::event& event);
+
+  /// Clears the buffer but keeps the string table.
+  void clear() noexcept {
+    buf_.clear();
+  }
+
+private:
+  void write_byte(uint8_t value);
+
+  void write_varint(uint64_t value);
+
+  void write_signed_varint(int64_t value);
+
+  void write_string(std::string_view str);
+
+  void write_fields(log::event::field_list fields);
+
+  /// Assigns IDs to all keys in `fields`. Must run before writing an event
+  /// record, because string records cannot appear within an event record.
+  void intern_keys(log::event::field_list fields);
+
+  /// Returns the ID for `str`, writing a `string_record` for new strings.
+  uint64_t string_id(std::string_view str);
+
+  /// Returns the ID for the string representation of `tid`.
+  uint64_t thread_string_id(std::thread::id tid);
+
+  timestamp t0_;
+
+  byte_buffer buf_;
+
+  /// Maps interned strings to their ID. Uses a transparent comparator to look
+  /// up strings without allocating memory.
+  std::map<std::string, uint64_t, std::less<>> strings_;
+
+  std::unordered_map<std::thread::id, uint64_t> threads_;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,212 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/binary_log_writer.hpp"
+
+#include "caf/test/test.hpp"
+
+#include "caf/log/level.hpp"
+#include "caf/logger.hpp"
+#include "caf/ref_counted.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace caf;
+using namespace std::literals;
+
+using writer = detail::binary_log_writer;
+
+namespace {
+
+// Decodes the output of a binary_log_writer.
+struct reader {
+  const_byte_span bytes;
+  size_t pos = 0;
+  std::vector<std::string> strings;
+
+  bool at_end() const {
+    return pos == bytes.size();
+  }
+
+  uint8_t byte() {
+    if (at_end())
+      CAF_RAISE_ERROR(std::logic_error, "unexpected end of input");
+    return static_cast<uint8_t>(bytes[pos++]);
+  }
+
+  uint64_t varint() {
+    uint64_t result = 0;
+    for (int shift = 0;; shift += 7) {
+      auto x = byte();
+      result |= static_cast<uint64_t>(x & 0x7f) << shift;
+      if ((x & 0x80) == 0)
+        return result;
+    }
+  }
+
+  int64_t signed_varint() {
+    auto x = varint();
+    return static_cast<int64_t>(x >> 1) ^ -static_cast<int64_t>(x & 1);
+  }
+
+  std::string str() {
+    auto len = varint();
+    std::string result;
+    for (uint64_t i = 0; i < len; ++i)
+      result += static_cast<char>(byte());
+    return result;
+  }
+
+  // Reads string records until reaching the next event record.
+  void read_strings() {
+    while (!at_end() && bytes[pos] == std::byte{writer::string_record}) {
+      ++pos;
+      auto id = varint();
+      if (id != strings.size())
+        CAF_RAISE_ERROR(std::logic_error, "unexpected string ID");
+      strings.push_back(str());
+    }
+  }
+
+  const std::string& string_ref() {
+    return strings.at(varint());
+  }
+};
+
+// A trivial logger implementation that stores the last event.
+class mock_logger : public logger, public ref_counted {
+public:
+  log::event_ptr event;
+
+  void ref_logger() const noexcept override {
+    ref();
+  }
+
+  void deref_logger() const noexcept override {
+    deref();
+  }
+
+  bool accepts(unsigned, std::string_view) override {
+    return true;
+  }
+
+private:
+  void do_log(log::event_ptr&& ptr) override {
+    event = std::move(ptr);
+  }
+
+  void init(const actor_system_config&) override {
+    // nop
+  }
+
+  void start() override {
+    // nop
+  }
+
+  void stop() override {
+    // nop
+  }
+};
+
+} // namespace
+
+TEST("the binary log format starts with a header") {
+  auto t0 = make_timestamp();
+  writer uut{t0};
+  reader src{uut.bytes()};
+  std::string magic;
+  for (size_t i = 0; i < writer::magic.size(); ++i)
+    magic += static_cast<char>(src.byte());
+  check_eq(magic, writer::magic);
+  check_eq(src.byte(), writer::version);
+  check_eq(src.byte(), 0u);
+  check_eq(src.signed_varint(), t0.time_since_epoch().count());
+  check(src.at_end());
+}
+
+TEST("the binary log format stores each string only once") {
+  auto t0 = make_timestamp();
+  writer uut{t0};
+  reader src{uut.bytes()};
+  src.pos = uut.bytes().size();
+  uut.clear();
+  auto loc = detail::source_location::current();
+  auto e1 = log::event::make(log::level::info, "foo", loc, 42, "hello");
+  auto e2 = log::event::make(log::level::debug, "foo", loc, 7, "world");
+  uut.append(*e1);
+  auto e1_size = uut.bytes().size();
+  uut.append(*e2);
+  src.bytes = uut.bytes();
+  src.pos = 0;
+  SECTION("the first event defines all strings") {
+    src.read_strings();
+    check_eq(src.strings.size(), 4u); // thread, component, file, function
+    require_eq(src.byte(), writer::event_record);
+    check_eq(src.varint(), log::level::info);
+    check_eq(src.signed_varint(), (e1->timestamp() - t0).count());
+    check_eq(src.varint(), 42u);
+    src.string_ref(); // thread ID
+    check_eq(src.string_ref(), "foo");
+    check_eq(src.string_ref(), loc.file_name());
+    check_eq(src.varint(), loc.line());
+    check_eq(src.string_ref(), loc.function_name());
+    check_eq(src.str(), "hello");
+    check_eq(src.varint(), 0u); // no fields
+    check_eq(src.pos, e1_size);
+  }
+  SECTION("the second event only refers to known strings") {
+    src.pos = e1_size;
+    require_eq(src.byte(), writer::event_record);
+    check_eq(src.varint(), log::level::debug);
+  }
+}
+
+TEST("the binary log format stores user-defined fields") {
+  auto loc = detail::source_location::current();
+  auto mlog = mock_logger{};
+  log::event_sender(&mlog, log::level::debug, "foo", loc, 0, "hello")
+    .field("i", -3)
+    .field("u", 42u)
+    .field("b", true)
+    .field("d", 2.5)
+    .field("s", "{}, {}!", "Hello", "World")
+    .field("nested", [](auto& sub) { sub.field("key", "value"); })
+    .send();
+  require_ne(mlog.event, nullptr);
+  writer uut{make_timestamp()};
+  uut.clear();
+  uut.append(*mlog.event);
+  reader src{uut.bytes()};
+  src.read_strings();
+  require_eq(src.byte(), writer::event_record);
+  src.varint();        // level
+  src.signed_varint(); // timestamp
+  for (int i = 0; i < 6; ++i)
+    src.varint(); // actor, thread, component, file, line, function
+  check_eq(src.str(), "hello");
+  require_eq(src.varint(), 6u);
+  check_eq(src.string_ref(), "i");
+  check_eq(src.byte(), writer::int_field);
+  check_eq(src.signed_varint(), -3);
+  check_eq(src.string_ref(), "u");
+  check_eq(src.byte(), writer::uint_field);
+  check_eq(src.varint(), 42u);
+  check_eq(src.string_ref(), "b");
+  check_eq(src.byte(), writer::bool_field);
+  check_eq(src.byte(), 1u);
+  check_eq(src.string_ref(), "d");
+  check_eq(src.byte(), writer::double_field);
+  src.pos += 8;
+  check_eq(src.string_ref(), "s");
+  check_eq(src.byte(), writer::string_field);
+  check_eq(src.str(), "Hello, World!");
+  check_eq(src.string_ref(), "nested");
+  check_eq(src.byte(), writer::list_field);
+  require_eq(src.varint(), 1u);
+  check_eq(src.string_ref(), "key");
+  check_eq(src.byte(), writer::string_field);
+  check_eq(src.str(), "value");
+  check(src.at_end());
+}
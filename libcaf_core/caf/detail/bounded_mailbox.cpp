@@ -0,0 +1,301 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/bounded_mailbox.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/blocking_actor.hpp"
+#include "caf/detail/sync_request_bouncer.hpp"
+#include "caf/error.hpp"
+#include "caf/local_actor.hpp"
+#include "caf/message_id.hpp"
+#include "caf/scheduled_actor.hpp"
+#include "caf/sec.hpp"
+#include "caf/telemetry/counter.hpp"
+#include "caf/telemetry/int_gauge.hpp"
+#include "caf/telemetry/metric_registry.hpp"
+
+#include <thread>
+
+namespace caf::detail {
+
+// -- bounded_mailbox ----------------------------------------------------------
+
+bounded_mailbox::bounded_mailbox(local_actor* owner, size_t capacity,
+                                 mailbox_overflow_policy policy,
+                                 telemetry::int_counter* dropped) noexcept
+  : owner_(owner),
+    capacity_(capacity),
+    policy_(policy),
+    dropped_messages_(dropped) {
+  CAF_ASSERT(capacity_ > 0);
+}
+
+intrusive::inbox_result bounded_mailbox::push_back(mailbox_element_ptr ptr) {
+  if (ptr->mid.is_urgent_message())
+    return inbox_.push_front(ptr.release());
+  if (!try_reserve() && !make_room(*ptr)) {
+    drop(std::move(ptr));
+    return intrusive::inbox_result::queue_full;
+  }
+  auto result = inbox_.push_front(ptr.release());
+  if (result == intrusive::inbox_result::queue_closed)
+    --size_;
+  return result;
+}
+
+void bounded_mailbox::push_front(mailbox_element_ptr ptr) {
+  auto guard = lock_queues();
+  if (ptr->mid.is_urgent_message()) {
+    urgent_queue_.push_front(ptr.release());
+  } else {
+    ++size_;
+    normal_queue_.push_front(ptr.release());
+  }
+}
+
+mailbox_element* bounded_mailbox::peek(message_id id) {
+  if (inbox_.closed() || inbox_.blocked()) {
+    return nullptr;
+  }
+  auto guard = lock_queues();
+  fetch_more();
+  peeked_ = nullptr;
+  if (id.is_async()) {
+    if (!urgent_queue_.empty())
+      return urgent_queue_.front();
+    if (!normal_queue_.empty())
+      peeked_ = normal_queue_.front();
+    return peeked_;
+  }
+  auto pred = [id](mailbox_element& x) { return x.mid == id; };
+  if (auto result = urgent_queue_.find_if(pred))
+    return result;
+  peeked_ = normal_queue_.find_if(pred);
+  return peeked_;
+}
+
+mailbox_element_ptr bounded_mailbox::pop_front() {
+  auto guard = lock_queues();
+  peeked_ = nullptr;
+  for (;;) {
+    if (auto result = urgent_queue_.pop_front())
+      return result;
+    if (auto result = normal_queue_.pop_front()) {
+      --size_;
+      return result;
+    }
+    if (!fetch_more())
+      return nullptr;
+  }
+}
+
+bool bounded_mailbox::closed() const noexcept {
+  return inbox_.closed();
+}
+
+bool bounded_mailbox::blocked() const noexcept {
+  return inbox_.blocked();
+}
+
+bool bounded_mailbox::try_block() {
+  auto guard = lock_queues();
+  return cached() == 0 && inbox_.try_block();
+}
+
+bool bounded_mailbox::try_unblock() {
+  return inbox_.try_unblock();
+}
+
+size_t bounded_mailbox::close(const error& reason) {
+  // Collect all pending messages first. Bouncing a request may enqueue a
+  // message to this mailbox, which must not happen while holding the lock.
+  intrusive::linked_list<mailbox_element> pending;
+  {
+    auto guard = lock_queues();
+    peeked_ = nullptr;
+    pending.splice(urgent_queue_);
+    pending.splice(normal_queue_);
+    inbox_.close([&pending](mailbox_element* ptr) { pending.push_back(ptr); });
+  }
+  size_t result = 0;
+  size_t normal_messages = 0;
+  detail::sync_request_bouncer bounce{reason};
+  pending.drain([&](mailbox_element* ptr) {
+    if (!ptr->mid.is_urgent_message())
+      ++normal_messages;
+    bounce(*ptr);
+    delete ptr;
+    ++result;
+  });
+  // Note: senders may still hold a reservation for a message that the closed
+  //       inbox rejects. Hence, we must only subtract what we have removed.
+  size_ -= normal_messages;
+  return result;
+}
+
+size_t bounded_mailbox::size() {
+  auto guard = lock_queues();
+  if (!inbox_.closed() && !inbox_.blocked())
+    fetch_more();
+  return cached();
+}
+
+size_t bounded_mailbox::approximate_size() const noexcept {
+  return size_.load(std::memory_order_relaxed);
+}
+
+bool bounded_mailbox::fetch_more() {
+  using node_type = intrusive::singly_linked<mailbox_element>;
+  auto promote = [](node_type* ptr) {
+    return static_cast<mailbox_element*>(ptr);
+  };
+  auto* head = static_cast<node_type*>(inbox_.take_head());
+  if (head == nullptr)
+    return false;
+  auto urgent_insertion_point = urgent_queue_.before_end();
+  auto normal_insertion_point = normal_queue_.before_end();
+  do {
+    auto next = head->next;
+    auto phead = promote(head);
+    if (phead->mid.is_urgent_message())
+      urgent_queue_.insert_after(urgent_insertion_point, phead);
+    else
+      normal_queue_.insert_after(normal_insertion_point, phead);
+    head = next;
+  } while (head != nullptr);
+  return true;
+}
+
+std::unique_lock<std::mutex> bounded_mailbox::lock_queues() {
+  if (policy_ == mailbox_overflow_policy::drop_oldest)
+    return std::unique_lock{mtx_};
+  return {};
+}
+
+void bounded_mailbox::drop(mailbox_element_ptr ptr) {
+  dropped_messages_->inc();
+  if (ptr->mid.is_request()) {
+    sync_request_bouncer bounce{make_error(sec::mailbox_full)};
+    bounce(*ptr);
+  } else if (policy_ == mailbox_overflow_policy::reject && ptr->sender) {
+    ptr->sender->enqueue(make_mailbox_element(nullptr, make_message_id(),
+                                              make_error(sec::mailbox_full)),
+                         nullptr);
+  }
+}
+
+bool bounded_mailbox::try_reserve() noexcept {
+  auto n = size_.load();
+  do {
+    if (n >= capacity_)
+      return false;
+  } while (!size_.compare_exchange_weak(n, n + 1));
+  return true;
+}
+
+bool bounded_mailbox::make_room(const mailbox_element& element) {
+  switch (policy_) {
+    case mailbox_overflow_policy::drop_oldest:
+      return evict_oldest();
+    case mailbox_overflow_policy::back_off:
+      return back_off(element);
+    default:
+      return false;
+  }
+}
+
+bool bounded_mailbox::evict_oldest() {
+  for (;;) {
+    mailbox_element_ptr oldest;
+    {
+      std::unique_lock guard{mtx_};
+      if (inbox_.closed()) {
+        // Let the inbox reject the message.
+        ++size_;
+        return true;
+      }
+      if (normal_queue_.empty() && !inbox_.blocked())
+        fetch_more();
+      oldest = normal_queue_.pop_front();
+      if (oldest && oldest.get() == peeked_) {
+        // The owner may still access the element it has peeked at. Hence, we
+        // keep it and drop the next message in line instead.
+        auto observed = std::move(oldest);
+        if (normal_queue_.empty() && !inbox_.blocked())
+          fetch_more();
+        oldest = normal_queue_.pop_front();
+        normal_queue_.push_front(std::move(observed));
+        // With no other message to evict, we drop the new message instead of
+        // waiting for the owner.
+        if (!oldest)
+          return false;
+      }
+    }
+    if (oldest) {
+      // The new message takes over the slot of the dropped message.
+      drop(std::move(oldest));
+      return true;
+    }
+    // All slots belong to messages that other senders are about to enqueue or
+    // that the owner is about to remove. Either way, the situation resolves
+    // itself quickly.
+    if (try_reserve())
+      return true;
+    std::this_thread::yield();
+  }
+}
+
+bool bounded_mailbox::back_off(const mailbox_element& element) {
+  // An actor waiting for itself would never wake up again.
+  if (element.sender.get() == owner_->ctrl()) {
+    ++size_;
+    return true;
+  }
+  auto deadline = std::chrono::steady_clock::now() + back_off_timeout;
+  while (!try_reserve()) {
+    if (inbox_.closed()) {
+      // Let the inbox reject the message.
+      ++size_;
+      return true;
+    }
+    if (std::chrono::steady_clock::now() >= deadline)
+      return false;
+    // Note: yielding instead of sleeping allows the OS to run other threads,
+    //       e.g., the thread of the receiver, without putting the sender to
+    //       sleep for longer than necessary.
+    std::this_thread::yield();
+  }
+  return true;
+}
+
+void bounded_mailbox::ref_mailbox() noexcept {
+  ++ref_count_;
+}
+
+void bounded_mailbox::deref_mailbox() noexcept {
+  if (--ref_count_ == 0)
+    delete this;
+}
+
+// -- bounded_mailbox_factory --------------------------------------------------
+
+bounded_mailbox_factory::bounded_mailbox_factory(actor_system& sys,
+                                                 size_t capacity,
+                                                 mailbox_overflow_policy policy)
+  : capacity_(capacity), policy_(policy) {
+  dropped_messages_ = sys.metrics().counter_singleton(
+    "caf.system", "dropped-messages",
+    "Number of messages dropped by bounded mailboxes.", "1", true);
+}
+
+abstract_mailbox* bounded_mailbox_factory::make(scheduled_actor* owner) {
+  return new bounded_mailbox(owner, capacity_, policy_, dropped_messages_);
+}
+
+abstract_mailbox* bounded_mailbox_factory::make(blocking_actor* owner) {
+  return new bounded_mailbox(owner, capacity_, policy_, dropped_messages_);
+}
+
+} // namespace caf::detail
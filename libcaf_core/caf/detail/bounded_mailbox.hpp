@@ -0,0 +1,169 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/abstract_mailbox.hpp"
+#include "caf/detail/core_export.hpp"
+#include "caf/detail/mailbox_factory.hpp"
+#include "caf/fwd.hpp"
+#include "caf/intrusive/lifo_inbox.hpp"
+#include "caf/intrusive/linked_list.hpp"
+#include "caf/mailbox_overflow_policy.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+namespace caf::detail {
+
+/// A mailbox with a maximum capacity for normal messages. Uses the same data
+/// structures as the default mailbox, but keeps track of the number of pending
+/// messages and applies an overflow policy when reaching the capacity. Urgent
+/// messages never count towards the limit.
+class CAF_CORE_EXPORT bounded_mailbox : public abstract_mailbox {
+public:
+  /// Maximum time a sender waits when using the `back_off` policy before the
+  /// mailbox drops the message. Prevents deadlocks when the sender occupies
+  /// the thread that the owner needs for processing its messages.
+  static constexpr auto back_off_timeout = std::chrono::milliseconds{10};
+
+  bounded_mailbox(local_actor* owner, size_t capacity,
+                  mailbox_overflow_policy policy,
+                  telemetry::int_counter* dropped_messages) noexcept;
+
+  bounded_mailbox(const bounded_mailbox&) = delete;
+
+  bounded_mailbox& operator=(const bounded_mailbox&) = delete;
+
+  mailbox_element* peek(message_id id) override;
+
+  intrusive::inbox_result push_back(mailbox_element_ptr ptr) override;
+
+  void push_front(mailbox_element_ptr ptr) override;
+
+  mailbox_element_ptr pop_front() override;
+
+  bool closed() const noexcept override;
+
+  bool blocked() const noexcept override;
+
+  bool try_block() override;
+
+  bool try_unblock() override;
+
+  size_t close(const error&) override;
+
+  size_t size() override;
+
+  /// Returns the number of pending normal messages. Urgent messages do not
+  /// count towards the capacity and thus are not included.
+  size_t approximate_size() const noexcept override;
+
+  void ref_mailbox() noexcept override;
+
+  void deref_mailbox() noexcept override;
+
+  size_t capacity() const noexcept {
+    return capacity_;
+  }
+
+  mailbox_overflow_policy policy() const noexcept {
+    return policy_;
+  }
+
+  size_t ref_count() const noexcept {
+    return ref_count_.load();
+  }
+
+private:
+  /// Returns the total number of elements stored in the queues.
+  size_t cached() const noexcept {
+    return urgent_queue_.size() + normal_queue_.size();
+  }
+
+  /// Tries to fetch more messages from the LIFO inbox.
+  /// @pre the caller holds the lock returned by `lock_queues()`.
+  bool fetch_more();
+
+  /// Locks the queues if senders may access them, i.e., when using the
+  /// `drop_oldest` policy. Returns an empty lock otherwise.
+  std::unique_lock<std::mutex> lock_queues();
+
+  /// Drops `ptr` and notifies the sender if necessary.
+  void drop(mailbox_element_ptr ptr);
+
+  /// Reserves a slot for a new normal message unless the mailbox is full.
+  bool try_reserve() noexcept;
+
+  /// Applies the overflow policy to make room for `element` in a full mailbox.
+  /// Returns `true` if the sender may enqueue `element`.
+  bool make_room(const mailbox_element& element);
+
+  /// Drops the oldest normal message to make room for a new one. Moves
+  /// messages from the inbox to the queues if necessary. Never drops the
+  /// message that the owner has received from its last call to `peek`.
+  bool evict_oldest();
+
+  /// Yields the CPU until the mailbox has room for another message and then
+  /// reserves a slot for it. Returns `false` if the mailbox is still full
+  /// after `back_off_timeout`.
+  bool back_off(const mailbox_element& element);
+
+  /// The actor that owns this mailbox.
+  local_actor* owner_;
+
+  /// Maximum number of pending normal messages.
+  size_t capacity_;
+
+  /// Configures how to handle new messages when reaching the capacity.
+  mailbox_overflow_policy policy_;
+
+  /// Counts dropped messages.
+  telemetry::int_counter* dropped_messages_;
+
+  /// Stores urgent messages in FIFO order.
+  intrusive::linked_list<mailbox_element> urgent_queue_;
+
+  /// Stores normal messages in FIFO order.
+  intrusive::linked_list<mailbox_element> normal_queue_;
+
+  /// Stores incoming messages in LIFO order.
+  alignas(CAF_CACHE_LINE_SIZE) intrusive::lifo_inbox<mailbox_element> inbox_;
+
+  /// Number of normal messages in the mailbox, including messages in the
+  /// inbox. Producers reserve a slot by incrementing this value before adding
+  /// a message to the inbox.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> size_ = 0;
+
+  /// Protects the queues when using the `drop_oldest` policy, because senders
+  /// remove the oldest message when the mailbox is full.
+  std::mutex mtx_;
+
+  /// Points to the normal message returned by the last call to `peek` until
+  /// the owner removes a message from the mailbox. Protected by `mtx_`.
+  mailbox_element* peeked_ = nullptr;
+
+  /// The intrusive reference count.
+  std::atomic<size_t> ref_count_ = 1;
+};
+
+/// Creates bounded mailboxes with a fixed capacity and overflow policy.
+class CAF_CORE_EXPORT bounded_mailbox_factory : public mailbox_factory {
+public:
+  bounded_mailbox_factory(actor_system& sys, size_t capacity,
+                          mailbox_overflow_policy policy);
+
+  abstract_mailbox* make(scheduled_actor* owner) override;
+
+  abstract_mailbox* make(blocking_actor* owner) override;
+
+private:
+  size_t capacity_;
+  mailbox_overflow_policy policy_;
+  telemetry::int_counter* dropped_messages_;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,314 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/bounded_mailbox.hpp"
+
+#include "caf/test/test.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/scoped_actor.hpp"
+#include "caf/sec.hpp"
+#include "caf/spawn_bounded.hpp"
+#include "caf/telemetry/metric_registry.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+using namespace std::literals;
+
+namespace {
+
+using ires = intrusive::inbox_result;
+
+template <message_priority P = message_priority::normal>
+auto make_int_msg(int value, strong_actor_ptr sender = nullptr,
+                  message_id mid = make_message_id(P)) {
+  return make_mailbox_element(std::move(sender), mid, make_message(value));
+}
+
+struct fixture {
+  fixture() : sys(cfg), self(sys) {
+    dummy = sys.spawn([] {
+      return behavior{
+        [](int) {},
+      };
+    });
+    owner = static_cast<local_actor*>(actor_cast<abstract_actor*>(dummy));
+    dropped = sys.metrics().counter_singleton(
+      "caf.system", "dropped-messages",
+      "Number of messages dropped by bounded mailboxes.", "1", true);
+  }
+
+  ~fixture() {
+    anon_send_exit(dummy, exit_reason::user_shutdown);
+  }
+
+  std::vector<int> drain(detail::bounded_mailbox& uut) {
+    std::vector<int> result;
+    for (auto ptr = uut.pop_front(); ptr != nullptr; ptr = uut.pop_front())
+      result.push_back(ptr->content().get_as<int>(0));
+    return result;
+  }
+
+  actor_system_config cfg;
+  actor_system sys;
+  scoped_actor self;
+  actor dummy;
+  local_actor* owner = nullptr;
+  telemetry::int_counter* dropped = nullptr;
+};
+
+} // namespace
+
+WITH_FIXTURE(fixture) {
+
+TEST("drop_newest drops new messages once the mailbox is full") {
+  detail::bounded_mailbox uut{owner, 2, mailbox_overflow_policy::drop_newest,
+                              dropped};
+  auto before = dropped->value();
+  check_eq(uut.push_back(make_int_msg(1)), ires::success);
+  check_eq(uut.push_back(make_int_msg(2)), ires::success);
+  check_eq(uut.push_back(make_int_msg(3)), ires::queue_full);
+  check_eq(uut.size(), 2u);
+  check_eq(dropped->value() - before, 1);
+  check_eq(drain(uut), std::vector<int>{1, 2});
+  check_eq(uut.size(), 0u);
+  check_eq(uut.push_back(make_int_msg(4)), ires::success);
+  check_eq(drain(uut), std::vector<int>{4});
+  uut.close(error{});
+}
+
+TEST("drop_oldest drops pending messages to make room for new ones") {
+  detail::bounded_mailbox uut{owner, 2, mailbox_overflow_policy::drop_oldest,
+                              dropped};
+  auto before = dropped->value();
+  check_eq(uut.push_back(make_int_msg(1)), ires::success);
+  check_eq(uut.push_back(make_int_msg(2)), ires::success);
+  check_eq(uut.push_back(make_int_msg(3)), ires::success);
+  check_eq(uut.push_back(make_int_msg(4)), ires::success);
+  check_eq(drain(uut), std::vector<int>{3, 4});
+  check_eq(dropped->value() - before, 2);
+  uut.close(error{});
+}
+
+TEST("drop_oldest bounds the mailbox without the owner fetching messages") {
+  detail::bounded_mailbox uut{owner, 10, mailbox_overflow_policy::drop_oldest,
+                              dropped};
+  auto before = dropped->value();
+  for (int i = 0; i < 100; ++i) {
+    check_eq(uut.push_back(make_int_msg(i)), ires::success);
+    check_le(uut.approximate_size(), 10u);
+  }
+  check_eq(uut.approximate_size(), 10u);
+  check_eq(dropped->value() - before, 90);
+  check_eq(drain(uut), std::vector<int>{90, 91, 92, 93, 94, 95, 96, 97, 98, 99});
+  check_eq(uut.approximate_size(), 0u);
+  uut.close(error{});
+}
+
+TEST("drop_oldest never drops the message that the owner has peeked at") {
+  detail::bounded_mailbox uut{owner, 2, mailbox_overflow_policy::drop_oldest,
+                              dropped};
+  check_eq(uut.push_back(make_int_msg(1)), ires::success);
+  check_eq(uut.push_back(make_int_msg(2)), ires::success);
+  auto* peeked = uut.peek(make_message_id());
+  if (!check(peeked != nullptr))
+    return;
+  check_eq(uut.push_back(make_int_msg(3)), ires::success);
+  check_eq(peeked->content().get_as<int>(0), 1);
+  check_eq(drain(uut), std::vector<int>{1, 3});
+  uut.close(error{});
+}
+
+TEST("drop_oldest never exceeds the capacity with concurrent senders") {
+  constexpr size_t capacity = 100;
+  constexpr int num_threads = 4;
+  detail::bounded_mailbox uut{owner, capacity,
+                              mailbox_overflow_policy::drop_oldest, dropped};
+  std::vector<std::thread> senders;
+  for (int id = 0; id < num_threads; ++id)
+    senders.emplace_back([&uut] {
+      for (int i = 0; i < 1'000; ++i)
+        uut.push_back(make_int_msg(i));
+    });
+  for (auto& sender : senders)
+    sender.join();
+  check_eq(uut.approximate_size(), capacity);
+  check_eq(drain(uut).size(), capacity);
+  uut.close(error{});
+}
+
+TEST("closing a mailbox keeps the size consistent with late senders") {
+  detail::bounded_mailbox uut{owner, 4, mailbox_overflow_policy::drop_oldest,
+                              dropped};
+  check_eq(uut.push_back(make_int_msg(1)), ires::success);
+  check_eq(uut.push_back(make_int_msg(2)), ires::success);
+  check_eq(uut.close(error{}), 2u);
+  check_eq(uut.approximate_size(), 0u);
+  check_eq(uut.push_back(make_int_msg(3)), ires::queue_closed);
+  check_eq(uut.approximate_size(), 0u);
+}
+
+TEST("urgent messages bypass the capacity") {
+  detail::bounded_mailbox uut{owner, 1, mailbox_overflow_policy::drop_newest,
+                              dropped};
+  check_eq(uut.push_back(make_int_msg(1)), ires::success);
+  check_eq(uut.push_back(make_int_msg<message_priority::high>(2)),
+           ires::success);
+  check_eq(uut.push_back(make_int_msg(3)), ires::queue_full);
+  check_eq(uut.size(), 2u);
+  check_eq(drain(uut), std::vector<int>{2, 1});
+  uut.close(error{});
+}
+
+TEST("dropped requests receive mailbox_full as response") {
+  detail::bounded_mailbox uut{owner, 1, mailbox_overflow_policy::drop_newest,
+                              dropped};
+  auto sender = actor_cast<strong_actor_ptr>(self);
+  check_eq(uut.push_back(make_int_msg(1)), ires::success);
+  check_eq(uut.push_back(make_int_msg(2, sender, make_message_id(42))),
+           ires::queue_full);
+  auto* response = self->peek_at_next_mailbox_element();
+  if (check(response != nullptr)) {
+    check(response->mid.is_response());
+    if (check(response->content().match_elements<error>()))
+      check_eq(response->content().get_as<error>(0), sec::mailbox_full);
+  }
+  uut.close(error{});
+}
+
+TEST("the reject policy notifies asynchronous senders") {
+  detail::bounded_mailbox uut{owner, 1, mailbox_overflow_policy::reject,
+                              dropped};
+  auto sender = actor_cast<strong_actor_ptr>(self);
+  check_eq(uut.push_back(make_int_msg(1)), ires::success);
+  check_eq(uut.push_back(make_int_msg(2, sender)), ires::queue_full);
+  auto* notification = self->peek_at_next_mailbox_element();
+  if (check(notification != nullptr)) {
+    check(notification->mid.is_async());
+    if (check(notification->content().match_elements<error>()))
+      check_eq(notification->content().get_as<error>(0), sec::mailbox_full);
+  }
+  uut.close(error{});
+}
+
+TEST("concurrent senders never exceed the capacity") {
+  constexpr size_t capacity = 100;
+  constexpr int num_threads = 4;
+  detail::bounded_mailbox uut{owner, capacity,
+                              mailbox_overflow_policy::drop_newest, dropped};
+  std::atomic<size_t> accepted = 0;
+  std::vector<std::thread> senders;
+  for (int id = 0; id < num_threads; ++id)
+    senders.emplace_back([&uut, &accepted] {
+      for (int i = 0; i < 1'000; ++i)
+        if (uut.push_back(make_int_msg(i)) != ires::queue_full)
+          ++accepted;
+    });
+  for (auto& sender : senders)
+    sender.join();
+  check_eq(accepted.load(), capacity);
+  check_eq(uut.approximate_size(), capacity);
+  check_eq(drain(uut).size(), capacity);
+  uut.close(error{});
+}
+
+TEST("the back_off policy blocks senders until the mailbox has room") {
+  detail::bounded_mailbox uut{owner, 1, mailbox_overflow_policy::back_off,
+                              dropped};
+  auto before = dropped->value();
+  std::atomic<bool> done = false;
+  auto producer = std::thread{[&uut, &done] {
+    for (int i = 0; i < 100; ++i)
+      uut.push_back(make_int_msg(i));
+    done = true;
+  }};
+  std::vector<int> received;
+  while (!done || uut.size() > 0) {
+    if (auto ptr = uut.pop_front())
+      received.push_back(ptr->content().get_as<int>(0));
+  }
+  producer.join();
+  // Note: the mailbox may still drop messages if the OS does not schedule the
+  //       consumer within the timeout, e.g., on a single core under load.
+  check_eq(received.size() + (dropped->value() - before), 100u);
+  check(std::is_sorted(received.begin(), received.end()));
+  uut.close(error{});
+}
+
+TEST("the back_off policy drops messages after a timeout") {
+  detail::bounded_mailbox uut{owner, 1, mailbox_overflow_policy::back_off,
+                              dropped};
+  check_eq(uut.push_back(make_int_msg(1)), ires::success);
+  auto t0 = std::chrono::steady_clock::now();
+  check_eq(uut.push_back(make_int_msg(2)), ires::queue_full);
+  check(std::chrono::steady_clock::now() - t0
+        >= detail::bounded_mailbox::back_off_timeout);
+  check_eq(drain(uut), std::vector<int>{1});
+  uut.close(error{});
+}
+
+TEST("closing a mailbox bounces pending requests") {
+  detail::bounded_mailbox uut{owner, 4, mailbox_overflow_policy::drop_newest,
+                              dropped};
+  auto sender = actor_cast<strong_actor_ptr>(self);
+  check_eq(uut.push_back(make_int_msg(1, sender, make_message_id(42))),
+           ires::success);
+  check_eq(uut.close(make_error(sec::runtime_error)), 1u);
+  check_eq(uut.size(), 0u);
+  check_eq(uut.push_back(make_int_msg(2)), ires::queue_closed);
+  check(self->peek_at_next_mailbox_element() != nullptr);
+}
+
+TEST("spawn_bounded creates actors with a bounded mailbox") {
+  auto worker = spawn_bounded(sys, 8, mailbox_overflow_policy::drop_newest,
+                              [] {
+                                return behavior{
+                                  [](int x) { return x * 2; },
+                                };
+                              });
+  auto* ptr = actor_cast<abstract_actor*>(worker);
+  auto* mbox = dynamic_cast<detail::bounded_mailbox*>(
+    &static_cast<scheduled_actor*>(ptr)->mailbox());
+  if (check(mbox != nullptr)) {
+    check_eq(mbox->capacity(), 8u);
+    check_eq(mbox->policy(), mailbox_overflow_policy::drop_newest);
+  }
+  self->mail(21).request(worker, 1s).receive(
+    [this](int x) { check_eq(x, 42); },
+    [this](const error& err) { fail("unexpected error: {}", err); });
+  anon_send_exit(worker, exit_reason::user_shutdown);
+}
+
+} // WITH_FIXTURE(fixture)
+
+TEST("a configured capacity only applies to actors that are not hidden") {
+  actor_system_config cfg;
+  cfg.set("caf.mailbox.capacity", 16);
+  actor_system sys{cfg};
+  auto get_mailbox = [](const actor& hdl) -> abstract_mailbox& {
+    auto* ptr = actor_cast<abstract_actor*>(hdl);
+    return static_cast<scheduled_actor*>(ptr)->mailbox();
+  };
+  auto fn = [] {
+    return behavior{
+      [](int) {},
+    };
+  };
+  auto visible = sys.spawn(fn);
+  auto* mbox = dynamic_cast<detail::bounded_mailbox*>(&get_mailbox(visible));
+  if (check(mbox != nullptr))
+    check_eq(mbox->capacity(), 16u);
+  auto internal = sys.spawn<hidden>(fn);
+  check(dynamic_cast<detail::bounded_mailbox*>(&get_mailbox(internal))
+        == nullptr);
+  anon_send_exit(visible, exit_reason::user_shutdown);
+  anon_send_exit(internal, exit_reason::user_shutdown);
+}
@@ -11,10 +11,17 @@
 namespace caf::detail {
 
 intrusive::inbox_result default_mailbox::push_back(mailbox_element_ptr ptr) {
-  return inbox_.push_front(ptr.release());
+  // Note: increment first to make sure the owner never decrements the counter
+  //       for a message that the counter does not include yet.
+  approximate_size_.fetch_add(1, std::memory_order_relaxed);
+  auto result = inbox_.push_front(ptr.release());
+  if (result == intrusive::inbox_result::queue_closed)
+    approximate_size_.fetch_sub(1, std::memory_order_relaxed);
+  return result;
 }
 
 void default_mailbox::push_front(mailbox_element_ptr ptr) {
+  approximate_size_.fetch_add(1, std::memory_order_relaxed);
   if (ptr->mid.is_urgent_message())
     urgent_queue_.push_front(ptr.release());
   else
@@ -41,15 +48,42 @@ mailbox_element* default_mailbox::peek(message_id id) {
 
 mailbox_element_ptr default_mailbox::pop_front() {
   for (;;) {
-    if (auto result = urgent_queue_.pop_front())
-      return result;
-    if (auto result = normal_queue_.pop_front())
+    auto result = urgent_queue_.pop_front();
+    if (!result)
+      result = normal_queue_.pop_front();
+    if (result) {
+      approximate_size_.fetch_sub(1, std::memory_order_relaxed);
       return result;
+    }
     if (!fetch_more())
       return nullptr;
   }
 }
 
+size_t
+default_mailbox::pop_front_n(intrusive::linked_list<mailbox_element>& out,
+                             size_t max_count) {
+  if (cached() < max_count)
+    fetch_more();
+  size_t result = 0;
+  auto take = [&out, &result, max_count](auto& queue) {
+    if (queue.size() <= max_count - result) {
+      // Fast path: move the entire queue at once.
+      result += queue.size();
+      out.splice(queue);
+      return;
+    }
+    while (result < max_count) {
+      out.push_back(queue.pop_front().release());
+      ++result;
+    }
+  };
+  take(urgent_queue_);
+  take(normal_queue_);
+  approximate_size_.fetch_sub(result, std::memory_order_relaxed);
+  return result;
+}
+
 bool default_mailbox::closed() const noexcept {
   return inbox_.closed();
 }
@@ -77,12 +111,18 @@ size_t default_mailbox::close(const error& reason) {
   urgent_queue_.drain(bounce_and_count);
   normal_queue_.drain(bounce_and_count);
   inbox_.close(bounce_and_count);
+  approximate_size_.fetch_sub(result, std::memory_order_relaxed);
   return result;
 }
 
 size_t default_mailbox::size() {
-  fetch_more();
-  return cached();
+  // Note: the counter includes messages in the inbox. Hence, there is no need
+  //       to move messages from the inbox to the queues here.
+  return approximate_size_.load(std::memory_order_relaxed);
+}
+
+size_t default_mailbox::approximate_size() const noexcept {
+  return approximate_size_.load(std::memory_order_relaxed);
 }
 
 bool default_mailbox::fetch_more() {
@@ -35,6 +35,9 @@ public:
 
   mailbox_element_ptr pop_front() override;
 
+  size_t pop_front_n(intrusive::linked_list<mailbox_element>& out,
+                     size_t max_count) override;
+
   bool closed() const noexcept override;
 
   bool blocked() const noexcept override;
@@ -47,6 +50,8 @@ public:
 
   size_t size() override;
 
+  size_t approximate_size() const noexcept override;
+
   void ref_mailbox() noexcept override;
 
   void deref_mailbox() noexcept override;
@@ -73,6 +78,9 @@ private:
   /// Stores incoming messages in LIFO order.
   alignas(CAF_CACHE_LINE_SIZE) intrusive::lifo_inbox<mailbox_element> inbox_;
 
+  /// Number of messages in the mailbox, including messages in the inbox.
+  std::atomic<size_t> approximate_size_ = 0;
+
   /// The intrusive reference count.
   alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> ref_count_;
 };
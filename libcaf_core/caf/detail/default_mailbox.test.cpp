@@ -77,3 +77,55 @@ TEST("calling push_front inserts messages at the beginning") {
     check_eq(results[3].get_as<int>(0), 2);
   }
 }
+
+TEST("the approximate size tracks pushed and popped messages") {
+  detail::default_mailbox uut;
+  check_eq(uut.approximate_size(), 0u);
+  check_eq(uut.push_back(make_int_msg(1)), ires::success);
+  check_eq(uut.push_back(make_int_msg<message_priority::high>(2)),
+           ires::success);
+  uut.push_front(make_int_msg(3));
+  check_eq(uut.approximate_size(), 3u);
+  check_eq(uut.approximate_size(), uut.size());
+  check_ne(uut.pop_front(), nullptr);
+  check_eq(uut.approximate_size(), 2u);
+  uut.close(error{});
+  check_eq(uut.approximate_size(), 0u);
+  check_eq(uut.push_back(make_int_msg(4)), ires::queue_closed);
+  check_eq(uut.approximate_size(), 0u);
+}
+
+TEST("pop_front_n takes up to max_count messages at once") {
+  detail::default_mailbox uut;
+  check_eq(uut.push_back(make_int_msg(1)), ires::success);
+  check_eq(uut.push_back(make_int_msg(2)), ires::success);
+  check_eq(uut.push_back(make_int_msg<message_priority::high>(3)),
+           ires::success);
+  check_eq(uut.push_back(make_int_msg(4)), ires::success);
+  intrusive::linked_list<mailbox_element> batch;
+  check_eq(uut.pop_front_n(batch, 3), 3u);
+  check_eq(uut.approximate_size(), 1u);
+  check_eq(uut.pop_front_n(batch, 10), 1u);
+  check_eq(uut.pop_front_n(batch, 10), 0u);
+  check_eq(uut.approximate_size(), 0u);
+  std::vector<int> results;
+  for (auto& x : batch)
+    results.push_back(x.content().get_as<int>(0));
+  check_eq(results, std::vector<int>{3, 1, 2, 4});
+}
+
+TEST("size counts messages without fetching them from the inbox") {
+  detail::default_mailbox uut;
+  check_eq(uut.push_back(make_int_msg(1)), ires::success);
+  check_eq(uut.push_back(make_int_msg(2)), ires::success);
+  check_eq(uut.size(), 2u);
+  check_eq(uut.size(), 2u);
+  // Messages from the inbox still arrive after messages pushed to the front.
+  uut.push_front(make_int_msg(3));
+  check_eq(uut.size(), 3u);
+  std::vector<int> results;
+  for (auto ptr = uut.pop_front(); ptr != nullptr; ptr = uut.pop_front())
+    results.push_back(ptr->content().get_as<int>(0));
+  check_eq(results, std::vector<int>{3, 1, 2});
+  check_eq(uut.size(), 0u);
+}
@@ -8,6 +8,7 @@
 
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 
 namespace caf::detail {
@@ -53,10 +54,29 @@ struct ieee_754_trait<double> {
 template <>
 struct ieee_754_trait<uint64_t> : ieee_754_trait<double> {};
 
+/// Checks whether `x` encodes a normal number, i.e., whether its exponent is
+/// neither all zeros nor all ones.
+template <class T>
+constexpr bool is_normal754(T x) noexcept {
+  using trait = ieee_754_trait<T>;
+  constexpr auto exp_mask = ((T{1} << trait::expbits) - 1)
+                            << (trait::bits - trait::expbits - 1);
+  auto exp = x & exp_mask;
+  return exp != 0 && exp != exp_mask;
+}
+
 template <class T>
 typename ieee_754_trait<T>::packed_type pack754(T f) {
   using trait = ieee_754_trait<T>;
   using result_type = typename trait::packed_type;
+  // The packed representation of normal numbers is identical to the native
+  // representation on IEEE 754 platforms.
+  if constexpr (std::numeric_limits<T>::is_iec559) {
+    result_type bits;
+    memcpy(&bits, &f, sizeof(bits));
+    if (is_normal754(bits))
+      return bits;
+  }
   // filter special cases
   if (std::isnan(f))
     return trait::packed_nan;
@@ -103,6 +123,13 @@ typename ieee_754_trait<T>::float_type unpack754(T i) {
   using signed_type = typename trait::signed_packed_type;
   using result_type = typename trait::float_type;
   using limits = std::numeric_limits<result_type>;
+  if constexpr (limits::is_iec559) {
+    if (is_normal754(i)) {
+      result_type result;
+      memcpy(&result, &i, sizeof(result));
+      return result;
+    }
+  }
   switch (i) {
     case trait::packed_pzero:
       return trait::zero;
@@ -0,0 +1,108 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/config.hpp"
+#include "caf/detail/assert.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+namespace caf::detail {
+
+/// A lock-free multi-producer, single-consumer queue for pointers. Producers
+/// push individual elements, whereas the consumer always takes all elements
+/// at once. This allows foreign threads to hand work to a single owner without
+/// acquiring a lock.
+template <class T>
+class injection_queue {
+public:
+  // -- member types -----------------------------------------------------------
+
+  using value_type = T;
+
+  using pointer = value_type*;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  injection_queue() = default;
+
+  injection_queue(const injection_queue&) = delete;
+
+  injection_queue& operator=(const injection_queue&) = delete;
+
+  ~injection_queue() {
+    auto* ptr = head_.load();
+    while (ptr != nullptr) {
+      auto* next = ptr->next;
+      delete ptr;
+      ptr = next;
+    }
+  }
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns whether the queue is empty.
+  bool empty() const noexcept {
+    return head_.load() == nullptr;
+  }
+
+  // -- producer operations ----------------------------------------------------
+
+  /// Appends `value` to the queue.
+  /// @returns `true` if the queue was empty before, `false` otherwise.
+  /// @note Safe to call from any thread.
+  bool push(pointer value) {
+    CAF_ASSERT(value != nullptr);
+    // Note: after a successful CAS, the node belongs to the consumer. Hence, we
+    //       must not access `new_head` afterwards.
+    auto* expected = head_.load();
+    auto* new_head = new node{value, expected};
+    while (!head_.compare_exchange_weak(expected, new_head)) {
+      new_head->next = expected;
+    }
+    return expected == nullptr;
+  }
+
+  // -- consumer operations ----------------------------------------------------
+
+  /// Removes all elements from the queue and calls `f` on each element in
+  /// FIFO order.
+  /// @returns the number of removed elements.
+  /// @note Only the consumer may call this function.
+  template <class F>
+  size_t drain(F&& f) {
+    auto* ptr = head_.exchange(nullptr);
+    if (ptr == nullptr)
+      return 0;
+    // Producers push to the front, i.e., the list is in LIFO order.
+    node* fifo = nullptr;
+    while (ptr != nullptr) {
+      auto* next = ptr->next;
+      ptr->next = fifo;
+      fifo = ptr;
+      ptr = next;
+    }
+    size_t result = 0;
+    while (fifo != nullptr) {
+      auto* next = fifo->next;
+      f(fifo->value);
+      delete fifo;
+      fifo = next;
+      ++result;
+    }
+    return result;
+  }
+
+private:
+  struct node {
+    pointer value;
+    node* next;
+  };
+
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<node*> head_ = nullptr;
+};
+
+} // namespace caf::detail
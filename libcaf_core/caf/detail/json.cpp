@@ -6,6 +6,7 @@
 
 #include "caf/config.hpp"
 #include "caf/detail/assert.hpp"
+#include "caf/detail/json_structural_index.hpp"
 #include "caf/detail/parser/chars.hpp"
 #include "caf/detail/parser/is_char.hpp"
 #include "caf/detail/parser/read_bool.hpp"
@@ -13,8 +14,10 @@
 #include "caf/pec.hpp"
 #include "caf/span.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <streambuf>
@@ -591,6 +594,10 @@ void init(linked_list<T>* ptr, monotonic_buffer_resource* storage) {
   new (ptr) linked_list<T>(allocator_type{storage});
 }
 
+void init(object* ptr, monotonic_buffer_resource* storage) {
+  new (ptr) object(value::object_allocator{storage});
+}
+
 void init(value* ptr, monotonic_buffer_resource*) {
   new (ptr) value();
 }
@@ -603,6 +610,299 @@ T* make_impl(monotonic_buffer_resource* storage) {
   return result;
 }
 
+// -- fast path ----------------------------------------------------------------
+
+// The fast path parses the input in two stages. The first stage locates all
+// structural characters (see `index_structurals`) and the second stage builds
+// the values by visiting only these positions. Whenever the second stage
+// encounters input that it cannot handle, it gives up and we fall back to the
+// FSM-based parser. Hence, the fast path only needs to cover valid input and
+// we get the exact same error codes and positions as before for invalid input.
+
+// Objects with at least this many members get an index for key lookups.
+constexpr size_t min_indexed_object_size = 16;
+
+bool is_whitespace(char c) noexcept {
+  switch (c) {
+    case ' ':
+    case '\f':
+    case '\n':
+    case '\r':
+    case '\t':
+    case '\v':
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool read_hex4(const char* first, uint16_t& result) noexcept {
+  result = 0;
+  for (auto i = first; i != first + 4; ++i) {
+    auto c = *i;
+    if (c >= '0' && c <= '9')
+      result = static_cast<uint16_t>(result * 16 + (c - '0'));
+    else if (c >= 'a' && c <= 'f')
+      result = static_cast<uint16_t>(result * 16 + (c - 'a' + 10));
+    else if (c >= 'A' && c <= 'F')
+      result = static_cast<uint16_t>(result * 16 + (c - 'A' + 10));
+    else
+      return false;
+  }
+  return true;
+}
+
+// Checks whether all escape sequences in the range are valid, using the same
+// rules as `read_json_string`.
+bool valid_escapes(const char* first, const char* last) noexcept {
+  auto i = first;
+  while (i != last) {
+    auto bs = static_cast<const char*>(memchr(i, '\\', last - i));
+    if (bs == nullptr)
+      return true;
+    // The index guarantees that a backslash never precedes the closing quote.
+    switch (bs[1]) {
+      case '"':
+      case '\\':
+      case '/':
+      case 'b':
+      case 'f':
+      case 'n':
+      case 'r':
+      case 't':
+      case 'v':
+        i = bs + 2;
+        break;
+      case 'u': {
+        uint16_t code_point = 0;
+        if (last - bs < 6 || !read_hex4(bs + 2, code_point))
+          return false;
+        i = bs + 6;
+        if (parser::is_leading_surrogate(code_point)) {
+          if (last - i < 6 || i[0] != '\\' || i[1] != 'u'
+              || !read_hex4(i + 2, code_point))
+            return false;
+          i += 6;
+        }
+        break;
+      }
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+template <class Char, class Unescaper>
+class fast_parser {
+public:
+  fast_parser(Char* first, Char* last, const std::vector<uint32_t>& index,
+              monotonic_buffer_resource* storage, Unescaper unescaper)
+    : first_(first),
+      last_(last),
+      cur_(first),
+      pos_(index.data()),
+      end_(index.data() + index.size()),
+      storage_(storage),
+      unescaper_(unescaper) {
+    // nop
+  }
+
+  bool run(value& result) {
+    if (!read_value(result, 0))
+      return false;
+    skip_whitespace();
+    if (cur_ != last_ || pos_ != end_)
+      return false;
+    // Only touch the input after the parse succeeded, since in-situ parsing
+    // modifies it and the fallback parser must see the original input.
+    for (auto& str : escaped_)
+      *str.target = unescaper_(storage_, str.first, str.last, true);
+    for (auto* obj : large_objects_)
+      obj->build_index();
+    return true;
+  }
+
+private:
+  struct escaped_string {
+    std::string_view* target;
+    Char* first;
+    Char* last;
+  };
+
+  void skip_whitespace() noexcept {
+    while (cur_ != last_ && is_whitespace(*cur_))
+      ++cur_;
+  }
+
+  // Checks whether the cursor points to the next structural character `ch`
+  // and consumes it if it does.
+  bool consume(char ch) noexcept {
+    skip_whitespace();
+    if (pos_ != end_ && first_ + *pos_ == cur_ && *cur_ == ch) {
+      ++cur_;
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  bool read_string(std::string_view& target) {
+    skip_whitespace();
+    if (pos_ == end_ || first_ + *pos_ != cur_ || *cur_ != '"')
+      return false;
+    // The index always contains the opening and closing quote.
+    auto first = cur_ + 1;
+    auto last = first_ + pos_[1];
+    pos_ += 2;
+    cur_ = last + 1;
+    if (memchr(first, '\\', static_cast<size_t>(last - first)) == nullptr) {
+      target = unescaper_(storage_, first, last, false);
+      return true;
+    }
+    if (!valid_escapes(first, last))
+      return false;
+    escaped_.push_back(escaped_string{&target, first, last});
+    return true;
+  }
+
+  bool read_scalar(value& x) {
+    auto first = cur_;
+    auto last = pos_ != end_ ? first_ + *pos_ : last_;
+    while (last != first && is_whitespace(last[-1]))
+      --last;
+    cur_ = last;
+    auto str = std::string_view{first, static_cast<size_t>(last - first)};
+    if (str.empty())
+      return false;
+    if (str == "true") {
+      x.data = true;
+      return true;
+    }
+    if (str == "false") {
+      x.data = false;
+      return true;
+    }
+    if (str == "null") {
+      x.data = null_t{};
+      return true;
+    }
+    if (str == "nan") {
+      x.data = std::numeric_limits<double>::quiet_NaN();
+      return true;
+    }
+    if (strchr("+-.0123456789", str.front()) == nullptr)
+      return false;
+    string_parser_state ps{str.begin(), str.end()};
+    parser::val_consumer consumer{storage_, &x};
+    parser::read_number(ps, consumer);
+    return ps.code == pec::success;
+  }
+
+  bool read_object(value& x, size_t nesting_level) {
+    if (nesting_level >= parser::max_nesting_level)
+      return false;
+    x.data = object{value::object_allocator{storage_}};
+    auto& obj = std::get<object>(x.data);
+    if (!consume('}')) {
+      do {
+        auto& kvp = obj.emplace_back();
+        if (!read_string(kvp.key) || !consume(':'))
+          return false;
+        kvp.val = make_value(storage_);
+        if (!read_value(*kvp.val, nesting_level + 1))
+          return false;
+      } while (consume(','));
+      if (!consume('}'))
+        return false;
+    }
+    if (obj.size() >= min_indexed_object_size)
+      large_objects_.push_back(&obj);
+    return true;
+  }
+
+  bool read_array(value& x, size_t nesting_level) {
+    if (nesting_level >= parser::max_nesting_level)
+      return false;
+    x.data = array{value::array_allocator{storage_}};
+    auto& arr = std::get<array>(x.data);
+    if (consume(']'))
+      return true;
+    do {
+      if (!read_value(arr.emplace_back(), nesting_level + 1))
+        return false;
+    } while (consume(','));
+    return consume(']');
+  }
+
+  bool read_value(value& x, size_t nesting_level) {
+    skip_whitespace();
+    if (cur_ == last_)
+      return false;
+    if (pos_ == end_ || first_ + *pos_ != cur_)
+      return read_scalar(x);
+    switch (*cur_) {
+      case '"':
+        x.data = std::string_view{};
+        return read_string(std::get<std::string_view>(x.data));
+      case '{':
+        ++cur_;
+        ++pos_;
+        return read_object(x, nesting_level);
+      case '[':
+        ++cur_;
+        ++pos_;
+        return read_array(x, nesting_level);
+      default:
+        return false;
+    }
+  }
+
+  Char* first_;
+  Char* last_;
+  Char* cur_;
+  const uint32_t* pos_;
+  const uint32_t* end_;
+  monotonic_buffer_resource* storage_;
+  Unescaper unescaper_;
+  std::vector<escaped_string> escaped_;
+  std::vector<object*> large_objects_;
+};
+
+template <class ParserState, class Unescaper>
+bool fast_parse(ParserState& ps, monotonic_buffer_resource* storage,
+                Unescaper unescaper, value& result) {
+  if (ps.i == ps.e)
+    return false;
+  auto* first = std::addressof(*ps.i);
+  auto size = static_cast<size_t>(ps.e - ps.i);
+  thread_local std::vector<uint32_t> index;
+  if (!index_structurals(std::string_view{first, size}, index))
+    return false;
+  fast_parser<std::remove_reference_t<decltype(*first)>, Unescaper> f{
+    first, first + size, index, storage, unescaper};
+  if (!f.run(result))
+    return false;
+  ps.i = ps.e;
+  ps.code = pec::success;
+  return true;
+}
+
+template <class ParserState, class Unescaper>
+value* parse_impl(ParserState& ps, monotonic_buffer_resource* storage,
+                  Unescaper unescaper) {
+  monotonic_buffer_resource::allocator<value> alloc{storage};
+  auto result = new (alloc.allocate(1)) value();
+  if (fast_parse(ps, storage, unescaper, *result))
+    return result;
+  // Note: the fast path may have left a partial result behind. Since the
+  //       storage is monotonic, we simply start over with a fresh value.
+  result = new (alloc.allocate(1)) value();
+  unit_t scratch_space;
+  parser::read_value(ps, scratch_space, unescaper, 0, {storage, result});
+  return result;
+}
+
 } // namespace
 
 std::string_view realloc(std::string_view str, monotonic_buffer_resource* res) {
@@ -626,6 +926,36 @@ std::string_view concat(std::initializer_list<std::string_view> xs,
   return std::string_view{buf, total_size};
 }
 
+const member* value::object::find(std::string_view key) const noexcept {
+  if (index_size_ > 0 && index_size_ == size()) {
+    auto less = [](const member* x, std::string_view y) { return x->key < y; };
+    auto last = index_ + index_size_;
+    auto i = std::lower_bound(index_, last, key, less);
+    if (i != last && (*i)->key == key)
+      return *i;
+    return nullptr;
+  }
+  for (const auto& x : *this)
+    if (x.key == key)
+      return &x;
+  return nullptr;
+}
+
+void value::object::build_index() {
+  monotonic_buffer_resource::allocator<const member*> alloc{
+    get_allocator().resource()};
+  auto* first = alloc.allocate(size());
+  auto* last = first;
+  for (const auto& x : *this)
+    *last++ = &x;
+  // Note: stable sorting makes sure that we find the first member in case of
+  //       duplicate keys, just like the linear search.
+  auto less = [](const member* x, const member* y) { return x->key < y->key; };
+  std::stable_sort(first, last, less);
+  index_ = first;
+  index_size_ = size();
+}
+
 value* make_value(monotonic_buffer_resource* storage) {
   return make_impl<value>(storage);
 }
@@ -641,12 +971,7 @@ object* make_object(monotonic_buffer_resource* storage) {
 }
 
 value* parse(string_parser_state& ps, monotonic_buffer_resource* storage) {
-  unit_t scratch_space;
-  parser::regular_unescaper unescaper;
-  monotonic_buffer_resource::allocator<value> alloc{storage};
-  auto result = new (alloc.allocate(1)) value();
-  parser::read_value(ps, scratch_space, unescaper, 0, {storage, result});
-  return result;
+  return parse_impl(ps, storage, parser::regular_unescaper{});
 }
 
 value* parse(file_parser_state& ps, monotonic_buffer_resource* storage) {
@@ -661,22 +986,12 @@ value* parse(file_parser_state& ps, monotonic_buffer_resource* storage) {
 
 value* parse_shallow(string_parser_state& ps,
                      monotonic_buffer_resource* storage) {
-  unit_t scratch_space;
-  parser::shallow_unescaper unescaper;
-  monotonic_buffer_resource::allocator<value> alloc{storage};
-  auto result = new (alloc.allocate(1)) value();
-  parser::read_value(ps, scratch_space, unescaper, 0, {storage, result});
-  return result;
+  return parse_impl(ps, storage, parser::shallow_unescaper{});
 }
 
 value* parse_in_situ(mutable_string_parser_state& ps,
                      monotonic_buffer_resource* storage) {
-  unit_t scratch_space;
-  parser::in_situ_unescaper unescaper;
-  monotonic_buffer_resource::allocator<value> alloc{storage};
-  auto result = new (alloc.allocate(1)) value();
-  parser::read_value(ps, scratch_space, unescaper, 0, {storage, result});
-  return result;
+  return parse_impl(ps, storage, parser::in_situ_unescaper{});
 }
 
 } // namespace caf::detail::json
@@ -97,7 +97,41 @@ public:
     value* val = nullptr;
   };
 
-  using object = linked_list<member>;
+  /// A list of key-value pairs. The parser additionally creates a sorted index
+  /// for large objects to speed up lookups by key.
+  class CAF_CORE_EXPORT object : public linked_list<member> {
+  public:
+    using super = linked_list<member>;
+
+    using super::super;
+
+    object() noexcept = default;
+
+    object(object&& other) : super(std::move(other)) {
+      std::swap(index_, other.index_);
+      std::swap(index_size_, other.index_size_);
+    }
+
+    object& operator=(object&& other) {
+      super::operator=(std::move(other));
+      std::swap(index_, other.index_);
+      std::swap(index_size_, other.index_size_);
+      return *this;
+    }
+
+    /// Returns the first member with given key or `nullptr` if no such member
+    /// exists. Uses the index if it covers all members and falls back to a
+    /// linear search otherwise.
+    const member* find(std::string_view key) const noexcept;
+
+    /// Creates a sorted index of all members. Adding members afterwards
+    /// invalidates the index.
+    void build_index();
+
+  private:
+    const member** index_ = nullptr;
+    size_t index_size_ = 0;
+  };
 
   using object_allocator = object::allocator_type;
 
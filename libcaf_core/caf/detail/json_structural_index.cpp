@@ -0,0 +1,283 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/json_structural_index.hpp"
+
+#include <cstring>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#  define CAF_JSON_SSE2
+#  include <emmintrin.h>
+#  if defined(__GNUC__) || defined(__clang__)
+#    define CAF_JSON_AVX2
+#    include <immintrin.h>
+#  endif
+#endif
+
+namespace caf::detail::json {
+
+namespace {
+
+// -- classifying characters ---------------------------------------------------
+
+// Bit masks for a block of 64 characters, with bit N representing the
+// character at position N.
+struct block_masks {
+  uint64_t quotes;
+  uint64_t backslashes;
+  uint64_t structurals;
+};
+
+using classify_fn = block_masks (*)(const char*) noexcept;
+
+#ifndef CAF_JSON_SSE2
+block_masks classify_scalar(const char* block) noexcept {
+  block_masks result{0, 0, 0};
+  for (size_t i = 0; i < 64; ++i) {
+    auto bit = uint64_t{1} << i;
+    switch (block[i]) {
+      case '"':
+        result.quotes |= bit;
+        break;
+      case '\\':
+        result.backslashes |= bit;
+        break;
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+        result.structurals |= bit;
+        break;
+      default:
+        break;
+    }
+  }
+  return result;
+}
+#endif
+
+// Note: setting bit 0x20 maps '[' to '{' and ']' to '}', which allows the
+//       vectorized versions to check for all brackets with two comparisons.
+
+#ifdef CAF_JSON_SSE2
+block_masks classify_sse2(const char* block) noexcept {
+  block_masks result{0, 0, 0};
+  auto quote = _mm_set1_epi8('"');
+  auto backslash = _mm_set1_epi8('\\');
+  auto lower_bit = _mm_set1_epi8(0x20);
+  auto open_brace = _mm_set1_epi8('{');
+  auto close_brace = _mm_set1_epi8('}');
+  auto colon = _mm_set1_epi8(':');
+  auto comma = _mm_set1_epi8(',');
+  for (size_t offset = 0; offset < 64; offset += 16) {
+    auto chars
+      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + offset));
+    auto lower = _mm_or_si128(chars, lower_bit);
+    auto brackets = _mm_or_si128(_mm_cmpeq_epi8(lower, open_brace),
+                                 _mm_cmpeq_epi8(lower, close_brace));
+    auto separators = _mm_or_si128(_mm_cmpeq_epi8(chars, colon),
+                                   _mm_cmpeq_epi8(chars, comma));
+    auto to_mask = [offset](__m128i x) {
+      auto bits = static_cast<uint32_t>(_mm_movemask_epi8(x));
+      return static_cast<uint64_t>(bits) << offset;
+    };
+    result.quotes |= to_mask(_mm_cmpeq_epi8(chars, quote));
+    result.backslashes |= to_mask(_mm_cmpeq_epi8(chars, backslash));
+    result.structurals |= to_mask(_mm_or_si128(brackets, separators));
+  }
+  return result;
+}
+#endif
+
+#ifdef CAF_JSON_AVX2
+// Note: lambdas do not inherit the target attribute, so we need a function.
+__attribute__((target("avx2"))) uint64_t to_mask_avx2(__m256i x,
+                                                      size_t offset) noexcept {
+  auto bits = static_cast<uint32_t>(_mm256_movemask_epi8(x));
+  return static_cast<uint64_t>(bits) << offset;
+}
+
+__attribute__((target("avx2"))) block_masks
+classify_avx2(const char* block) noexcept {
+  block_masks result{0, 0, 0};
+  auto quote = _mm256_set1_epi8('"');
+  auto backslash = _mm256_set1_epi8('\\');
+  auto lower_bit = _mm256_set1_epi8(0x20);
+  auto open_brace = _mm256_set1_epi8('{');
+  auto close_brace = _mm256_set1_epi8('}');
+  auto colon = _mm256_set1_epi8(':');
+  auto comma = _mm256_set1_epi8(',');
+  for (size_t offset = 0; offset < 64; offset += 32) {
+    auto chars
+      = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + offset));
+    auto lower = _mm256_or_si256(chars, lower_bit);
+    auto brackets = _mm256_or_si256(_mm256_cmpeq_epi8(lower, open_brace),
+                                    _mm256_cmpeq_epi8(lower, close_brace));
+    auto separators = _mm256_or_si256(_mm256_cmpeq_epi8(chars, colon),
+                                      _mm256_cmpeq_epi8(chars, comma));
+    result.quotes |= to_mask_avx2(_mm256_cmpeq_epi8(chars, quote), offset);
+    result.backslashes |= to_mask_avx2(_mm256_cmpeq_epi8(chars, backslash),
+                                       offset);
+    result.structurals |= to_mask_avx2(_mm256_or_si256(brackets, separators),
+                                       offset);
+  }
+  return result;
+}
+#endif
+
+// Picks the widest implementation that the CPU supports.
+classify_fn select_classify() noexcept {
+#ifdef CAF_JSON_AVX2
+  if (__builtin_cpu_supports("avx2"))
+    return classify_avx2;
+#endif
+#ifdef CAF_JSON_SSE2
+  return classify_sse2;
+#else
+  return classify_scalar;
+#endif
+}
+
+// -- bit manipulation ---------------------------------------------------------
+
+size_t trailing_zeros(uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_ctzll(x));
+#else
+  size_t result = 0;
+  while ((x & 1) == 0) {
+    x >>= 1;
+    ++result;
+  }
+  return result;
+#endif
+}
+
+// Computes a mask where bit N is the XOR of all bits up to and including N.
+uint64_t prefix_xor(uint64_t x) noexcept {
+  x ^= x << 1;
+  x ^= x << 2;
+  x ^= x << 4;
+  x ^= x << 8;
+  x ^= x << 16;
+  x ^= x << 32;
+  return x;
+}
+
+// -- scanning -----------------------------------------------------------------
+
+// Carries the state of the scanner from one block to the next.
+struct scanner_state {
+  // Stores whether the first character of the next block is escaped.
+  bool escape_next = false;
+
+  // Stores whether the next block starts inside of a string.
+  uint64_t in_string = 0;
+};
+
+// Computes which characters follow an unescaped backslash. Backslashes are
+// rare in practice, so we simply visit each of them.
+uint64_t escaped_chars(uint64_t backslashes, scanner_state& st) noexcept {
+  uint64_t result = 0;
+  if (st.escape_next) {
+    result = 1;
+    backslashes &= ~uint64_t{1};
+    st.escape_next = false;
+  }
+  while (backslashes != 0) {
+    auto pos = trailing_zeros(backslashes);
+    if (pos == 63) {
+      st.escape_next = true;
+      break;
+    }
+    auto next = uint64_t{1} << (pos + 1);
+    result |= next;
+    backslashes &= ~(next | (uint64_t{1} << pos));
+  }
+  return result;
+}
+
+// Scans a single block and appends the positions of all structural characters.
+void scan_block(const block_masks& masks, uint32_t base, scanner_state& st,
+                std::vector<uint32_t>& result) {
+  auto escaped = escaped_chars(masks.backslashes, st);
+  auto quotes = masks.quotes & ~escaped;
+  // The in-string mask includes opening quotes but excludes closing quotes.
+  auto in_string = prefix_xor(quotes) ^ st.in_string;
+  st.in_string = (in_string >> 63) != 0 ? ~uint64_t{0} : uint64_t{0};
+  auto bits = (masks.structurals & ~escaped & ~in_string) | quotes;
+  while (bits != 0) {
+    result.push_back(base + static_cast<uint32_t>(trailing_zeros(bits)));
+    bits &= bits - 1;
+  }
+}
+
+bool index_structurals_impl(classify_fn classify, std::string_view input,
+                            std::vector<uint32_t>& result) {
+  result.clear();
+  if (input.size() > std::numeric_limits<uint32_t>::max())
+    return false;
+  scanner_state st;
+  auto* first = input.data();
+  auto size = input.size();
+  size_t pos = 0;
+  for (; pos + 64 <= size; pos += 64)
+    scan_block(classify(first + pos), static_cast<uint32_t>(pos), st, result);
+  if (pos < size) {
+    // Pad the last block with whitespace.
+    char block[64];
+    memset(block, ' ', 64);
+    memcpy(block, first + pos, size - pos);
+    scan_block(classify(block), static_cast<uint32_t>(pos), st, result);
+  }
+  return st.in_string == 0;
+}
+
+} // namespace
+
+bool index_structurals(std::string_view input, std::vector<uint32_t>& result) {
+  static const auto classify = select_classify();
+  return index_structurals_impl(classify, input, result);
+}
+
+bool index_structurals_scalar(std::string_view input,
+                              std::vector<uint32_t>& result) {
+  result.clear();
+  if (input.size() > std::numeric_limits<uint32_t>::max())
+    return false;
+  auto in_string = false;
+  auto escape_next = false;
+  for (size_t pos = 0; pos < input.size(); ++pos) {
+    if (escape_next) {
+      escape_next = false;
+      continue;
+    }
+    switch (input[pos]) {
+      case '\\':
+        escape_next = true;
+        break;
+      case '"':
+        in_string = !in_string;
+        result.push_back(static_cast<uint32_t>(pos));
+        break;
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+        if (!in_string)
+          result.push_back(static_cast<uint32_t>(pos));
+        break;
+      default:
+        break;
+    }
+  }
+  return !in_string;
+}
+
+} // namespace caf::detail::json
@@ -0,0 +1,31 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/detail/core_export.hpp"
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace caf::detail::json {
+
+/// Scans `input` for structural characters, i.e., `{`, `}`, `[`, `]`, `:` and
+/// `,` outside of strings as well as all quotes that start or end a string, and
+/// stores their positions in ascending order to `result`. This is the first
+/// stage of the JSON parser: the second stage only needs to visit these
+/// positions instead of each individual character. Processes the input in
+/// blocks of 64 bytes, using AVX2 or SSE2 when available (selected at runtime).
+/// @returns `false` if `input` ends inside of a string or exceeds 4 GB,
+///          `true` otherwise.
+CAF_CORE_EXPORT bool index_structurals(std::string_view input,
+                                       std::vector<uint32_t>& result);
+
+/// Like `index_structurals`, but always processes the input one character at
+/// a time. Serves as reference implementation for testing.
+CAF_CORE_EXPORT bool index_structurals_scalar(std::string_view input,
+                                              std::vector<uint32_t>& result);
+
+} // namespace caf::detail::json
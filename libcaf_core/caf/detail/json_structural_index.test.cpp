@@ -0,0 +1,88 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/json_structural_index.hpp"
+
+#include "caf/test/test.hpp"
+
+#include "caf/log/test.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace caf;
+using namespace std::literals;
+
+using detail::json::index_structurals;
+using detail::json::index_structurals_scalar;
+
+namespace {
+
+using pos_vec = std::vector<uint32_t>;
+
+pos_vec positions(std::string_view input) {
+  pos_vec result;
+  if (!index_structurals(input, result))
+    test::runnable::current().fail("failed to index {}", input);
+  return result;
+}
+
+} // namespace
+
+TEST("the index contains all structural characters outside of strings") {
+  check_eq(positions(""), pos_vec{});
+  check_eq(positions("42"), pos_vec{});
+  check_eq(positions("[1, 2]"), pos_vec({0, 2, 5}));
+  check_eq(positions(R"({"a": [1]})"), pos_vec({0, 1, 3, 4, 6, 8, 9}));
+  check_eq(positions(R"("{[:,]}")"), pos_vec({0, 7}));
+}
+
+TEST("the index skips escaped quotes") {
+  check_eq(positions(R"("a\"b")"), pos_vec({0, 5}));
+  check_eq(positions(R"("a\\")"), pos_vec({0, 4}));
+  check_eq(positions(R"(["\\\"", 1])"), pos_vec({0, 1, 6, 7, 10}));
+}
+
+TEST("the index rejects unterminated strings") {
+  pos_vec result;
+  check(!index_structurals(R"("abc)", result));
+  check(!index_structurals(R"(["abc\"])", result));
+}
+
+TEST("the index handles strings and escapes across block boundaries") {
+  // Place the interesting characters around the 64-byte boundary.
+  for (size_t offset = 55; offset < 70; ++offset) {
+    auto input = std::string(offset, ' ');
+    input += R"(["a\\\"{}", {"b": "c\""}])";
+    input.append(70, ' ');
+    pos_vec fast;
+    pos_vec reference;
+    check(index_structurals(input, fast));
+    check(index_structurals_scalar(input, reference));
+    check_eq(fast, reference);
+  }
+}
+
+TEST("the index matches the scalar implementation for random inputs") {
+  std::minstd_rand rng{42};
+  auto alphabet = R"({}[]:,"\ ab1)"sv;
+  std::uniform_int_distribution<size_t> char_dist{0, alphabet.size() - 1};
+  std::uniform_int_distribution<size_t> size_dist{0, 300};
+  std::string input;
+  pos_vec fast;
+  pos_vec reference;
+  for (int round = 0; round < 1000; ++round) {
+    input.clear();
+    auto size = size_dist(rng);
+    for (size_t i = 0; i < size; ++i)
+      input += alphabet[char_dist(rng)];
+    auto fast_ok = index_structurals(input, fast);
+    auto reference_ok = index_structurals_scalar(input, reference);
+    if (!check_eq(fast_ok, reference_ok) || !check_eq(fast, reference)) {
+      log::test::error("input: {}", input);
+      return;
+    }
+  }
+}
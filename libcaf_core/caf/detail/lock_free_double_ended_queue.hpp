@@ -0,0 +1,178 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/config.hpp"
+#include "caf/detail/assert.hpp"
+#include "caf/detail/mpmc_ring_buffer.hpp"
+#include "caf/detail/work_stealing_deque.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace caf::detail {
+
+/*
+ * A drop-in replacement for `double_ended_queue` that never locks on the hot
+ * path. The owner pushes and pops at the bottom of a work-stealing deque while
+ * thieves steal from its top. Other threads hand jobs to the owner through a
+ * bounded ring buffer that the owner and thieves may take jobs from. Only when
+ * the ring buffer is full, jobs go to an overflow list that is guarded by a
+ * mutex. The mutex and condition variable are otherwise only used for putting
+ * an idle owner to sleep.
+ */
+template <class T>
+class lock_free_double_ended_queue {
+public:
+  using value_type = T;
+  using size_type = size_t;
+  using difference_type = ptrdiff_t;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using pointer = value_type*;
+  using const_pointer = const value_type*;
+
+  /// Number of calls to `try_take_head` after which the owner checks the
+  /// injected jobs before its local deque to make sure that injected jobs
+  /// cannot starve.
+  static constexpr size_t fairness_interval = 61;
+
+  /// Maximum number of injected jobs before falling back to the overflow list.
+  static constexpr size_t injection_capacity = 1024;
+
+  // -- for the owner ----------------------------------------------------------
+
+  void prepend(pointer value) {
+    CAF_ASSERT(value != nullptr);
+    local_.push(value);
+  }
+
+  pointer try_take_head() {
+    if (++ticks_ % fairness_interval == 0) {
+      if (auto* result = take_injected())
+        return result;
+    }
+    if (auto* result = local_.take())
+      return result;
+    return take_injected();
+  }
+
+  template <class Duration>
+  pointer try_take_head(Duration rel_timeout) {
+    if (auto* result = try_take_head())
+      return result;
+    if (rel_timeout <= Duration::zero())
+      return nullptr;
+    auto abs_timeout = std::chrono::steady_clock::now() + rel_timeout;
+    { // Lifetime scope of guard.
+      std::unique_lock guard{mtx_};
+      sleeping_ = true;
+      while (!has_injected()) {
+        if (cv_.wait_until(guard, abs_timeout) == std::cv_status::timeout)
+          break;
+      }
+      sleeping_ = false;
+    }
+    return take_injected();
+  }
+
+  pointer take_head() {
+    for (;;)
+      if (auto* result = try_take_head(std::chrono::hours{1}))
+        return result;
+  }
+
+  // Unsafe, since it does not wake up a currently sleeping worker.
+  void unsafe_append(pointer value) {
+    inject(value);
+  }
+
+  // -- for others -------------------------------------------------------------
+
+  void append(pointer value) {
+    // Note: `inject` and the load of `sleeping_` are sequentially consistent
+    //       and the owner sets `sleeping_` before checking for injected jobs
+    //       again. Hence, either we see the flag or the owner sees the job.
+    inject(value);
+    if (sleeping_) {
+      std::unique_lock guard{mtx_};
+      cv_.notify_one();
+    }
+  }
+
+  pointer try_take_tail() {
+    if (auto* result = local_.steal())
+      return result;
+    return take_injected();
+  }
+
+private:
+  // Adds a job from another thread (or a job of the owner that goes to the end
+  // of the queue).
+  void inject(pointer value) {
+    CAF_ASSERT(value != nullptr);
+    // Once jobs overflow, we keep adding to the overflow list until it runs
+    // empty. Otherwise, jobs in the overflow list could starve.
+    if (overflow_size_ == 0 && injected_.try_push(value))
+      return;
+    std::unique_lock guard{overflow_mtx_};
+    overflow_.push_back(value);
+    overflow_size_ = overflow_.size();
+  }
+
+  // Takes the oldest injected job. Safe to call from any thread.
+  pointer take_injected() {
+    pointer result = nullptr;
+    if (injected_.try_pop(result))
+      return result;
+    if (overflow_size_ == 0)
+      return nullptr;
+    std::unique_lock guard{overflow_mtx_};
+    // The ring buffer may have received jobs since our first attempt. These
+    // jobs are older than the jobs in the overflow list.
+    if (injected_.try_pop(result))
+      return result;
+    if (overflow_.empty())
+      return nullptr;
+    result = overflow_.front();
+    overflow_.pop_front();
+    overflow_size_ = overflow_.size();
+    return result;
+  }
+
+  // Checks whether there are any injected jobs.
+  bool has_injected() const noexcept {
+    return !injected_.empty() || overflow_size_ != 0;
+  }
+
+  // Jobs of the owner that other workers may steal.
+  work_stealing_deque<T> local_;
+
+  // Jobs from other threads.
+  mpmc_ring_buffer<pointer, injection_capacity> injected_;
+
+  // Signals whether the owner is waiting on the condition variable.
+  std::atomic<bool> sleeping_ = false;
+
+  // Counts calls to `try_take_head`. Accessed only by the owner.
+  size_t ticks_ = 0;
+
+  // Stores the size of `overflow_` for checking it without acquiring the lock.
+  std::atomic<size_t> overflow_size_ = 0;
+
+  // Jobs from other threads that did not fit into `injected_`.
+  std::deque<pointer> overflow_;
+
+  std::mutex overflow_mtx_;
+
+  std::mutex mtx_;
+  std::condition_variable cv_;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,115 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/lock_free_double_ended_queue.hpp"
+
+#include "caf/test/test.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+using namespace std::literals;
+
+using int_queue = detail::lock_free_double_ended_queue<int>;
+
+TEST("a default-constructed queue is empty") {
+  int_queue uut;
+  check_eq(uut.try_take_head(), nullptr);
+  check_eq(uut.try_take_head(1ms), nullptr);
+  check_eq(uut.try_take_tail(), nullptr);
+}
+
+TEST("the owner takes prepended elements before appended elements") {
+  int xs[] = {1, 2, 3, 4};
+  int_queue uut;
+  uut.append(&xs[0]);
+  uut.unsafe_append(&xs[1]);
+  uut.prepend(&xs[2]);
+  uut.prepend(&xs[3]);
+  check_eq(uut.try_take_head(), &xs[3]);
+  check_eq(uut.try_take_head(), &xs[2]);
+  check_eq(uut.try_take_head(), &xs[0]);
+  check_eq(uut.try_take_head(), &xs[1]);
+  check_eq(uut.try_take_head(), nullptr);
+}
+
+TEST("thieves may steal appended elements") {
+  int xs[] = {1, 2, 3};
+  int_queue uut;
+  for (auto& x : xs)
+    uut.append(&x);
+  // Thieves take appended elements in FIFO order, just like the owner.
+  check_eq(uut.try_take_tail(), &xs[0]);
+  check_eq(uut.try_take_head(), &xs[1]);
+  check_eq(uut.try_take_tail(), &xs[2]);
+  check_eq(uut.try_take_tail(), nullptr);
+}
+
+TEST("appended elements exceeding the injection capacity remain available") {
+  constexpr auto n = int_queue::injection_capacity + 100;
+  std::vector<int> xs(n);
+  int_queue uut;
+  for (auto& x : xs)
+    uut.append(&x);
+  std::vector<int*> received;
+  for (size_t i = 0; i < n; ++i) {
+    auto* ptr = i % 2 == 0 ? uut.try_take_head() : uut.try_take_tail();
+    if (ptr == nullptr)
+      break;
+    received.push_back(ptr);
+  }
+  check_eq(received.size(), n);
+  check(std::is_sorted(received.begin(), received.end()));
+  check_eq(uut.try_take_head(), nullptr);
+}
+
+TEST("thieves drain the injected jobs of a busy owner") {
+  std::vector<int> xs(10'000);
+  int_queue uut;
+  std::thread producer{[&] {
+    for (auto& x : xs)
+      uut.append(&x);
+  }};
+  std::vector<int*> stolen;
+  while (stolen.size() < xs.size())
+    if (auto* ptr = uut.try_take_tail())
+      stolen.push_back(ptr);
+  producer.join();
+  check(std::is_sorted(stolen.begin(), stolen.end()));
+}
+
+TEST("the owner does not starve appended elements") {
+  int x = 0;
+  int y = 0;
+  int_queue uut;
+  uut.append(&x);
+  auto found = false;
+  for (size_t i = 0; i < int_queue::fairness_interval && !found; ++i) {
+    uut.prepend(&y);
+    found = uut.try_take_head() == &x;
+  }
+  check(found);
+}
+
+TEST("append wakes up a sleeping owner") {
+  std::vector<int> xs(1000);
+  int_queue uut;
+  std::thread producer{[&] {
+    for (auto& x : xs) {
+      uut.append(&x);
+      if (&x == &xs[xs.size() / 2])
+        std::this_thread::sleep_for(10ms);
+    }
+  }};
+  std::vector<int*> received;
+  while (received.size() < xs.size())
+    if (auto* ptr = uut.try_take_head(1h))
+      received.push_back(ptr);
+  producer.join();
+  check(std::is_sorted(received.begin(), received.end()));
+  check_eq(received.front(), &xs.front());
+  check_eq(received.back(), &xs.back());
+}
@@ -0,0 +1,78 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/mailbox_size_collector.hpp"
+
+#include "caf/local_actor.hpp"
+#include "caf/telemetry/int_gauge.hpp"
+#include "caf/telemetry/metric_family_impl.hpp"
+
+#include <string_view>
+
+namespace caf::detail {
+
+mailbox_size_collector::mailbox_size_collector(
+  telemetry::int_gauge_family* family)
+  : family_(family) {
+  // nop
+}
+
+void mailbox_size_collector::add(local_actor* self) {
+  // Note: only the actor itself calls `add` and `remove`. Hence, the flag
+  //       needs no synchronization beyond the atomic flags of the actor.
+  self->setf(abstract_actor::reports_mailbox_size_flag);
+  auto& entry = shard_for(self);
+  std::lock_guard guard{entry.mtx};
+  self->mailbox_size_next_ = entry.head;
+  if (entry.head != nullptr)
+    entry.head->mailbox_size_prev_ = self;
+  entry.head = self;
+}
+
+void mailbox_size_collector::remove(local_actor* self) {
+  if (!self->getf(abstract_actor::reports_mailbox_size_flag))
+    return;
+  self->unsetf(abstract_actor::reports_mailbox_size_flag);
+  auto& entry = shard_for(self);
+  std::lock_guard guard{entry.mtx};
+  auto* prev = self->mailbox_size_prev_;
+  auto* next = self->mailbox_size_next_;
+  if (prev != nullptr)
+    prev->mailbox_size_next_ = next;
+  else
+    entry.head = next;
+  if (next != nullptr)
+    next->mailbox_size_prev_ = prev;
+  self->mailbox_size_prev_ = nullptr;
+  self->mailbox_size_next_ = nullptr;
+}
+
+void mailbox_size_collector::collect() {
+  std::lock_guard guard{collect_mtx_};
+  for (auto& kvp : gauges_)
+    kvp.second.sum = 0;
+  for (auto& entry : shards_) {
+    std::lock_guard shard_guard{entry.mtx};
+    for (auto* self = entry.head; self != nullptr;
+         self = self->mailbox_size_next_) {
+      std::string_view name = self->name();
+      auto i = gauges_.find(name);
+      if (i == gauges_.end()) {
+        auto* gauge = family_->get_or_add({{"name", name}});
+        i = gauges_.emplace(std::string{name}, gauge_entry{gauge, 0}).first;
+      }
+      i->second.sum += static_cast<int64_t>(self->approximate_mailbox_size());
+    }
+  }
+  // Note: names without any live actor drop back to 0.
+  for (auto& kvp : gauges_)
+    kvp.second.gauge->value(kvp.second.sum);
+}
+
+mailbox_size_collector::shard&
+mailbox_size_collector::shard_for(local_actor* self) noexcept {
+  return shards_[self->id() % num_shards];
+}
+
+} // namespace caf::detail
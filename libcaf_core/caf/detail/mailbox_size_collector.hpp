@@ -0,0 +1,87 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/config.hpp"
+#include "caf/detail/core_export.hpp"
+#include "caf/fwd.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace caf::detail {
+
+/// Updates the gauge `caf.actor.mailbox-size` whenever someone collects the
+/// metrics of an actor system. Actors register when spawning and deregister
+/// when closing their mailbox. Neither the actors nor their senders touch the
+/// gauges. Instead, `collect` sums up the mailbox sizes of all live actors per
+/// actor name. Hence, the gauge reflects growing mailboxes even if the actor
+/// never gets to run.
+///
+/// The collector links the actors into intrusive lists. Hence, adding and
+/// removing an actor never allocates memory. Each operation locks the mutex of
+/// one shard, though.
+class CAF_CORE_EXPORT mailbox_size_collector {
+public:
+  // -- constants --------------------------------------------------------------
+
+  /// Number of shards for the set of live actors.
+  static constexpr size_t num_shards = 16;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  explicit mailbox_size_collector(telemetry::int_gauge_family* family);
+
+  mailbox_size_collector(const mailbox_size_collector&) = delete;
+
+  mailbox_size_collector& operator=(const mailbox_size_collector&) = delete;
+
+  // -- modifiers --------------------------------------------------------------
+
+  /// Adds `self` to the set of actors that contribute to the gauge.
+  /// @pre `self` is not yet part of the set
+  void add(local_actor* self);
+
+  /// Removes `self` from the set of actors that contribute to the gauge. Does
+  /// nothing if `self` is not part of the set.
+  /// @post `collect` no longer accesses `self`.
+  void remove(local_actor* self);
+
+  /// Sets the gauge for each actor name to the total number of messages in the
+  /// mailboxes of all live actors with that name.
+  void collect();
+
+private:
+  /// Stores a subset of the live actors. Each shard lives on its own cache line
+  /// to avoid false sharing between the mutexes.
+  struct alignas(CAF_CACHE_LINE_SIZE) shard {
+    std::mutex mtx;
+    local_actor* head = nullptr;
+  };
+
+  /// Caches the gauge for an actor name and accumulates the mailbox sizes.
+  struct gauge_entry {
+    telemetry::int_gauge* gauge = nullptr;
+    int64_t sum = 0;
+  };
+
+  shard& shard_for(local_actor* self) noexcept;
+
+  telemetry::int_gauge_family* family_;
+
+  std::array<shard, num_shards> shards_;
+
+  /// Serializes concurrent calls to `collect`.
+  std::mutex collect_mtx_;
+
+  /// Resolves each actor name only once. Protected by `collect_mtx_`.
+  std::map<std::string, gauge_entry, std::less<>> gauges_;
+};
+
+} // namespace caf::detail
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <type_traits>
 
 namespace caf::detail::default_function {
 
@@ -82,6 +83,7 @@ meta_object make_meta_object(std::string_view type_name) {
     type_name,
     padded_size_v<T>,
     sizeof(T),
+    std::is_trivially_copyable_v<T>,
     default_function::destroy<T>,
     default_function::default_construct<T>,
     default_function::copy_construct<T>,
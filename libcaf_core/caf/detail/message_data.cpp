@@ -18,85 +18,53 @@
 
 namespace caf::detail {
 
-message_data::message_data(type_id_list types) noexcept
-  : rc_(1), types_(std::move(types)), constructed_elements_(0) {
+message_data::message_data(const message_layout& layout) noexcept
+  : rc_(1), layout_(&layout), constructed_elements_(0) {
   // nop
 }
 
 message_data::~message_data() noexcept {
   // Note: no need to perform bound checks or nullptr checks here, because
   //       we verify the type IDs while constructing the message.
+  if (layout_->trivially_copyable())
+    return;
   auto gmos = global_meta_objects();
+  auto types = layout_->types();
   auto ptr = storage();
-  if (constructed_elements_ == types_.size()) {
-    for (auto id : types_) {
-      auto& meta = gmos[id];
-      meta.destroy(ptr);
-      ptr += meta.padded_size;
-    }
-  } else {
-    for (size_t index = 0; index < constructed_elements_; ++index) {
-      auto& meta = gmos[types_[index]];
-      meta.destroy(ptr);
-      ptr += meta.padded_size;
-    }
+  for (size_t index = 0; index < constructed_elements_; ++index) {
+    auto& meta = gmos[types[index]];
+    meta.destroy(ptr);
+    ptr += meta.padded_size;
   }
 }
 
 message_data* message_data::copy() const {
   // Note: no need to perform bound checks or nullptr checks here, because
   //       we verify the type IDs while constructing the original message.
-  auto gmos = global_meta_objects();
-  size_t storage_size = 0;
-  for (auto id : types_)
-    storage_size += gmos[id].padded_size;
-  auto total_size = sizeof(message_data) + storage_size;
-  auto vptr = malloc(total_size);
-  if (vptr == nullptr)
-    CAF_RAISE_ERROR(std::bad_alloc, "bad_alloc");
-  intrusive_ptr<message_data> ptr{new (vptr) message_data(types_), false};
-  auto src = storage();
-  auto dst = ptr->storage();
-  for (auto id : types_) {
-    auto& meta = gmos[id];
-    meta.copy_construct(dst, src);
-    ++ptr->constructed_elements_;
-    src += meta.padded_size;
-    dst += meta.padded_size;
-  }
+  auto ptr = make_uninitialized(*layout_);
+  ptr->stepwise_init_from(ptr->storage(), this);
   return ptr.release();
 }
 
 intrusive_ptr<message_data>
 message_data::make_uninitialized(type_id_list types) {
-  size_t storage_size = 0;
-  for (auto id : types)
-    storage_size += global_meta_object(id).padded_size;
-  auto total_size = sizeof(message_data) + storage_size;
-  auto vptr = malloc(total_size);
-  if (vptr == nullptr)
-    CAF_RAISE_ERROR(std::bad_alloc, "bad_alloc");
-  return {new (vptr) message_data(types), false};
+  return make_uninitialized(message_layout::of(types));
 }
 
-std::byte* message_data::at(size_t index) noexcept {
-  if (index == 0)
-    return storage();
-  auto gmos = global_meta_objects();
-  auto ptr = storage();
-  for (size_t i = 0; i < index; ++i)
-    ptr += gmos[types_[i]].padded_size;
-  return ptr;
+intrusive_ptr<message_data>
+message_data::make_uninitialized(const message_layout& layout) {
+  auto total_size = sizeof(message_data) + layout.storage_size();
+  auto vptr = message_pool::allocate(total_size);
+  return {new (vptr) message_data(layout), false};
 }
 
-const std::byte* message_data::at(size_t index) const noexcept {
-  if (index == 0)
-    return storage();
-  auto gmos = global_meta_objects();
-  auto ptr = storage();
-  for (size_t i = 0; i < index; ++i)
-    ptr += gmos[types_[i]].padded_size;
-  return ptr;
+intrusive_ptr<message_data>
+message_data::try_make_uninitialized(type_id_list types) {
+  auto& layout = message_layout::of(types);
+  auto total_size = sizeof(message_data) + layout.storage_size();
+  if (auto vptr = message_pool::try_allocate(total_size))
+    return {new (vptr) message_data(layout), false};
+  return nullptr;
 }
 
 std::byte* message_data::stepwise_init_from(std::byte* pos,
@@ -108,9 +76,15 @@ std::byte* message_data::stepwise_init_from(std::byte* pos,
                                             const message_data* other) {
   CAF_ASSERT(other != nullptr);
   CAF_ASSERT(other != this);
+  auto& other_layout = other->layout();
+  if (other_layout.trivially_copyable()) {
+    memcpy(pos, other->storage(), other_layout.storage_size());
+    constructed_elements_ += other_layout.size();
+    return pos + other_layout.storage_size();
+  }
   auto gmos = global_meta_objects();
   auto src = other->storage();
-  for (auto id : other->types()) {
+  for (auto id : other_layout.types()) {
     auto& meta = gmos[id];
     meta.copy_construct(pos, src);
     ++constructed_elements_;
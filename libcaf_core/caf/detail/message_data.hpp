@@ -7,6 +7,8 @@
 #include "caf/config.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/implicit_conversions.hpp"
+#include "caf/detail/message_layout.hpp"
+#include "caf/detail/message_pool.hpp"
 #include "caf/detail/padded_size.hpp"
 #include "caf/fwd.hpp"
 #include "caf/type_id_list.hpp"
@@ -41,7 +43,9 @@ public:
   message_data& operator=(const message_data&) = delete;
 
   /// Constructs the message data object *without* constructing any element.
-  explicit message_data(type_id_list types) noexcept;
+  /// @pre the object resides in a memory block with at least
+  ///      `sizeof(message_data) + layout.storage_size()` bytes
+  explicit message_data(const message_layout& layout) noexcept;
 
   ~message_data() noexcept;
 
@@ -49,6 +53,14 @@ public:
 
   static intrusive_ptr<message_data> make_uninitialized(type_id_list types);
 
+  static intrusive_ptr<message_data>
+  make_uninitialized(const message_layout& layout);
+
+  /// Like `make_uninitialized`, but returns `nullptr` instead of throwing
+  /// when running out of memory.
+  static intrusive_ptr<message_data>
+  try_make_uninitialized(type_id_list types);
+
   // -- reference counting -----------------------------------------------------
 
   /// Increases reference count by one.
@@ -61,7 +73,7 @@ public:
   void deref() noexcept {
     if (unique() || rc_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
       this->~message_data();
-      free(const_cast<message_data*>(this));
+      message_pool::deallocate(const_cast<message_data*>(this));
     }
   }
 
@@ -87,22 +99,31 @@ public:
     return storage_;
   }
 
+  /// Returns the memory layout of the message elements.
+  const message_layout& layout() const noexcept {
+    return *layout_;
+  }
+
   /// Returns the type IDs of the message elements.
   auto types() const noexcept {
-    return types_;
+    return layout_->types();
   }
 
   /// Returns the number of elements.
   auto size() const noexcept {
-    return types_.size();
+    return layout_->size();
   }
 
   /// Returns the memory location for the object at given index.
   /// @pre `index < size()`
-  std::byte* at(size_t index) noexcept;
+  std::byte* at(size_t index) noexcept {
+    return storage_ + layout_->offset(index);
+  }
 
   /// @copydoc at
-  const std::byte* at(size_t index) const noexcept;
+  const std::byte* at(size_t index) const noexcept {
+    return storage_ + layout_->offset(index);
+  }
 
   void inc_constructed_elements() {
     ++constructed_elements_;
@@ -182,7 +203,7 @@ private:
   }
 
   mutable std::atomic<size_t> rc_;
-  type_id_list types_;
+  const message_layout* layout_;
   size_t constructed_elements_;
   std::byte storage_[];
 };
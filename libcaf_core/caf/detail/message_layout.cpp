@@ -0,0 +1,111 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/message_layout.hpp"
+
+#include "caf/detail/meta_object.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace caf::detail {
+
+namespace {
+
+/// Number of slots in the lock-free lookup table. Must be a power of two.
+constexpr size_t table_size = 4096;
+
+/// Maximum number of layouts in the lookup table. Keeping the table sparse
+/// keeps probe sequences short.
+constexpr size_t max_table_entries = table_size / 4 * 3;
+
+struct table_entry {
+  std::atomic<type_id_list::pointer> key;
+  std::atomic<const message_layout*> value;
+};
+
+/// Maps type ID lists to their layout. CAF interns all type ID lists, i.e.,
+/// the address of the list identifies it. Readers access the table without
+/// locking. Writers insert new entries while holding the mutex and never
+/// remove or modify entries.
+struct layout_table {
+  std::array<table_entry, table_size> entries = {};
+  std::mutex mtx;
+  size_t num_entries = 0;
+  /// Stores layouts that no longer fit into the lookup table.
+  std::unordered_map<type_id_list::pointer, const message_layout*> overflow;
+};
+
+// Intentionally leaked: messages may outlive the static destructors.
+layout_table& table() {
+  static auto* instance = new layout_table;
+  return *instance;
+}
+
+size_t slot_of(type_id_list::pointer key) noexcept {
+  // Fibonacci hashing on the address. The lowest bits are always zero.
+  auto h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key) >> 3);
+  return static_cast<size_t>((h * 11400714819323198485llu) >> 52)
+         & (table_size - 1);
+}
+
+// Returns the layout for `key` or `nullptr` if the table has no entry for it.
+const message_layout* find(layout_table& tbl,
+                           type_id_list::pointer key) noexcept {
+  for (auto i = slot_of(key);; i = (i + 1) & (table_size - 1)) {
+    auto& entry = tbl.entries[i];
+    auto entry_key = entry.key.load(std::memory_order_acquire);
+    if (entry_key == key)
+      return entry.value.load(std::memory_order_relaxed);
+    if (entry_key == nullptr)
+      return nullptr;
+  }
+}
+
+const message_layout& insert(layout_table& tbl, type_id_list types) {
+  auto key = types.data();
+  std::unique_lock guard{tbl.mtx};
+  if (auto* result = find(tbl, key))
+    return *result;
+  if (auto i = tbl.overflow.find(key); i != tbl.overflow.end())
+    return *i->second;
+  auto* result = new message_layout(types);
+  if (tbl.num_entries == max_table_entries) {
+    tbl.overflow.emplace(key, result);
+    return *result;
+  }
+  auto i = slot_of(key);
+  while (tbl.entries[i].key.load(std::memory_order_relaxed) != nullptr)
+    i = (i + 1) & (table_size - 1);
+  // Publish the value before the key: readers check the key first.
+  tbl.entries[i].value.store(result, std::memory_order_relaxed);
+  tbl.entries[i].key.store(key, std::memory_order_release);
+  ++tbl.num_entries;
+  return *result;
+}
+
+} // namespace
+
+message_layout::message_layout(type_id_list types)
+  : types_(types), offsets_(new size_t[types.size()]) {
+  auto gmos = global_meta_objects();
+  for (size_t index = 0; index < types.size(); ++index) {
+    auto& meta = gmos[types[index]];
+    offsets_[index] = storage_size_;
+    storage_size_ += meta.padded_size;
+    trivially_copyable_ = trivially_copyable_ && meta.trivially_copyable;
+  }
+}
+
+const message_layout& message_layout::of(type_id_list types) {
+  auto& tbl = table();
+  if (auto* result = find(tbl, types.data()))
+    return *result;
+  return insert(tbl, types);
+}
+
+} // namespace caf::detail
@@ -0,0 +1,83 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/detail/core_export.hpp"
+#include "caf/type_id_list.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace caf::detail {
+
+/// Describes how a `message_data` object arranges its elements in memory. CAF
+/// computes the layout only once per type ID list and then shares the result
+/// between all messages with the same element types.
+class CAF_CORE_EXPORT message_layout {
+public:
+  // -- constructors, destructors, and assignment operators --------------------
+
+  /// Computes the layout for `types` from the global meta objects.
+  /// @pre all type IDs in `types` have a meta object
+  explicit message_layout(type_id_list types);
+
+  message_layout(const message_layout&) = delete;
+
+  message_layout& operator=(const message_layout&) = delete;
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns the type IDs of the message elements.
+  type_id_list types() const noexcept {
+    return types_;
+  }
+
+  /// Returns the number of elements.
+  size_t size() const noexcept {
+    return types_.size();
+  }
+
+  /// Returns the number of bytes for storing all elements.
+  size_t storage_size() const noexcept {
+    return storage_size_;
+  }
+
+  /// Returns the offset of the element at `index`.
+  /// @pre `index < size()`
+  size_t offset(size_t index) const noexcept {
+    return offsets_[index];
+  }
+
+  /// Returns whether all elements are trivially copyable. In this case, copying
+  /// the storage with `memcpy` is equivalent to copying each element and
+  /// elements require no destructor call.
+  bool trivially_copyable() const noexcept {
+    return trivially_copyable_;
+  }
+
+  // -- factories --------------------------------------------------------------
+
+  /// Returns the layout for `types`. Computes the layout on first use and
+  /// returns the cached result afterwards.
+  /// @pre all type IDs in `types` have a meta object
+  /// @pre `types` is interned, i.e., either created by `make_type_id_list` or
+  ///      by a `type_id_list_builder`
+  static const message_layout& of(type_id_list types);
+
+  /// Returns the layout for the types `Ts`.
+  template <class... Ts>
+  static const message_layout& of() {
+    static const message_layout& result = of(make_type_id_list<Ts...>());
+    return result;
+  }
+
+private:
+  type_id_list types_;
+  size_t storage_size_ = 0;
+  bool trivially_copyable_ = true;
+  std::unique_ptr<size_t[]> offsets_;
+};
+
+} // namespace caf::detail
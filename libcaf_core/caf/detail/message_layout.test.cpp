@@ -0,0 +1,100 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/message_layout.hpp"
+
+#include "caf/test/test.hpp"
+
+#include "caf/detail/padded_size.hpp"
+#include "caf/detail/type_id_list_builder.hpp"
+#include "caf/message.hpp"
+#include "caf/message_builder.hpp"
+#include "caf/type_id.hpp"
+
+#include <string>
+
+using namespace caf;
+using namespace std::literals;
+
+using detail::message_layout;
+using detail::padded_size_v;
+
+TEST("layouts store the offset of each element") {
+  auto& uut = message_layout::of<int32_t, std::string, double>();
+  check_eq(uut.types(), make_type_id_list<int32_t, std::string, double>());
+  check_eq(uut.size(), 3u);
+  check_eq(uut.offset(0), 0u);
+  check_eq(uut.offset(1), padded_size_v<int32_t>);
+  check_eq(uut.offset(2), padded_size_v<int32_t> + padded_size_v<std::string>);
+  check_eq(uut.storage_size(), padded_size_v<int32_t>
+                                 + padded_size_v<std::string>
+                                 + padded_size_v<double>);
+}
+
+TEST("layouts know whether all elements are trivially copyable") {
+  check(message_layout::of<int32_t, double>().trivially_copyable());
+  check(!message_layout::of<int32_t, std::string>().trivially_copyable());
+  check(message_layout::of<>().trivially_copyable());
+}
+
+TEST("each type ID list has exactly one layout") {
+  auto types = make_type_id_list<int32_t, double>();
+  check_eq(&message_layout::of(types), &message_layout::of(types));
+  check_eq(&message_layout::of<int32_t, double>(), &message_layout::of(types));
+  detail::type_id_list_builder builder;
+  builder.push_back(type_id_v<int32_t>);
+  builder.push_back(type_id_v<double>);
+  auto dyn_types = builder.copy_to_list();
+  check_eq(&message_layout::of(dyn_types),
+           &message_layout::of(builder.copy_to_list()));
+  check_eq(message_layout::of(dyn_types).storage_size(),
+           message_layout::of(types).storage_size());
+}
+
+TEST("messages use the layout of their element types") {
+  auto msg = make_message(int32_t{1}, "two"s, int64_t{3}, int32_t{4});
+  auto& layout = msg.cdata().layout();
+  check_eq(layout.types(), msg.types());
+  auto* base = msg.cdata().storage();
+  for (size_t index = 0; index < msg.size(); ++index)
+    check_eq(msg.cdata().at(index), base + layout.offset(index));
+  check_eq(msg.get_as<std::string>(1), "two");
+  check_eq(msg.get_as<int64_t>(2), int64_t{3});
+  check_eq(msg.get_as<int32_t>(3), 4);
+}
+
+TEST("copying messages preserves all elements") {
+  SECTION("trivially copyable elements") {
+    auto msg1 = make_message(int32_t{1}, int16_t{2}, int64_t{3});
+    auto msg2 = msg1;
+    msg2.get_mutable_as<int32_t>(0) = 10;
+    check_eq(msg1.get_as<int32_t>(0), 1);
+    check_eq(msg2.get_as<int32_t>(0), 10);
+    check_eq(msg2.get_as<int16_t>(1), int16_t{2});
+    check_eq(msg2.get_as<int64_t>(2), int64_t{3});
+  }
+  SECTION("non-trivial elements") {
+    auto msg1 = make_message(int32_t{1}, "two"s, "three"s);
+    auto msg2 = msg1;
+    msg2.get_mutable_as<std::string>(1) = "zwei";
+    check_eq(msg1.get_as<std::string>(1), "two");
+    check_eq(msg2.get_as<std::string>(1), "zwei");
+    check_eq(msg2.get_as<std::string>(2), "three");
+  }
+}
+
+TEST("message builders use the layout of their element types") {
+  auto src = make_message(int32_t{1}, "two"s, int64_t{3});
+  message_builder builder;
+  builder.append_from(src, 1, 2);
+  builder.append(int32_t{4});
+  auto msg = builder.to_message();
+  check_eq(msg.types(), make_type_id_list<std::string, int64_t, int32_t>());
+  check_eq(msg.cdata().layout().storage_size(), padded_size_v<std::string>
+                                                  + padded_size_v<int64_t>
+                                                  + padded_size_v<int32_t>);
+  check_eq(msg.get_as<std::string>(0), "two");
+  check_eq(msg.get_as<int64_t>(1), int64_t{3});
+  check_eq(msg.get_as<int32_t>(2), 4);
+}
@@ -0,0 +1,282 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/message_pool.hpp"
+
+#include "caf/config.hpp"
+#include "caf/raise_error.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace caf::detail {
+
+namespace {
+
+struct thread_cache;
+
+/// Precedes the payload of each block. Padded to keep the payload aligned.
+struct alignas(alignof(std::max_align_t)) block_header {
+  thread_cache* owner;
+  size_t size_class;
+};
+
+/// Overlays the payload of free blocks.
+struct free_block {
+  free_block* next;
+};
+
+/// Marks blocks that bypass the pool.
+constexpr size_t unpooled = message_pool::num_size_classes;
+
+/// Number of allocations between two updates of the counters.
+constexpr size_t flush_interval = 64;
+
+struct thread_cache {
+  struct bucket {
+    free_block* head = nullptr;
+    size_t size = 0;
+  };
+
+  /// Free blocks of this cache. Accessed only by the owning thread.
+  std::array<bucket, message_pool::num_size_classes> local;
+
+  /// Counts hits since the last flush. Accessed only by the owning thread.
+  int64_t hits = 0;
+
+  /// Counts misses since the last flush. Accessed only by the owning thread.
+  int64_t misses = 0;
+
+  /// Counts allocations since the last flush.
+  size_t pending = 0;
+
+  /// Blocks released by other threads. The owner takes all blocks at once
+  /// whenever its local list for a size class runs empty.
+  alignas(CAF_CACHE_LINE_SIZE)
+    std::array<std::atomic<free_block*>, message_pool::num_size_classes> remote
+    = {};
+};
+
+struct global_state {
+  std::mutex mtx;
+  std::vector<thread_cache*> idle_caches;
+};
+
+/// Counts the calls to `enable` minus the calls to `disable`.
+std::atomic<size_t> enable_count;
+
+std::atomic<int64_t> total_hits;
+
+std::atomic<int64_t> total_misses;
+
+std::atomic<size_t> max_cached = message_pool::default_max_cached_blocks;
+
+// Intentionally leaked: threads may still release blocks while the process
+// runs its static destructors.
+global_state& globals() {
+  static auto* instance = new global_state;
+  return *instance;
+}
+
+// Trivially destructible to remain accessible during thread shutdown.
+thread_local thread_cache* current_cache;
+
+thread_local bool cache_retired;
+
+void* make_block(thread_cache* owner, size_t size_class, size_t size) noexcept {
+  auto* vptr = malloc(size);
+  if (vptr == nullptr)
+    return nullptr;
+  auto* hdr = new (vptr) block_header{owner, size_class};
+  return hdr + 1;
+}
+
+void free_block_list(free_block* ptr) noexcept {
+  while (ptr != nullptr) {
+    auto* next = ptr->next;
+    free(reinterpret_cast<block_header*>(ptr) - 1);
+    ptr = next;
+  }
+}
+
+void flush(thread_cache* cache) noexcept {
+  if (cache->hits != 0)
+    total_hits.fetch_add(cache->hits, std::memory_order_relaxed);
+  if (cache->misses != 0)
+    total_misses.fetch_add(cache->misses, std::memory_order_relaxed);
+  cache->hits = 0;
+  cache->misses = 0;
+  cache->pending = 0;
+}
+
+// Returns the cache of this thread to the pool of idle caches. Blocks on the
+// remote lists stay there until another thread adopts the cache.
+void retire() noexcept {
+  auto* cache = current_cache;
+  if (cache == nullptr)
+    return;
+  flush(cache);
+  for (auto& bucket : cache->local) {
+    free_block_list(bucket.head);
+    bucket.head = nullptr;
+    bucket.size = 0;
+  }
+  current_cache = nullptr;
+  cache_retired = true;
+  auto& st = globals();
+  std::unique_lock guard{st.mtx};
+  st.idle_caches.push_back(cache);
+}
+
+struct cache_guard {
+  ~cache_guard() {
+    retire();
+  }
+};
+
+thread_cache* acquire() noexcept {
+  if (current_cache != nullptr)
+    return current_cache;
+  // Threads that already retired their cache fall back to malloc.
+  if (cache_retired)
+    return nullptr;
+  static thread_local cache_guard retire_on_exit;
+  auto& st = globals();
+  std::unique_lock guard{st.mtx};
+  if (st.idle_caches.empty()) {
+    current_cache = new (std::nothrow) thread_cache;
+  } else {
+    current_cache = st.idle_caches.back();
+    st.idle_caches.pop_back();
+  }
+  return current_cache;
+}
+
+// Moves the blocks that other threads released to the local list.
+void reclaim(thread_cache* cache, size_t size_class) noexcept {
+  auto* head = cache->remote[size_class].exchange(nullptr,
+                                                  std::memory_order_acquire);
+  if (head == nullptr)
+    return;
+  auto& bucket = cache->local[size_class];
+  auto limit = max_cached.load(std::memory_order_relaxed);
+  while (head != nullptr && bucket.size < limit) {
+    auto* next = head->next;
+    head->next = bucket.head;
+    bucket.head = head;
+    ++bucket.size;
+    head = next;
+  }
+  free_block_list(head);
+}
+
+} // namespace
+
+// -- allocation ---------------------------------------------------------------
+
+void* message_pool::allocate(size_t size) {
+  auto* result = try_allocate(size);
+  if (result == nullptr)
+    CAF_RAISE_ERROR(std::bad_alloc, "bad_alloc");
+  return result;
+}
+
+void* message_pool::try_allocate(size_t size) noexcept {
+  auto total = size + sizeof(block_header);
+  if (total <= max_block_size
+      && enable_count.load(std::memory_order_relaxed) > 0) {
+    if (auto* cache = acquire()) {
+      auto size_class = (total - 1) / granularity;
+      auto& bucket = cache->local[size_class];
+      if (bucket.head == nullptr)
+        reclaim(cache, size_class);
+      void* result;
+      if (auto* blk = bucket.head) {
+        bucket.head = blk->next;
+        --bucket.size;
+        ++cache->hits;
+        result = blk;
+      } else {
+        result = make_block(cache, size_class, (size_class + 1) * granularity);
+        if (result == nullptr)
+          return nullptr;
+        ++cache->misses;
+      }
+      if (++cache->pending == flush_interval)
+        flush(cache);
+      return result;
+    }
+  }
+  return make_block(nullptr, unpooled, total);
+}
+
+void message_pool::deallocate(void* ptr) noexcept {
+  if (ptr == nullptr)
+    return;
+  auto* hdr = static_cast<block_header*>(ptr) - 1;
+  auto size_class = hdr->size_class;
+  if (size_class == unpooled) {
+    free(hdr);
+    return;
+  }
+  auto* blk = new (ptr) free_block{nullptr};
+  auto* owner = hdr->owner;
+  if (owner == current_cache) {
+    auto& bucket = owner->local[size_class];
+    if (bucket.size < max_cached.load(std::memory_order_relaxed)) {
+      blk->next = bucket.head;
+      bucket.head = blk;
+      ++bucket.size;
+    } else {
+      free(hdr);
+    }
+    return;
+  }
+  auto& head = owner->remote[size_class];
+  blk->next = head.load(std::memory_order_relaxed);
+  while (!head.compare_exchange_weak(blk->next, blk, std::memory_order_release,
+                                     std::memory_order_relaxed)) {
+    // Try again.
+  }
+}
+
+// -- configuration ------------------------------------------------------------
+
+void message_pool::enable() noexcept {
+  enable_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void message_pool::disable() noexcept {
+  enable_count.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool message_pool::enabled() noexcept {
+  return enable_count.load(std::memory_order_relaxed) > 0;
+}
+
+void message_pool::max_cached_blocks(size_t value) noexcept {
+  max_cached = value;
+}
+
+// -- metrics ------------------------------------------------------------------
+
+int64_t message_pool::hits() noexcept {
+  return total_hits.load(std::memory_order_relaxed);
+}
+
+int64_t message_pool::misses() noexcept {
+  return total_misses.load(std::memory_order_relaxed);
+}
+
+void message_pool::flush_metrics() noexcept {
+  if (auto* cache = current_cache)
+    flush(cache);
+}
+
+} // namespace caf::detail
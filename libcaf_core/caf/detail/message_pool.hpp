@@ -0,0 +1,87 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/detail/core_export.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace caf::detail {
+
+/// A size-class pool allocator for the two objects that CAF allocates for each
+/// message: the `mailbox_element` and the `message_data`. Each thread has its
+/// own cache with one free list per size class. Memory blocks remember the
+/// cache that allocated them. Hence, releasing a block on another thread puts
+/// it on a lock-free list of its original cache, where the owner picks it up
+/// again on its next cache miss. This avoids contention in `malloc` for the
+/// common case of allocating a message on one thread and destroying it on
+/// another.
+///
+/// The pool is disabled by default and serves all requests from `malloc` in
+/// this case. Every block carries a header, regardless of where its memory
+/// comes from. Hence, users may enable and disable the pool at any time and
+/// release blocks regardless of the state of the pool at allocation time.
+class CAF_CORE_EXPORT message_pool {
+public:
+  // -- constants --------------------------------------------------------------
+
+  /// Block sizes are multiples of this value.
+  static constexpr size_t granularity = 32;
+
+  /// Number of size classes. Larger requests bypass the pool.
+  static constexpr size_t num_size_classes = 16;
+
+  /// Largest block size (including the block header) served by the pool.
+  static constexpr size_t max_block_size = granularity * num_size_classes;
+
+  /// Default for the maximum number of free blocks per size class and thread.
+  static constexpr size_t default_max_cached_blocks = 1024;
+
+  // -- allocation -------------------------------------------------------------
+
+  /// Allocates `size` bytes with an alignment suitable for any scalar type.
+  /// @throws std::bad_alloc if no memory is available.
+  static void* allocate(size_t size);
+
+  /// Allocates `size` bytes with an alignment suitable for any scalar type.
+  /// @returns `nullptr` if no memory is available.
+  static void* try_allocate(size_t size) noexcept;
+
+  /// Releases memory that was previously obtained from `allocate`.
+  static void deallocate(void* ptr) noexcept;
+
+  // -- configuration ----------------------------------------------------------
+
+  /// Enables the pool for all threads in this process until a matching call to
+  /// `disable`. Each actor system that uses the pool calls this function once
+  /// at startup and `disable` once at shutdown.
+  static void enable() noexcept;
+
+  /// Reverts a previous call to `enable`. The pool remains enabled as long as
+  /// there are more calls to `enable` than to `disable`.
+  static void disable() noexcept;
+
+  /// Returns whether the pool is enabled.
+  static bool enabled() noexcept;
+
+  /// Sets the maximum number of free blocks each thread caches per size class.
+  static void max_cached_blocks(size_t value) noexcept;
+
+  // -- metrics ----------------------------------------------------------------
+
+  /// Returns the number of allocations that the pool served from previously
+  /// released blocks. Threads report their counts in batches.
+  static int64_t hits() noexcept;
+
+  /// Returns the number of allocations that required new memory from the
+  /// system. Threads report their counts in batches.
+  static int64_t misses() noexcept;
+
+  /// Reports all pending counts of the calling thread.
+  static void flush_metrics() noexcept;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,154 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/message_pool.hpp"
+
+#include "caf/test/test.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/mailbox_element.hpp"
+#include "caf/message.hpp"
+#include "caf/telemetry/metric_registry.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+
+namespace {
+
+using detail::message_pool;
+
+struct fixture {
+  fixture() {
+    message_pool::enable();
+  }
+
+  ~fixture() {
+    message_pool::disable();
+  }
+};
+
+bool is_aligned(void* ptr) {
+  return reinterpret_cast<uintptr_t>(ptr) % alignof(std::max_align_t) == 0;
+}
+
+} // namespace
+
+WITH_FIXTURE(fixture) {
+
+TEST("the pool recycles released blocks on the same thread") {
+  auto* ptr1 = message_pool::allocate(40);
+  check(is_aligned(ptr1));
+  memset(ptr1, 0xFF, 40);
+  message_pool::deallocate(ptr1);
+  auto* ptr2 = message_pool::allocate(40);
+  check_eq(ptr1, ptr2);
+  message_pool::deallocate(ptr2);
+}
+
+TEST("blocks of different size classes never mix") {
+  auto* small = message_pool::allocate(16);
+  message_pool::deallocate(small);
+  auto* large = message_pool::allocate(200);
+  check(is_aligned(large));
+  check_ne(small, large);
+  memset(large, 0xFF, 200);
+  message_pool::deallocate(large);
+}
+
+TEST("blocks released on another thread return to their owner") {
+  std::vector<void*> blocks;
+  for (int i = 0; i < 10; ++i)
+    blocks.push_back(message_pool::allocate(64));
+  std::thread{[blocks] {
+    for (auto* ptr : blocks)
+      message_pool::deallocate(ptr);
+  }}.join();
+  std::vector<void*> reused;
+  for (int i = 0; i < 10; ++i)
+    reused.push_back(message_pool::allocate(64));
+  std::sort(blocks.begin(), blocks.end());
+  std::sort(reused.begin(), reused.end());
+  check_eq(blocks, reused);
+  for (auto* ptr : reused)
+    message_pool::deallocate(ptr);
+}
+
+TEST("large requests bypass the pool") {
+  auto size = message_pool::max_block_size * 2;
+  auto* ptr = message_pool::allocate(size);
+  check(is_aligned(ptr));
+  memset(ptr, 0xFF, size);
+  message_pool::deallocate(ptr);
+}
+
+TEST("the pool stays enabled until each enable has a matching disable") {
+  check(message_pool::enabled());
+  message_pool::enable();
+  message_pool::disable();
+  check(message_pool::enabled());
+  message_pool::disable();
+  check(!message_pool::enabled());
+  message_pool::enable();
+  check(message_pool::enabled());
+}
+
+TEST("blocks outlive changes to the state of the pool") {
+  auto* pooled = message_pool::allocate(40);
+  message_pool::disable();
+  auto* unpooled = message_pool::allocate(40);
+  check(is_aligned(unpooled));
+  check_ne(pooled, unpooled);
+  message_pool::deallocate(pooled);
+  message_pool::enable();
+  message_pool::deallocate(unpooled);
+}
+
+TEST("allocating blocks without the exception-throwing interface") {
+  auto* ptr = message_pool::try_allocate(48);
+  check(ptr != nullptr);
+  check(is_aligned(ptr));
+  message_pool::deallocate(ptr);
+}
+
+TEST("messages and mailbox elements use the pool") {
+  auto msg = make_message(1, 2, 3);
+  auto* data = msg.cptr();
+  auto elem = make_mailbox_element(nullptr, make_message_id(), msg);
+  auto* elem_addr = static_cast<void*>(elem.get());
+  elem = nullptr;
+  msg = message{};
+  auto msg2 = make_message(4, 5, 6);
+  check_eq(static_cast<const void*>(msg2.cptr()),
+           static_cast<const void*>(data));
+  auto elem2 = make_mailbox_element(nullptr, make_message_id(), msg2);
+  check_eq(static_cast<void*>(elem2.get()), elem_addr);
+  check_eq(msg2.get_as<int>(2), 6);
+}
+
+TEST("actor systems report hits and misses of the pool") {
+  actor_system_config cfg;
+  cfg.set("caf.message-pool.enabled", true);
+  actor_system sys{cfg};
+  check(message_pool::enabled());
+  for (int i = 0; i < 10; ++i) {
+    auto msg = make_message(i);
+    check_eq(msg.get_as<int>(0), i);
+  }
+  message_pool::flush_metrics();
+  check_ge(message_pool::hits(), 9);
+  auto* hits = sys.metrics().counter_singleton("caf.system",
+                                               "message-pool-hits", "", "1",
+                                               true);
+  auto ignore = [](auto&&...) {};
+  sys.metrics().collect(ignore);
+  check_ge(hits->value(), 9);
+}
+
+} // WITH_FIXTURE(fixture)
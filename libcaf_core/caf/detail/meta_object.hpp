@@ -27,6 +27,10 @@ struct meta_object {
   /// Stores the result of `sizeof` for the type.
   size_t simple_size;
 
+  /// Stores whether the type is trivially copyable, i.e., whether `memcpy`
+  /// may replace `copy_construct` and `destroy` is a no-op.
+  bool trivially_copyable;
+
   /// Calls the destructor for given object.
   void (*destroy)(void*) noexcept;
 
@@ -0,0 +1,104 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/config.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace caf::detail {
+
+// A lock-free ring buffer backed by an array for any number of producers and
+// consumers that can hold a maximum of `Size` elements. Each slot carries a
+// sequence number that tells producers and consumers whether the slot is
+// ready for writing or reading in the current round.
+template <class T, size_t Size>
+class mpmc_ring_buffer {
+public:
+  static_assert(Size > 0 && (Size & (Size - 1)) == 0,
+                "Size must be a power of two");
+
+  mpmc_ring_buffer() {
+    for (size_t index = 0; index < Size; ++index)
+      slots_[index].seq.store(index, std::memory_order_relaxed);
+  }
+
+  mpmc_ring_buffer(const mpmc_ring_buffer&) = delete;
+
+  mpmc_ring_buffer& operator=(const mpmc_ring_buffer&) = delete;
+
+  /// Enqueues `value` at the end of the queue unless the queue is full.
+  /// @returns `true` if the queue took ownership of `value`, `false` otherwise.
+  bool try_push(T value) {
+    auto wr_pos = wr_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      auto& slot = slots_[wr_pos % Size];
+      auto seq = slot.seq.load(std::memory_order_acquire);
+      auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(wr_pos);
+      if (diff == 0) {
+        if (wr_pos_.compare_exchange_weak(wr_pos, wr_pos + 1)) {
+          slot.value = std::move(value);
+          slot.seq.store(wr_pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        wr_pos = wr_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// Dequeues the next element from the queue unless the queue is empty.
+  /// @returns `true` if `result` now holds the dequeued element, `false`
+  ///          otherwise.
+  bool try_pop(T& result) {
+    auto rd_pos = rd_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      auto& slot = slots_[rd_pos % Size];
+      auto seq = slot.seq.load(std::memory_order_acquire);
+      auto diff = static_cast<intptr_t>(seq)
+                  - static_cast<intptr_t>(rd_pos + 1);
+      if (diff == 0) {
+        if (rd_pos_.compare_exchange_weak(rd_pos, rd_pos + 1)) {
+          result = std::move(slot.value);
+          slot.seq.store(rd_pos + Size, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        rd_pos = rd_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// Checks whether the queue currently has no elements. Elements that a
+  /// producer is still writing count as present.
+  bool empty() const noexcept {
+    return rd_pos_.load() == wr_pos_.load();
+  }
+
+private:
+  struct slot_type {
+    std::atomic<size_t> seq;
+    T value;
+  };
+
+  // Stores the number of claimed slots for writing.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> wr_pos_ = 0;
+
+  // Stores the number of claimed slots for reading.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> rd_pos_ = 0;
+
+  // Stores elements in a circular buffer.
+  alignas(CAF_CACHE_LINE_SIZE) std::array<slot_type, Size> slots_;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,90 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/mpmc_ring_buffer.hpp"
+
+#include "caf/test/test.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+using namespace std::literals;
+
+namespace {
+
+using string_queue = detail::mpmc_ring_buffer<std::string, 4>;
+
+} // namespace
+
+TEST("a default-constructed ring buffer is empty") {
+  string_queue queue;
+  std::string str;
+  check(queue.empty());
+  check(!queue.try_pop(str));
+}
+
+TEST("try_push fails if the ring buffer is full") {
+  string_queue queue;
+  for (auto str : {"a"s, "b"s, "c"s, "d"s})
+    check(queue.try_push(str));
+  check(!queue.try_push("e"s));
+  std::string str;
+  check(queue.try_pop(str));
+  check_eq(str, "a");
+  check(queue.try_push("e"s));
+  for (auto expected : {"b"s, "c"s, "d"s, "e"s}) {
+    check(queue.try_pop(str));
+    check_eq(str, expected);
+  }
+  check(queue.empty());
+  check(!queue.try_pop(str));
+}
+
+TEST("multiple producers and consumers transfer all elements") {
+  constexpr int num_threads = 3;
+  constexpr int num_items = 10'000;
+  detail::mpmc_ring_buffer<int, 64> queue;
+  std::vector<std::vector<int>> results(num_threads);
+  std::atomic<int> received = 0;
+  std::vector<std::thread> threads;
+  for (int id = 0; id < num_threads; ++id) {
+    threads.emplace_back([&queue, id] {
+      for (int i = 0; i < num_items; ++i)
+        while (!queue.try_push(id * num_items + i))
+          std::this_thread::yield();
+    });
+    threads.emplace_back([&queue, &received, &xs = results[id]] {
+      while (received < num_threads * num_items) {
+        int x = 0;
+        if (queue.try_pop(x)) {
+          xs.push_back(x);
+          ++received;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+  std::vector<int> all;
+  for (auto& xs : results) {
+    // Each consumer sees the elements of each producer in order.
+    for (int id = 0; id < num_threads; ++id) {
+      std::vector<int> from_id;
+      std::copy_if(xs.begin(), xs.end(), std::back_inserter(from_id),
+                   [id](int x) { return x / num_items == id; });
+      check(std::is_sorted(from_id.begin(), from_id.end()));
+    }
+    all.insert(all.end(), xs.begin(), xs.end());
+  }
+  std::sort(all.begin(), all.end());
+  check_eq(all.size(), static_cast<size_t>(num_threads * num_items));
+  check(std::adjacent_find(all.begin(), all.end()) == all.end());
+}
@@ -4,6 +4,14 @@
 
 #include "caf/detail/rfc3629.hpp"
 
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#  define CAF_RFC3629_SSE2
+#  include <emmintrin.h>
+#endif
+
 namespace {
 
 // Convenient literal for std::byte.
@@ -37,6 +45,36 @@ constexpr bool is_continuation_byte(std::byte value) noexcept {
   return head<2>(value) == 0b1000'0000_b;
 }
 
+// Number of consecutive ASCII characters before switching to `skip_ascii`.
+// Text with many multi-byte characters has only short runs of ASCII characters
+// that never pay off the word-wise probes.
+constexpr size_t ascii_run_threshold = 8;
+
+// Returns a pointer to the first non-ASCII byte in [first, last) or `last` if
+// all bytes are ASCII characters. Checks multiple bytes at once, because most
+// text in practice consists of long runs of ASCII characters.
+const std::byte* skip_ascii(const std::byte* first,
+                            const std::byte* last) noexcept {
+#ifdef CAF_RFC3629_SSE2
+  while (last - first >= 16) {
+    auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+    if (_mm_movemask_epi8(block) != 0)
+      break;
+    first += 16;
+  }
+#endif
+  while (last - first >= 8) {
+    uint64_t word;
+    memcpy(&word, first, 8);
+    if ((word & 0x8080'8080'8080'8080) != 0)
+      break;
+    first += 8;
+  }
+  while (first != last && head<1>(*first) == 0b0000'0000_b)
+    ++first;
+  return first;
+}
+
 // The following code is based on the algorithm described in
 // http://unicode.org/mail-arch/unicode-ml/y2003-m02/att-0467/01-The_Algorithm_to_Valide_an_UTF-8_String
 // Returns a pair consisting of an iterator to the of the valid  range, and a
@@ -44,12 +82,20 @@ constexpr bool is_continuation_byte(std::byte value) noexcept {
 // other failures like malformed encoding or invalid code point.
 std::pair<const std::byte*, bool> validate_rfc3629(const std::byte* first,
                                                    const std::byte* last) {
+  size_t ascii_run = 0;
   while (first != last) {
     auto checkpoint = first;
     auto x = *first++;
-    // First bit is zero: ASCII character.
-    if (head<1>(x) == 0b0000'0000_b)
+    // First bit is zero: ASCII character. Only scan word-wise after a run of
+    // ASCII characters and if at least one full word remains.
+    if (head<1>(x) == 0b0000'0000_b) {
+      if (++ascii_run >= ascii_run_threshold && last - first >= 8) {
+        first = skip_ascii(first, last);
+        ascii_run = 0;
+      }
       continue;
+    }
+    ascii_run = 0;
     // 110b'xxxx: 2-byte sequence.
     if (head<3>(x) == 0b1100'0000_b) {
       // No non-shortest form.
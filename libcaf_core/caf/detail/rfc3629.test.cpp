@@ -6,6 +6,10 @@
 
 #include "caf/test/test.hpp"
 
+#include "caf/byte_buffer.hpp"
+
+#include <random>
+
 using namespace caf;
 using detail::rfc3629;
 
@@ -25,6 +29,54 @@ constexpr std::byte operator""_b(unsigned long long x) {
   return static_cast<std::byte>(x);
 }
 
+// Validates UTF-8 one character at a time based on the table of well-formed
+// byte sequences in the Unicode standard (table 3-7). Serves as a reference for
+// checking the optimized implementation.
+res_t reference_validate(const_byte_span bytes) {
+  auto in_range = [](std::byte x, int lo, int hi) {
+    auto val = std::to_integer<int>(x);
+    return val >= lo && val <= hi;
+  };
+  size_t pos = 0;
+  while (pos < bytes.size()) {
+    auto lead = std::to_integer<int>(bytes[pos]);
+    // Number of continuation bytes and the valid range of the first one.
+    size_t num_tail = 0;
+    int lo = 0x80;
+    int hi = 0xBF;
+    if (lead <= 0x7F) {
+      ++pos;
+      continue;
+    } else if (lead >= 0xC2 && lead <= 0xDF) {
+      num_tail = 1;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+      num_tail = 2;
+      if (lead == 0xE0)
+        lo = 0xA0;
+      else if (lead == 0xED)
+        hi = 0x9F;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+      num_tail = 3;
+      if (lead == 0xF0)
+        lo = 0x90;
+      else if (lead == 0xF4)
+        hi = 0x8F;
+    } else {
+      return {pos, false};
+    }
+    for (size_t i = 1; i <= num_tail; ++i) {
+      if (pos + i == bytes.size())
+        return {pos, true};
+      if (!in_range(bytes[pos + i], lo, hi))
+        return {pos, false};
+      lo = 0x80;
+      hi = 0xBF;
+    }
+    pos += num_tail + 1;
+  }
+  return {pos, false};
+}
+
 // Missing continuation byte.
 constexpr std::byte invalid_two_byte_1[] = {0xc8_b};
 
@@ -222,3 +274,43 @@ TEST("rfc3629::validate stops at the first invalid byte") {
     check_eq(rfc3629::validate(data), res_t{10, false});
   }
 }
+
+TEST("rfc3629::validate produces the same result as a scalar reference") {
+  std::minstd_rand rng{42};
+  // Mostly ASCII text with a few multi-byte sequences, some of them broken.
+  const std::string_view fragments[] = {
+    "a",    "hello world ", "0123456789abcdef", "\xC3\xA4", "\xE2\x82\xAC",
+    "\xF0\x9F\x98\x80", "\xED\xA0\x80", "\xC0\xAF", "\xF4\x90\x80\x80", "\x80",
+    "\xE2\x82", "\xFF",
+  };
+  auto num_fragments = std::size(fragments);
+  for (int round = 0; round < 2000; ++round) {
+    byte_buffer input;
+    auto num = rng() % 40;
+    for (size_t i = 0; i < num; ++i) {
+      // Pick ASCII fragments with a much higher probability.
+      auto index = rng() % 8 == 0 ? rng() % num_fragments : rng() % 3;
+      auto bytes = as_bytes(make_span(fragments[index]));
+      input.insert(input.end(), bytes.begin(), bytes.end());
+    }
+    // Occasionally overwrite a random byte with random garbage.
+    if (!input.empty() && rng() % 4 == 0)
+      input[rng() % input.size()] = static_cast<std::byte>(rng() & 0xFF);
+    auto expected = reference_validate(input);
+    if (!check_eq(rfc3629::validate(input), expected))
+      return;
+    check_eq(rfc3629::valid(input), expected.first == input.size());
+  }
+}
+
+TEST("rfc3629::validate produces the same result for random bytes") {
+  std::minstd_rand rng{23};
+  for (int round = 0; round < 2000; ++round) {
+    byte_buffer input;
+    input.resize(rng() % 64);
+    for (auto& x : input)
+      x = static_cast<std::byte>(rng() & 0xFF);
+    if (!check_eq(rfc3629::validate(input), reference_validate(input)))
+      return;
+  }
+}
@@ -9,8 +9,6 @@
 #include "caf/event_based_actor.hpp"
 
 #include <memory>
-#include <mutex>
-#include <shared_mutex>
 #include <vector>
 
 namespace caf::detail {
@@ -79,7 +77,8 @@ public:
     // nop
   }
 
-  void operator()(actor_system& sys, std::unique_lock<std::shared_mutex>& ulock,
+  template <class Guard>
+  void operator()(actor_system& sys, Guard& guard,
                   const std::vector<actor>& workers, mailbox_element_ptr& ptr,
                   scheduler* sched) {
     if (!ptr->sender)
@@ -88,7 +87,7 @@ public:
     xs.reserve(workers.size());
     for (const auto& worker : workers)
       xs.emplace_back(worker, message{});
-    ulock.unlock();
+    guard.unlock();
     using collector_t = split_join_collector<T, Split, Join>;
     auto hdl = sys.spawn<collector_t, lazy_init>(init_, sf_, jf_,
                                                  std::move(xs));
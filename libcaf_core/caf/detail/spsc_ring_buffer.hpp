@@ -0,0 +1,91 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/config.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace caf::detail {
+
+// A lock-free ring buffer backed by an array for a single producer and a single
+// consumer that can hold a maximum of `Size` elements.
+template <class T, size_t Size>
+class spsc_ring_buffer {
+public:
+  static_assert(Size > 0 && (Size & (Size - 1)) == 0,
+                "Size must be a power of two");
+
+  spsc_ring_buffer() = default;
+
+  spsc_ring_buffer(const spsc_ring_buffer&) = delete;
+
+  spsc_ring_buffer& operator=(const spsc_ring_buffer&) = delete;
+
+  /// Enqueues `value` at the end of the queue unless the queue is full.
+  /// @returns `true` if the queue took ownership of `value`, `false` otherwise.
+  /// @pre Only called from the producer thread.
+  bool try_push(T&& value) {
+    auto wr_pos = wr_pos_.load(std::memory_order_relaxed);
+    if (wr_pos - rd_pos_.load(std::memory_order_acquire) == Size)
+      return false;
+    buf_[wr_pos % Size] = std::move(value);
+    wr_pos_.store(wr_pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Dequeues the next element from the queue unless the queue is empty.
+  /// @returns `true` if `result` now holds the dequeued element, `false`
+  ///          otherwise.
+  /// @pre Only called from the consumer thread.
+  bool try_pop(T& result) {
+    auto rd_pos = rd_pos_.load(std::memory_order_relaxed);
+    if (rd_pos == wr_pos_.load(std::memory_order_acquire))
+      return false;
+    result = std::move(buf_[rd_pos % Size]);
+    rd_pos_.store(rd_pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Dequeues all elements that are currently in the queue and passes them to
+  /// `f`.
+  /// @returns The number of dequeued elements.
+  /// @pre Only called from the consumer thread.
+  template <class F>
+  size_t drain(F&& f) {
+    auto rd_pos = rd_pos_.load(std::memory_order_relaxed);
+    auto wr_pos = wr_pos_.load(std::memory_order_acquire);
+    for (auto pos = rd_pos; pos != wr_pos; ++pos)
+      f(std::move(buf_[pos % Size]));
+    rd_pos_.store(wr_pos, std::memory_order_release);
+    return wr_pos - rd_pos;
+  }
+
+  /// Checks whether the queue currently has no elements.
+  bool empty() const noexcept {
+    return rd_pos_.load(std::memory_order_acquire)
+           == wr_pos_.load(std::memory_order_acquire);
+  }
+
+  /// Returns the number of elements in the queue.
+  size_t size() const noexcept {
+    auto rd_pos = rd_pos_.load(std::memory_order_acquire);
+    return wr_pos_.load(std::memory_order_acquire) - rd_pos;
+  }
+
+private:
+  // Stores the number of enqueued elements. Written only by the producer.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> wr_pos_ = 0;
+
+  // Stores the number of dequeued elements. Written only by the consumer.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> rd_pos_ = 0;
+
+  // Stores elements in a circular buffer.
+  alignas(CAF_CACHE_LINE_SIZE) std::array<T, Size> buf_;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,76 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/spsc_ring_buffer.hpp"
+
+#include "caf/test/test.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+using namespace std::literals;
+
+namespace {
+
+using string_queue = detail::spsc_ring_buffer<std::string, 8>;
+
+} // namespace
+
+TEST("a default-constructed ring buffer is empty") {
+  string_queue queue;
+  std::string str;
+  check(queue.empty());
+  check_eq(queue.size(), 0u);
+  check(!queue.try_pop(str));
+}
+
+TEST("try_push adds one element to the ring buffer") {
+  string_queue queue;
+  check(queue.try_push("hello"s));
+  check_eq(queue.size(), 1u);
+  std::string str;
+  check(queue.try_pop(str));
+  check_eq(str, "hello");
+  check(!queue.try_pop(str));
+}
+
+TEST("try_push fails if the ring buffer is full") {
+  string_queue queue;
+  for (int i = 0; i < 8; ++i)
+    check(queue.try_push(std::to_string(i)));
+  auto str = "8"s;
+  check(!queue.try_push(std::move(str)));
+  check_eq(str, "8");
+  std::vector<std::string> items;
+  check_eq(queue.drain([&items](std::string&& x) { items.push_back(x); }), 8u);
+  check_eq(items, std::vector{"0"s, "1"s, "2"s, "3"s, "4"s, "5"s, "6"s, "7"s});
+  check(queue.empty());
+  check(queue.try_push(std::move(str)));
+}
+
+TEST("spsc_ring_buffer transfers elements between two threads") {
+  string_queue queue;
+  std::thread producer{[&queue] {
+    for (int i = 0; i < 1000; ++i) {
+      auto str = std::to_string(i);
+      while (!queue.try_push(std::move(str)))
+        std::this_thread::yield();
+    }
+  }};
+  std::vector<int> items;
+  while (items.size() < 1000) {
+    std::string str;
+    if (queue.try_pop(str))
+      items.push_back(std::stoi(str));
+    else
+      std::this_thread::yield();
+  }
+  producer.join();
+  auto in_order = true;
+  for (int i = 0; i < 1000; ++i)
+    in_order = in_order && items[i] == i;
+  check(in_order);
+}
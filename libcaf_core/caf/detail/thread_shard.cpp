@@ -0,0 +1,39 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/thread_shard.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace caf::detail {
+
+namespace {
+
+// Upper bound for the number of shards to limit the memory overhead.
+constexpr size_t max_thread_shards = 16;
+
+std::atomic<size_t> next_thread_shard;
+
+} // namespace
+
+size_t thread_shard_count() noexcept {
+  static const size_t result
+    = std::clamp(static_cast<size_t>(std::thread::hardware_concurrency()),
+                 size_t{1}, max_thread_shards);
+  return result;
+}
+
+size_t thread_shard() noexcept {
+  // Assign shards in round-robin order to spread threads evenly. Using the
+  // upper bound instead of the actual count allows data structures to use more
+  // shards than there are cores.
+  thread_local size_t result
+    = next_thread_shard.fetch_add(1, std::memory_order_relaxed)
+      % max_thread_shards;
+  return result;
+}
+
+} // namespace caf::detail
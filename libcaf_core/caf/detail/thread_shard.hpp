@@ -0,0 +1,22 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/detail/core_export.hpp"
+
+#include <cstddef>
+
+namespace caf::detail {
+
+/// Returns the number of shards for data structures that give each thread its
+/// own slot in order to avoid contention. Never returns 0.
+CAF_CORE_EXPORT size_t thread_shard_count() noexcept;
+
+/// Returns the shard of the calling thread. Subsequent calls on the same thread
+/// always return the same value. Callers map the result to their number of
+/// shards via modulo, e.g., `thread_shard() % thread_shard_count()`.
+CAF_CORE_EXPORT size_t thread_shard() noexcept;
+
+} // namespace caf::detail
@@ -0,0 +1,247 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/timing_wheel_actor_clock.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/detail/assert.hpp"
+#include "caf/log/core.hpp"
+#include "caf/thread_owner.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace caf::detail {
+
+namespace {
+
+constexpr uint64_t slot_mask = timing_wheel_actor_clock::num_slots - 1;
+
+constexpr uint64_t no_wakeup = std::numeric_limits<uint64_t>::max();
+
+// Returns the number of ticks covered by the first `n` levels.
+constexpr uint64_t ticks_covered(size_t n) {
+  return uint64_t{1} << (timing_wheel_actor_clock::slot_bits * n);
+}
+
+} // namespace
+
+// -- slot ---------------------------------------------------------------------
+
+void timing_wheel_actor_clock::slot::push_back(schedule_entry* ptr) noexcept {
+  ptr->next = nullptr;
+  if (tail == nullptr) {
+    head = ptr;
+    tail = ptr;
+  } else {
+    tail->next = ptr;
+    tail = ptr;
+  }
+}
+
+timing_wheel_actor_clock::schedule_entry*
+timing_wheel_actor_clock::slot::take_all() noexcept {
+  auto* result = head;
+  head = nullptr;
+  tail = nullptr;
+  return result;
+}
+
+// -- constructors, destructors, and assignment operators ----------------------
+
+timing_wheel_actor_clock::timing_wheel_actor_clock(actor_system& sys,
+                                                   duration_type resolution)
+  : resolution_(resolution), origin_(clock_type::now()) {
+  CAF_ASSERT(resolution.count() > 0);
+  dispatcher_ = sys.launch_thread("caf.clock", thread_owner::system,
+                                  [this] { run(); });
+}
+
+timing_wheel_actor_clock::~timing_wheel_actor_clock() {
+  stopped_ = true;
+  {
+    std::unique_lock guard{mtx_};
+    cv_.notify_all();
+  }
+  dispatcher_.join();
+  for (auto& lvl : levels_)
+    for (auto& x : lvl)
+      destroy_all(x.take_all());
+  destroy_all(overflow_.take_all());
+  for (auto* ptr : expired_)
+    delete ptr;
+  queue_.drain([](schedule_entry* ptr) { delete ptr; });
+}
+
+// -- overrides ----------------------------------------------------------------
+
+disposable timing_wheel_actor_clock::schedule(time_point abs_time, action f) {
+  // Only the first element of a batch needs to wake up the dispatcher, because
+  // it always takes all pending entries at once.
+  if (queue_.push(new schedule_entry{abs_time, f})) {
+    std::unique_lock guard{mtx_};
+    cv_.notify_one();
+  }
+  return std::move(f).as_disposable();
+}
+
+// -- internal API -------------------------------------------------------------
+
+void timing_wheel_actor_clock::run() {
+  auto lg = log::core::trace("");
+  auto has_work = [this] { return stopped_ || !queue_.empty(); };
+  for (;;) {
+    // Move the wheel to the current time before adding new entries in order to
+    // have new entries that already timed out expire immediately.
+    auto elapsed = clock_type::now() - origin_;
+    advance(elapsed.count() > 0 ? static_cast<uint64_t>(elapsed / resolution_)
+                                : 0u);
+    queue_.drain([this](schedule_entry* ptr) {
+      ptr->seq = seq_++;
+      ptr->tick = to_tick(ptr->t);
+      insert(ptr);
+    });
+    run_expired();
+    // Wait until the next slot expires or until new entries arrive.
+    auto wakeup = next_wakeup();
+    std::unique_lock guard{mtx_};
+    if (wakeup == no_wakeup)
+      cv_.wait(guard, has_work);
+    else
+      cv_.wait_until(guard, to_time_point(wakeup), has_work);
+    if (stopped_)
+      return;
+  }
+}
+
+uint64_t timing_wheel_actor_clock::to_tick(time_point t) const noexcept {
+  if (t <= origin_)
+    return 0;
+  auto elapsed = (t - origin_).count();
+  auto res = resolution_.count();
+  return static_cast<uint64_t>(elapsed / res + (elapsed % res != 0 ? 1 : 0));
+}
+
+actor_clock::time_point
+timing_wheel_actor_clock::to_time_point(uint64_t tick) const noexcept {
+  auto max_ticks = static_cast<uint64_t>((time_point::max() - origin_)
+                                         / resolution_);
+  if (tick >= max_ticks)
+    return time_point::max();
+  return origin_ + resolution_ * static_cast<duration_type::rep>(tick);
+}
+
+void timing_wheel_actor_clock::insert(schedule_entry* ptr) {
+  if (ptr->tick <= current_tick_) {
+    expired_.push_back(ptr);
+    return;
+  }
+  // Pick the lowest level that shares all higher bits with the current tick.
+  for (size_t lvl = 0; lvl < num_levels; ++lvl) {
+    auto shift = slot_bits * (lvl + 1);
+    if ((ptr->tick >> shift) == (current_tick_ >> shift)) {
+      auto index = (ptr->tick >> (slot_bits * lvl)) & slot_mask;
+      levels_[lvl][index].push_back(ptr);
+      ++level_sizes_[lvl];
+      return;
+    }
+  }
+  overflow_.push_back(ptr);
+}
+
+void timing_wheel_actor_clock::advance(uint64_t tick) {
+  while (current_tick_ < tick) {
+    // Skip over ticks that cannot have any work. If the first `n` levels are
+    // empty, nothing happens until we reach the next slot on level `n`.
+    size_t n = 0;
+    while (n < num_levels && level_sizes_[n] == 0)
+      ++n;
+    if (n == num_levels && overflow_.head == nullptr) {
+      current_tick_ = tick;
+      return;
+    }
+    if (n > 0) {
+      auto boundary = current_tick_ | (ticks_covered(n) - 1);
+      if (boundary > current_tick_) {
+        current_tick_ = std::min(boundary, tick);
+        continue;
+      }
+    }
+    ++current_tick_;
+    // Cascade entries from the higher levels, starting at the top.
+    if ((current_tick_ & (ticks_covered(num_levels) - 1)) == 0) {
+      auto* ptr = overflow_.take_all();
+      while (ptr != nullptr) {
+        auto* next = ptr->next;
+        insert(ptr);
+        ptr = next;
+      }
+    }
+    for (auto lvl = num_levels - 1; lvl > 0; --lvl) {
+      if ((current_tick_ & (ticks_covered(lvl) - 1)) == 0)
+        cascade(lvl, (current_tick_ >> (slot_bits * lvl)) & slot_mask);
+    }
+    cascade(0, current_tick_ & slot_mask);
+  }
+}
+
+void timing_wheel_actor_clock::cascade(size_t lvl, size_t index) {
+  auto* ptr = levels_[lvl][index].take_all();
+  while (ptr != nullptr) {
+    auto* next = ptr->next;
+    --level_sizes_[lvl];
+    if (ptr->f.disposed())
+      delete ptr; // Lazy removal of cancelled actions.
+    else
+      insert(ptr); // Always goes to `expired_` for level 0.
+    ptr = next;
+  }
+}
+
+uint64_t timing_wheel_actor_clock::next_wakeup() const noexcept {
+  if (!expired_.empty())
+    return current_tick_;
+  // The first non-empty slot on the lowest non-empty level always comes first,
+  // because all slots on a level lie before the next slot on the level above.
+  for (size_t lvl = 0; lvl < num_levels; ++lvl) {
+    if (level_sizes_[lvl] == 0)
+      continue;
+    auto shift = slot_bits * lvl;
+    auto base = current_tick_ & ~(ticks_covered(lvl + 1) - 1);
+    for (auto i = ((current_tick_ >> shift) & slot_mask) + 1; i < num_slots;
+         ++i) {
+      if (levels_[lvl][i].head != nullptr)
+        return base | (i << shift);
+    }
+  }
+  if (overflow_.head != nullptr)
+    return ((current_tick_ >> (slot_bits * num_levels)) + 1)
+           << (slot_bits * num_levels);
+  return no_wakeup;
+}
+
+void timing_wheel_actor_clock::run_expired() {
+  if (expired_.empty())
+    return;
+  auto by_timeout = [](const schedule_entry* x, const schedule_entry* y) {
+    return x->t != y->t ? x->t < y->t : x->seq < y->seq;
+  };
+  std::sort(expired_.begin(), expired_.end(), by_timeout);
+  for (auto* ptr : expired_) {
+    if (!ptr->f.disposed())
+      ptr->f.run();
+    delete ptr;
+  }
+  expired_.clear();
+}
+
+void timing_wheel_actor_clock::destroy_all(schedule_entry* ptr) noexcept {
+  while (ptr != nullptr) {
+    auto* next = ptr->next;
+    delete ptr;
+    ptr = next;
+  }
+}
+
+} // namespace caf::detail
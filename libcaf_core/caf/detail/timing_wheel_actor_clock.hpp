@@ -0,0 +1,158 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/action.hpp"
+#include "caf/actor_clock.hpp"
+#include "caf/defaults.hpp"
+#include "caf/detail/core_export.hpp"
+#include "caf/detail/injection_queue.hpp"
+#include "caf/fwd.hpp"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace caf::detail {
+
+/// An actor clock that manages pending actions in a hierarchical timing wheel.
+/// Scheduling and cancelling an action are O(1) operations and producers never
+/// block: new actions travel to the dispatcher thread through a lock-free
+/// queue. Disposed actions remain in the wheel until the dispatcher reaches
+/// their slot, at which point it drops them without running them.
+class CAF_CORE_EXPORT timing_wheel_actor_clock : public actor_clock {
+public:
+  // -- constants --------------------------------------------------------------
+
+  /// Number of bits for indexing the slots on each level.
+  static constexpr size_t slot_bits = 8;
+
+  /// Number of slots on each level.
+  static constexpr size_t num_slots = size_t{1} << slot_bits;
+
+  /// Number of levels in the wheel. With a resolution of one millisecond, the
+  /// wheel covers about 49 days before falling back to the overflow list.
+  static constexpr size_t num_levels = 4;
+
+  /// Default length of a single tick.
+  static constexpr auto default_resolution = defaults::clock::resolution;
+
+  // -- member types -----------------------------------------------------------
+
+  using super = actor_clock;
+
+  /// Stores an action along with its scheduling time.
+  struct schedule_entry {
+    time_point t;
+    action f;
+    uint64_t tick = 0;
+    uint64_t seq = 0;
+    schedule_entry* next = nullptr;
+  };
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  explicit timing_wheel_actor_clock(actor_system& sys,
+                                    duration_type resolution
+                                    = default_resolution);
+
+  ~timing_wheel_actor_clock() override;
+
+  // -- overrides --------------------------------------------------------------
+
+  using super::schedule;
+
+  disposable schedule(time_point abs_time, action f) override;
+
+private:
+  // -- member types -----------------------------------------------------------
+
+  /// An intrusive FIFO list of entries.
+  struct slot {
+    schedule_entry* head = nullptr;
+    schedule_entry* tail = nullptr;
+
+    void push_back(schedule_entry* ptr) noexcept;
+
+    schedule_entry* take_all() noexcept;
+  };
+
+  using level = std::array<slot, num_slots>;
+
+  // -- internal API -----------------------------------------------------------
+
+  void run();
+
+  /// Converts a time point to a tick, rounding up to never fire early.
+  uint64_t to_tick(time_point t) const noexcept;
+
+  /// Converts a tick to the time point at which it begins.
+  time_point to_time_point(uint64_t tick) const noexcept;
+
+  /// Adds `ptr` to the wheel or to the list of expired entries.
+  void insert(schedule_entry* ptr);
+
+  /// Advances the wheel to `tick`, moving all expired entries to `expired_`.
+  void advance(uint64_t tick);
+
+  /// Re-inserts all entries of the given slot on level `lvl`.
+  void cascade(size_t lvl, size_t index);
+
+  /// Returns the next tick at which the dispatcher must wake up.
+  uint64_t next_wakeup() const noexcept;
+
+  /// Runs all expired entries ordered by their scheduled time.
+  void run_expired();
+
+  /// Destroys all entries in the given list.
+  static void destroy_all(schedule_entry* ptr) noexcept;
+
+  // -- member variables -------------------------------------------------------
+
+  /// Length of a single tick.
+  duration_type resolution_;
+
+  /// The time point at which the wheel started, i.e., tick 0.
+  time_point origin_;
+
+  /// The last tick that the dispatcher processed.
+  uint64_t current_tick_ = 0;
+
+  /// Counter for restoring insertion order of entries with the same timeout.
+  uint64_t seq_ = 0;
+
+  /// Number of entries on each level.
+  std::array<size_t, num_levels> level_sizes_ = {};
+
+  /// The slots of the wheel.
+  std::array<level, num_levels> levels_;
+
+  /// Entries beyond the range of the wheel.
+  slot overflow_;
+
+  /// Scratch space for expired entries.
+  std::vector<schedule_entry*> expired_;
+
+  /// Communication to the dispatcher thread.
+  injection_queue<schedule_entry> queue_;
+
+  /// Signals the dispatcher thread to shut down.
+  std::atomic<bool> stopped_ = false;
+
+  /// Protects the condition variable for waking up the dispatcher.
+  std::mutex mtx_;
+
+  /// Wakes up the dispatcher thread when new entries arrive.
+  std::condition_variable cv_;
+
+  /// Handle to the dispatcher thread.
+  std::thread dispatcher_;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,102 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/timing_wheel_actor_clock.hpp"
+
+#include "caf/test/test.hpp"
+
+#include "caf/action.hpp"
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/detail/latch.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace caf;
+using namespace std::literals;
+
+namespace {
+
+using clock_type = actor_clock::clock_type;
+
+struct fixture {
+  fixture() : sys(cfg) {
+    // nop
+  }
+
+  // Schedules an action that records `id` after `delay`.
+  disposable add(detail::timing_wheel_actor_clock& uut,
+                 actor_clock::duration_type delay, int id) {
+    auto t = clock_type::now() + delay;
+    return uut.schedule(t, make_action([this, id, t] {
+                          std::unique_lock guard{mtx};
+                          ids.push_back(id);
+                          early = early || clock_type::now() < t;
+                          done->count_down();
+                        }));
+  }
+
+  actor_system_config cfg;
+  actor_system sys;
+  std::mutex mtx;
+  std::vector<int> ids;
+  bool early = false;
+  std::shared_ptr<detail::latch> done;
+};
+
+} // namespace
+
+WITH_FIXTURE(fixture) {
+
+TEST("actions run in the order of their timeouts") {
+  done = std::make_shared<detail::latch>(4);
+  detail::timing_wheel_actor_clock uut{sys};
+  add(uut, 30ms, 4);
+  add(uut, 10ms, 2);
+  add(uut, 0ms, 1);
+  add(uut, 20ms, 3);
+  done->wait();
+  std::unique_lock guard{mtx};
+  check_eq(ids, std::vector<int>{1, 2, 3, 4});
+  check(!early);
+}
+
+TEST("actions with the same timeout run in insertion order") {
+  done = std::make_shared<detail::latch>(3);
+  detail::timing_wheel_actor_clock uut{sys};
+  auto t = clock_type::now() + 5ms;
+  for (int id = 1; id <= 3; ++id)
+    uut.schedule(t, make_action([this, id] {
+                   std::unique_lock guard{mtx};
+                   ids.push_back(id);
+                   done->count_down();
+                 }));
+  done->wait();
+  std::unique_lock guard{mtx};
+  check_eq(ids, std::vector<int>{1, 2, 3});
+}
+
+TEST("disposed actions never run") {
+  done = std::make_shared<detail::latch>(1);
+  detail::timing_wheel_actor_clock uut{sys};
+  auto cancelled = add(uut, 5ms, 1);
+  add(uut, 300ms, 2); // Cascades from the second level.
+  cancelled.dispose();
+  done->wait();
+  std::unique_lock guard{mtx};
+  check_eq(ids, std::vector<int>{2});
+  check(!early);
+}
+
+TEST("the clock drops pending actions on shutdown") {
+  done = std::make_shared<detail::latch>(1);
+  auto uut = std::make_unique<detail::timing_wheel_actor_clock>(sys);
+  auto pending = add(*uut, 1h, 1);
+  uut = nullptr;
+  check(ids.empty());
+}
+
+} // WITH_FIXTURE(fixture)
@@ -14,6 +14,8 @@
 
 #include <array>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <optional>
 #include <string>
@@ -595,6 +597,22 @@ struct is_list_like {
 template <class T>
 inline constexpr bool is_list_like_v = is_list_like<T>::value;
 
+/// Checks whether T is a contiguous sequence of fixed-size arithmetic values
+/// that binary inspectors may read and write in a single pass. Users may
+/// specialize this trait for custom containers that provide `data`, `size`,
+/// `resize` and a `value_type` alias.
+template <class T>
+struct is_bulk_sequence : std::false_type {};
+
+template <class T, class Allocator>
+struct is_bulk_sequence<std::vector<T, Allocator>>
+  : std::bool_constant<is_one_of_v<T, std::byte, int8_t, uint8_t, int16_t,
+                                   uint16_t, int32_t, uint32_t, int64_t,
+                                   uint64_t, float, double>> {};
+
+template <class T>
+inline constexpr bool is_bulk_sequence_v = is_bulk_sequence<T>::value;
+
 template <class T, class To>
 class has_convertible_data_member {
 private:
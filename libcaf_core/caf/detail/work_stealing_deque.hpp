@@ -0,0 +1,187 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/config.hpp"
+#include "caf/detail/assert.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace caf::detail {
+
+/// A lock-free, dynamically growing work-stealing deque for pointers as
+/// described by Chase and Lev ("Dynamic Circular Work-Stealing Deque") with
+/// the memory orderings from Lê et al. ("Correct and Efficient Work-Stealing
+/// for Weak Memory Models").
+///
+/// Only the owner may call `push` and `take`, which operate on the bottom of
+/// the deque. Any thread may call `steal` to take from the top of the deque.
+template <class T>
+class work_stealing_deque {
+public:
+  // -- member types -----------------------------------------------------------
+
+  using value_type = T;
+
+  using pointer = value_type*;
+
+  // -- constants --------------------------------------------------------------
+
+  /// Default capacity of a new deque. Must be a power of two.
+  static constexpr size_t default_capacity = 256;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  explicit work_stealing_deque(size_t capacity = default_capacity) {
+    CAF_ASSERT(capacity > 0 && (capacity & (capacity - 1)) == 0);
+    buffers_.emplace_back(std::make_unique<buffer>(capacity));
+    buf_.store(buffers_.back().get(), std::memory_order_relaxed);
+  }
+
+  work_stealing_deque(const work_stealing_deque&) = delete;
+
+  work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns an approximation of the number of elements in the deque.
+  size_t size() const noexcept {
+    auto b = bottom_.load(std::memory_order_relaxed);
+    auto t = top_.load(std::memory_order_relaxed);
+    return b > t ? static_cast<size_t>(b - t) : 0u;
+  }
+
+  /// Returns whether the deque appears to be empty.
+  bool empty() const noexcept {
+    return size() == 0;
+  }
+
+  /// Returns the current capacity of the deque.
+  size_t capacity() const noexcept {
+    return buf_.load(std::memory_order_relaxed)->capacity();
+  }
+
+  // -- owner operations -------------------------------------------------------
+
+  /// Pushes `value` to the bottom of the deque.
+  /// @pre `value != nullptr`
+  /// @note Only the owner may call this function.
+  void push(pointer value) {
+    CAF_ASSERT(value != nullptr);
+    auto b = bottom_.load(std::memory_order_relaxed);
+    auto t = top_.load(std::memory_order_acquire);
+    auto* buf = buf_.load(std::memory_order_relaxed);
+    if (b - t > static_cast<int64_t>(buf->capacity()) - 1)
+      buf = grow(buf, b, t);
+    buf->put(b, value);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+  }
+
+  /// Removes and returns the element at the bottom of the deque or `nullptr`
+  /// if the deque is empty.
+  /// @note Only the owner may call this function.
+  pointer take() {
+    auto b = bottom_.load(std::memory_order_relaxed) - 1;
+    auto* buf = buf_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto t = top_.load(std::memory_order_relaxed);
+    if (t > b) {
+      // Deque was empty.
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    auto* result = buf->get(b);
+    if (t == b) {
+      // Last element: race against thieves.
+      if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed))
+        result = nullptr;
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+  // -- thief operations -------------------------------------------------------
+
+  /// Removes and returns the element at the top of the deque. Returns
+  /// `nullptr` if the deque is empty or if another thread won the race for
+  /// the top element.
+  /// @note Safe to call from any thread.
+  pointer steal() {
+    auto t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto b = bottom_.load(std::memory_order_acquire);
+    if (t >= b)
+      return nullptr;
+    auto* buf = buf_.load(std::memory_order_acquire);
+    auto* result = buf->get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed))
+      return nullptr;
+    return result;
+  }
+
+private:
+  // -- implementation details -------------------------------------------------
+
+  /// A circular array with a capacity that is always a power of two.
+  class buffer {
+  public:
+    explicit buffer(size_t capacity)
+      : mask_(capacity - 1), items_(new std::atomic<pointer>[capacity]) {
+      // nop
+    }
+
+    size_t capacity() const noexcept {
+      return mask_ + 1;
+    }
+
+    pointer get(int64_t index) const noexcept {
+      return items_[static_cast<size_t>(index) & mask_].load(
+        std::memory_order_relaxed);
+    }
+
+    void put(int64_t index, pointer value) noexcept {
+      items_[static_cast<size_t>(index) & mask_].store(
+        value, std::memory_order_relaxed);
+    }
+
+  private:
+    size_t mask_;
+    std::unique_ptr<std::atomic<pointer>[]> items_;
+  };
+
+  buffer* grow(buffer* old, int64_t b, int64_t t) {
+    auto next = std::make_unique<buffer>(old->capacity() * 2);
+    for (auto i = t; i != b; ++i)
+      next->put(i, old->get(i));
+    // Thieves may still read from the old buffer, so we keep it alive until
+    // the deque itself gets destroyed.
+    buffers_.emplace_back(std::move(next));
+    auto* result = buffers_.back().get();
+    buf_.store(result, std::memory_order_release);
+    return result;
+  }
+
+  /// Index of the next element to steal. Modified by thieves and the owner.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<int64_t> top_ = 0;
+
+  /// Index of the next free slot. Modified only by the owner.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<int64_t> bottom_ = 0;
+
+  /// Points to the currently active buffer.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<buffer*> buf_;
+
+  /// Owns all buffers ever allocated by this deque. Accessed only by the owner.
+  std::vector<std::unique_ptr<buffer>> buffers_;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,88 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/work_stealing_deque.hpp"
+
+#include "caf/test/test.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+
+using int_deque = detail::work_stealing_deque<int>;
+
+TEST("a default-constructed deque is empty") {
+  int_deque uut;
+  check(uut.empty());
+  check_eq(uut.take(), nullptr);
+  check_eq(uut.steal(), nullptr);
+}
+
+TEST("the owner takes elements in LIFO order") {
+  int xs[] = {1, 2, 3};
+  int_deque uut;
+  for (auto& x : xs)
+    uut.push(&x);
+  check_eq(uut.size(), 3u);
+  check_eq(uut.take(), &xs[2]);
+  check_eq(uut.take(), &xs[1]);
+  check_eq(uut.take(), &xs[0]);
+  check_eq(uut.take(), nullptr);
+}
+
+TEST("thieves steal elements in FIFO order") {
+  int xs[] = {1, 2, 3};
+  int_deque uut;
+  for (auto& x : xs)
+    uut.push(&x);
+  check_eq(uut.steal(), &xs[0]);
+  check_eq(uut.steal(), &xs[1]);
+  check_eq(uut.take(), &xs[2]);
+  check_eq(uut.steal(), nullptr);
+}
+
+TEST("the deque grows when exceeding its capacity") {
+  std::vector<int> xs(100);
+  int_deque uut{4};
+  for (auto& x : xs)
+    uut.push(&x);
+  check_ge(uut.capacity(), 100u);
+  check_eq(uut.size(), 100u);
+  for (auto i = xs.rbegin(); i != xs.rend(); ++i)
+    check_eq(uut.take(), &*i);
+  check(uut.empty());
+}
+
+TEST("each element is taken exactly once with concurrent thieves") {
+  constexpr size_t num_elements = 10'000;
+  constexpr size_t num_thieves = 3;
+  std::vector<int> xs(num_elements);
+  std::vector<std::atomic<int>> hits(num_elements);
+  int_deque uut{16};
+  std::atomic<bool> done = false;
+  auto record = [&](int* ptr) { ++hits[static_cast<size_t>(ptr - xs.data())]; };
+  std::vector<std::thread> thieves;
+  for (size_t i = 0; i < num_thieves; ++i)
+    thieves.emplace_back([&] {
+      while (!done)
+        if (auto* ptr = uut.steal())
+          record(ptr);
+    });
+  for (size_t i = 0; i < num_elements; ++i) {
+    uut.push(&xs[i]);
+    if (i % 3 == 0)
+      if (auto* ptr = uut.take())
+        record(ptr);
+  }
+  while (auto* ptr = uut.take())
+    record(ptr);
+  done = true;
+  for (auto& thief : thieves)
+    thief.join();
+  check(std::all_of(hits.begin(), hits.end(),
+                    [](const std::atomic<int>& x) { return x == 1; }));
+}
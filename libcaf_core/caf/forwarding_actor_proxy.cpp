@@ -5,7 +5,10 @@
 #include "caf/forwarding_actor_proxy.hpp"
 
 #include "caf/anon_mail.hpp"
+#include "caf/binary_serializer.hpp"
+#include "caf/byte_buffer.hpp"
 #include "caf/detail/assert.hpp"
+#include "caf/detail/sync_request_bouncer.hpp"
 #include "caf/log/core.hpp"
 #include "caf/mailbox_element.hpp"
 #include "caf/system_messages.hpp"
@@ -33,9 +36,22 @@ bool forwarding_actor_proxy::forward_msg(strong_actor_ptr sender,
                              sender, mid, msg);
   if (msg.match_elements<exit_msg>())
     unlink_from(msg.get_as<exit_msg>(0).source);
+  // Serialize the content on the calling thread. Otherwise, the broker would
+  // have to serialize all messages to remote actors on a single thread.
+  byte_buffer payload;
+  binary_serializer sink{home_system(), payload};
+  if (!sink.apply(msg)) {
+    log::core::error("failed to serialize message for remote actor: {}",
+                     sink.get_error());
+    if (mid.is_request()) {
+      detail::sync_request_bouncer srb{sink.get_error()};
+      srb(sender, mid);
+    }
+    return false;
+  }
   auto ptr = make_mailbox_element(nullptr, make_message_id(), forward_atom_v,
                                   std::move(sender), strong_actor_ptr{ctrl()},
-                                  mid, std::move(msg));
+                                  mid, std::move(payload));
   std::shared_lock guard{broker_mtx_};
   if (broker_)
     return broker_->enqueue(std::move(ptr), nullptr);
@@ -0,0 +1,98 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/forwarding_actor_proxy.hpp"
+
+#include "caf/test/fixture/deterministic.hpp"
+#include "caf/test/test.hpp"
+
+#include "caf/anon_mail.hpp"
+#include "caf/binary_deserializer.hpp"
+#include "caf/byte_buffer.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/make_actor.hpp"
+#include "caf/message.hpp"
+#include "caf/message_id.hpp"
+
+using namespace caf;
+using namespace std::literals;
+
+namespace {
+
+struct fixture : test::fixture::deterministic {
+  // Stores the messages that the proxy forwards to the broker.
+  std::vector<message> forwarded;
+
+  // Stores the message IDs that the proxy forwards to the broker.
+  std::vector<message_id> forwarded_ids;
+
+  actor broker;
+
+  strong_actor_ptr proxy;
+
+  fixture() {
+    broker = sys.spawn([this](event_based_actor* self) -> behavior {
+      return {
+        [this, self](forward_atom, const strong_actor_ptr&,
+                     const strong_actor_ptr&, message_id mid,
+                     const byte_buffer& payload) {
+          message msg;
+          binary_deserializer source{self->home_system(), payload};
+          if (!source.apply(msg))
+            test::runnable::current().fail("failed to deserialize: {}",
+                                           source.get_error());
+          forwarded.push_back(std::move(msg));
+          forwarded_ids.push_back(mid);
+        },
+        [](monitor_atom, const strong_actor_ptr&) {},
+        [](delete_atom, const node_id&, actor_id) {},
+      };
+    });
+    actor_config cfg;
+    auto nid = *make_node_id(42, "0102030405060708090A0B0C0D0E0F1011121314");
+    proxy = make_actor<forwarding_actor_proxy, strong_actor_ptr>(
+      42, nid, &sys, cfg, broker);
+  }
+
+  ~fixture() {
+    static_cast<actor_proxy*>(proxy->get())->kill_proxy(nullptr, none);
+    proxy = nullptr;
+    dispatch_messages();
+  }
+};
+
+} // namespace
+
+WITH_FIXTURE(fixture) {
+
+TEST("proxies forward messages in serialized form") {
+  auto hdl = actor_cast<actor>(proxy);
+  anon_mail("hello", 1).send(hdl);
+  anon_mail(2.0, "world"s).send(hdl);
+  anon_mail(uint64_t{7}, true).send(hdl);
+  dispatch_messages();
+  if (check_eq(forwarded.size(), 3u)) {
+    check_eq(to_string(forwarded[0]), to_string(make_message("hello", 1)));
+    check_eq(to_string(forwarded[1]), to_string(make_message(2.0, "world"s)));
+    check_eq(to_string(forwarded[2]),
+             to_string(make_message(uint64_t{7}, true)));
+  }
+}
+
+TEST("proxies preserve the message ID of requests") {
+  auto hdl = actor_cast<actor>(proxy);
+  sys.spawn([hdl](event_based_actor* self) -> behavior {
+    self->mail(int32_t{42}).request(hdl, 1s).then([](int32_t) {});
+    return {
+      [](int32_t) {},
+    };
+  });
+  dispatch_messages();
+  if (check_eq(forwarded.size(), 1u)) {
+    check_eq(to_string(forwarded[0]), to_string(make_message(int32_t{42})));
+    check(forwarded_ids[0].is_request());
+  }
+}
+
+} // WITH_FIXTURE(fixture)
@@ -358,6 +358,7 @@ class abstract_worker;
 class abstract_worker_hub;
 class disposer;
 class dynamic_message_data;
+class mailbox_size_collector;
 class message_data;
 class private_thread;
 class stream_bridge;
@@ -9,8 +9,14 @@
 
 #include "caf/binary_deserializer.hpp"
 #include "caf/binary_serializer.hpp"
+#include "caf/detail/format.hpp"
 #include "caf/json_array.hpp"
 #include "caf/json_object.hpp"
+#include "caf/log/test.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <string>
 
 using namespace caf;
 using namespace std::literals;
@@ -463,3 +469,57 @@ TEST("in-situ parsing for a non-empty object") {
   check(
     std::isnan(obj.value("nested").to_object().value("nan-value").to_double()));
 }
+
+TEST("lookups in large objects") {
+  // The parser indexes objects with many members to speed up lookups.
+  std::string input = "{";
+  for (int i = 39; i >= 0; --i)
+    input += detail::format(R"_("key-{}": {}, )_", i, i);
+  input += R"_("key-7": -1, "key-A": "escaped"})_";
+  auto check_members = [this](const json_value& val) {
+    check(val.is_object());
+    auto obj = val.to_object();
+    check_eq(obj.size(), 42u);
+    for (int i = 0; i < 40; ++i)
+      check_eq(obj.value(detail::format("key-{}", i)).to_integer(), i);
+    check_eq(obj.value("key-A").to_string(), "escaped");
+    check(obj.value("key-40").is_undefined());
+    check(obj.value("").is_undefined());
+  };
+  check_members(unbox(json_value::parse(input)));
+  check_members(unbox(json_value::parse_shallow(input)));
+  check_members(unbox(json_value::parse_in_situ(input)));
+}
+
+TEST("the file parser agrees with the string parser") {
+  // The file parser reads one character at a time and never uses the
+  // structural index of the string parser.
+  std::ifstream in{test_json_file_path};
+  std::string input{std::istreambuf_iterator<char>{in},
+                    std::istreambuf_iterator<char>{}};
+  check_eq(unbox(json_value::parse_file(test_json_file_path)),
+           unbox(json_value::parse(input)));
+}
+
+TEST("escaped strings") {
+  auto val = unbox(json_value::parse(R"_(["ä", "😀", "a\"b"])_"));
+  check_eq(to_string(val), R"_(["ä", "😀", "a\"b"])_");
+  auto str = R"_({"\t": ["\\", "\n"]})_"s;
+  val = unbox(json_value::parse_in_situ(str));
+  check_eq(to_string(val), R"_({"\t": ["\\", "\n"]})_");
+}
+
+TEST("invalid input") {
+  auto invalid = {""sv,          "  "sv,          "[1, 2,]"sv,  "[1 2]"sv,
+                  R"_({"a" 1})_"sv, R"_({"a": 1}})_"sv, R"_("\x")_"sv,
+                  R"_("\u12")_"sv,  R"_("\ud83d")_"sv,  "tru"sv,
+                  "1.2.3"sv,     R"_("abc)_"sv,   "[1, {]"sv,   "{,}"sv};
+  for (auto str : invalid) {
+    if (!check(!json_value::parse(str)))
+      log::test::error("accepted invalid input: {}", str);
+  }
+  // The error includes the position of the first invalid character.
+  auto res = json_value::parse("[1,\n 2,\n x]");
+  if (check(!res))
+    check_eq(res.error(), parser_state_to_error(pec::unexpected_character, 3, 2));
+}
@@ -11,6 +11,7 @@
 #include "caf/binary_serializer.hpp"
 #include "caf/default_attachable.hpp"
 #include "caf/detail/glob_match.hpp"
+#include "caf/detail/mailbox_size_collector.hpp"
 #include "caf/disposable.hpp"
 #include "caf/exit_reason.hpp"
 #include "caf/logger.hpp"
@@ -18,6 +19,7 @@
 #include "caf/resumable.hpp"
 #include "caf/scheduler.hpp"
 #include "caf/sec.hpp"
+#include "caf/span.hpp"
 #include "caf/telemetry/histogram.hpp"
 #include "caf/telemetry/metric.hpp"
 #include "caf/telemetry/metric_family.hpp"
@@ -30,29 +32,32 @@ namespace caf {
 
 namespace {
 
-local_actor::metrics_t make_instance_metrics(local_actor* self) {
-  const auto& sys = self->home_system();
-  const auto& includes = sys.metrics_actors_includes();
-  const auto& excludes = sys.metrics_actors_excludes();
-  const auto* name = self->name();
+// Checks whether `name` matches at least one of the glob patterns in `globs`.
+bool matches_any(const char* name, span<const std::string> globs) {
   auto matches = [name](const std::string& glob) {
     return detail::glob_match(name, glob.c_str());
   };
-  if (includes.empty()
-      || std::none_of(includes.begin(), includes.end(), matches)
-      || std::any_of(excludes.begin(), excludes.end(), matches))
+  return std::any_of(globs.begin(), globs.end(), matches);
+}
+
+local_actor::metrics_t make_instance_metrics(local_actor* self) {
+  const auto& sys = self->home_system();
+  const auto* name = self->name();
+  if (!matches_any(name, sys.metrics_actors_includes())
+      || matches_any(name, sys.metrics_actors_excludes()))
     return {
       nullptr,
       nullptr,
-      nullptr,
     };
   self->setf(abstract_actor::collects_metrics_flag);
   const auto& families = sys.actor_metric_families();
   std::string_view sv{name, strlen(name)};
+  // Selected actors always export the mailbox size, even if no actor with this
+  // name is alive when collecting the metrics.
+  families.mailbox_size->get_or_add({{"name", sv}});
   return {
     families.processing_time->get_or_add({{"name", sv}}),
     families.mailbox_time->get_or_add({{"name", sv}}),
-    families.mailbox_size->get_or_add({{"name", sv}}),
   };
 }
 
@@ -72,6 +77,15 @@ local_actor::~local_actor() {
 
 void local_actor::setup_metrics() {
   metrics_ = make_instance_metrics(this);
+  // Unlike the other actor metrics, the mailbox size does not require users to
+  // select actors via `includes`. However, `excludes` still applies. Note that
+  // registering locks a mutex, but does not allocate any memory.
+  if (!matches_any(name(), home_system().metrics_actors_excludes()))
+    system().mailbox_sizes().add(this);
+}
+
+void local_actor::stop_reporting_mailbox_size() {
+  system().mailbox_sizes().remove(this);
 }
 
 auto local_actor::now() const noexcept -> clock_type::time_point {
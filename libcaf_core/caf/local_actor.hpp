@@ -44,6 +44,8 @@ public:
 
   friend class mail_cache;
 
+  friend class detail::mailbox_size_collector;
+
   // -- member types -----------------------------------------------------------
 
   /// Defines a monotonic clock suitable for measuring intervals.
@@ -56,9 +58,6 @@ public:
 
     /// Samples how long messages wait in the mailbox before being processed.
     telemetry::dbl_histogram* mailbox_time = nullptr;
-
-    /// Counts how many messages are currently waiting in the mailbox.
-    telemetry::int_gauge* mailbox_size = nullptr;
   };
 
   /// Optional metrics for inbound stream traffic collected by individual actors
@@ -447,8 +446,20 @@ protected:
 
   metrics_t metrics_;
 
+  /// Removes this actor from the gauge for the mailbox size. Actors must call
+  /// this function when closing their mailbox, i.e., before destroying it.
+  void stop_reporting_mailbox_size();
+
 private:
   virtual void do_unstash(mailbox_element_ptr ptr) = 0;
+
+  /// Links this actor to its predecessor in the list of the mailbox size
+  /// collector.
+  local_actor* mailbox_size_prev_ = nullptr;
+
+  /// Links this actor to its successor in the list of the mailbox size
+  /// collector.
+  local_actor* mailbox_size_next_ = nullptr;
 };
 
 } // namespace caf
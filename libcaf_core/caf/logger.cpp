@@ -10,12 +10,13 @@
 #include "caf/config.hpp"
 #include "caf/defaults.hpp"
 #include "caf/detail/atomic_ref_counted.hpp"
+#include "caf/detail/binary_log_writer.hpp"
 #include "caf/detail/get_process_id.hpp"
 #include "caf/detail/log_level_map.hpp"
 #include "caf/detail/meta_object.hpp"
 #include "caf/detail/pretty_type_name.hpp"
 #include "caf/detail/set_thread_name.hpp"
-#include "caf/detail/sync_ring_buffer.hpp"
+#include "caf/detail/spsc_ring_buffer.hpp"
 #include "caf/local_actor.hpp"
 #include "caf/log/core.hpp"
 #include "caf/log/level.hpp"
@@ -27,15 +28,20 @@
 #include "caf/timestamp.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <cstring>
 #include <ctime>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace caf {
 
@@ -86,14 +92,48 @@ thread_local actor_id current_actor_id;
 // Stores a pointer to the system-wide logger.
 thread_local intrusive_ptr<logger> current_logger_ptr;
 
+// Assigns a unique ID to each logger instance.
+std::atomic<uint64_t> next_logger_id = 1;
+
+// Per-thread buffer for log events that only the logger thread drains.
+struct log_event_buffer : detail::spsc_ring_buffer<log::event_ptr, 1024> {
+  // Set when the owning thread terminates. The logger thread removes orphaned
+  // buffers after draining them.
+  std::atomic<bool> orphaned = false;
+};
+
+using log_event_buffer_ptr = std::shared_ptr<log_event_buffer>;
+
+// Caches the event buffer of the current thread for the last used logger.
+struct cached_log_event_buffer {
+  uint64_t logger_id = 0;
+  log_event_buffer_ptr buf;
+  // Stores all buffers this thread writes to, i.e., one per logger.
+  std::vector<log_event_buffer_ptr> owned;
+
+  ~cached_log_event_buffer() {
+    // Pairs with the acquire loads in the logger: the logger thread observes
+    // all events of this thread before it observes the flag.
+    for (auto& ptr : owned)
+      ptr->orphaned.store(true, std::memory_order_release);
+  }
+
+  void adopt(const log_event_buffer_ptr& ptr) {
+    // Drop buffers of loggers that no longer exist before adding a new one.
+    auto unused = [](const log_event_buffer_ptr& x) {
+      return x.use_count() == 1;
+    };
+    owned.erase(std::remove_if(owned.begin(), owned.end(), unused),
+                owned.end());
+    owned.push_back(ptr);
+  }
+};
+
+thread_local cached_log_event_buffer current_log_event_buffer;
+
 // Default logger implementation.
 class default_logger : public logger, public detail::atomic_ref_counted {
 public:
-  // -- constants --------------------------------------------------------------
-
-  /// Configures the size of the circular event queue.
-  static constexpr size_t queue_size = 128;
-
   // -- member types -----------------------------------------------------------
 
   enum field_type {
@@ -132,6 +172,10 @@ public:
 
     /// Configures whether the logger generates colored output.
     bool console_coloring = false;
+
+    /// Configures whether the logger writes a compact binary format instead
+    /// of formatted text to the log file.
+    bool binary_file = false;
   };
 
   /// Represents a single format string field.
@@ -145,19 +189,29 @@ public:
 
   // -- constructors, destructors, and assignment operators --------------------
 
-  default_logger(actor_system& sys) : t0_(make_timestamp()), system_(sys) {
+  default_logger(actor_system& sys)
+    : id_(next_logger_id++), t0_(make_timestamp()), system_(sys) {
     log_level_names_.set("WARN", log::level::warning);
   }
 
   // -- logging ----------------------------------------------------------------
 
-  /// Writes an entry to the event-queue of the logger.
+  /// Writes an entry to the event buffer of the calling thread.
   /// @threadsafe
   void do_log(log::event_ptr&& event) override {
-    if (cfg_.inline_output)
+    if (cfg_.inline_output) {
       handle_event(*event);
-    else
-      queue_.push(std::move(event));
+      return;
+    }
+    auto& buf = local_buffer();
+    // Note: we only block the caller if its own buffer is full. In this case,
+    //       we make sure the logger thread is awake and wait for it to catch
+    //       up.
+    while (!buf.try_push(std::move(event))) {
+      wakeup();
+      std::this_thread::yield();
+    }
+    wakeup_if_sleeping();
   }
 
   // -- properties -------------------------------------------------------------
@@ -341,12 +395,17 @@ public:
       get_or(cfg, "caf.logger.console.format", lg::console::format));
     // If not set to `false`, CAF enables colored output when writing to TTYs.
     cfg_.console_coloring = get_or(cfg, "caf.logger.console.colored", true);
+    cfg_.binary_file = get_or(cfg, "caf.logger.file.binary",
+                              lg::file::binary);
   }
 
   bool open_file() {
     if (file_verbosity() == log::level::quiet || file_name_.empty())
       return false;
-    file_.open(file_name_, std::ios::out | std::ios::app);
+    auto mode = std::ios::out | std::ios::app;
+    if (cfg_.binary_file)
+      mode |= std::ios::binary;
+    file_.open(file_name_, mode);
     if (!file_) {
       std::cerr << "unable to open log file " << file_name_ << std::endl;
       return false;
@@ -367,8 +426,17 @@ public:
         && none_of(file_filter_.begin(), file_filter_.end(),
                    [&x](std::string_view name) {
                      return name == x.component();
-                   }))
-      render(file_, file_format_, x);
+                   })) {
+      if (binary_writer_) {
+        binary_writer_->append(x);
+        auto bytes = binary_writer_->bytes();
+        file_.write(reinterpret_cast<const char*>(bytes.data()),
+                    static_cast<std::streamsize>(bytes.size()));
+        binary_writer_->clear();
+      } else {
+        render(file_, file_format_, x);
+      }
+    }
   }
 
   void handle_console_event(const log::event& x) {
@@ -443,30 +511,158 @@ public:
     handle_event(*event);
   }
 
+  // -- event buffers ----------------------------------------------------------
+
+  /// Returns the event buffer of the calling thread, creating it if necessary.
+  log_event_buffer& local_buffer() {
+    auto& cache = current_log_event_buffer;
+    if (cache.logger_id == id_)
+      return *cache.buf;
+    // Note: threads may alternate between loggers of different actor systems.
+    //       Hence, we keep one buffer per thread and not per cache miss.
+    std::lock_guard<std::mutex> guard{mtx_};
+    auto& buf = buffers_[std::this_thread::get_id()];
+    if (!buf) {
+      buf = std::make_shared<log_event_buffer>();
+      ++buffers_version_;
+      cache.adopt(buf);
+    } else if (buf->orphaned.load(std::memory_order_acquire)) {
+      // A terminated thread had the same ID. Since the logger thread removes
+      // orphaned buffers only while holding mtx_, we can take over the buffer.
+      buf->orphaned.store(false, std::memory_order_relaxed);
+      cache.adopt(buf);
+    }
+    cache.logger_id = id_;
+    cache.buf = buf;
+    return *buf;
+  }
+
+  /// Wakes up the logger thread.
+  void wakeup() {
+    std::lock_guard<std::mutex> guard{mtx_};
+    cv_.notify_one();
+  }
+
+  /// Wakes up the logger thread if it waits for new events.
+  void wakeup_if_sleeping() {
+    // Pairs with the fence in `wait_for_events`: either the logger thread
+    // observes the new event or we observe `sleeping_ == true`.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping_.load(std::memory_order_relaxed))
+      wakeup();
+  }
+
+  /// Moves all events from the thread-local buffers to `events` and sorts them
+  /// by their timestamp.
+  void drain(std::vector<log::event_ptr>& events) {
+    { // Refresh our snapshot if new threads have registered buffers.
+      std::lock_guard<std::mutex> guard{mtx_};
+      if (snapshot_version_ != buffers_version_) {
+        snapshot_.clear();
+        for (auto& kvp : buffers_)
+          snapshot_.push_back(kvp.second);
+        snapshot_version_ = buffers_version_;
+      }
+    }
+    auto has_orphans = false;
+    for (auto& buf : snapshot_) {
+      // Note: reading the flag first guarantees that we drain all events of a
+      //       terminated thread before removing its buffer.
+      has_orphans |= buf->orphaned.load(std::memory_order_acquire);
+      buf->drain([&events](log::event_ptr&& ptr) {
+        events.push_back(std::move(ptr));
+      });
+    }
+    if (has_orphans)
+      remove_orphaned_buffers();
+    // Note: events from the same thread are already in order, but we need to
+    //       merge events from different threads.
+    std::stable_sort(events.begin(), events.end(),
+                     [](const log::event_ptr& x, const log::event_ptr& y) {
+                       return x->timestamp() < y->timestamp();
+                     });
+  }
+
+  /// Removes the buffers of terminated threads once they are empty.
+  void remove_orphaned_buffers() {
+    std::lock_guard<std::mutex> guard{mtx_};
+    auto removed = false;
+    for (auto i = buffers_.begin(); i != buffers_.end();) {
+      auto& buf = i->second;
+      if (buf->orphaned.load(std::memory_order_acquire) && buf->empty()) {
+        i = buffers_.erase(i);
+        removed = true;
+      } else {
+        ++i;
+      }
+    }
+    if (removed)
+      ++buffers_version_;
+  }
+
+  /// Checks whether any thread-local buffer has pending events.
+  /// @pre `mtx_` is locked.
+  bool has_pending_events() const {
+    return std::any_of(buffers_.begin(), buffers_.end(),
+                       [](const auto& kvp) { return !kvp.second->empty(); });
+  }
+
+  /// Blocks until at least one event becomes available or until `stop` gets
+  /// called.
+  void wait_for_events() {
+    std::unique_lock<std::mutex> guard{mtx_};
+    sleeping_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    cv_.wait(guard, [this] { return stopping_ || has_pending_events(); });
+    sleeping_.store(false, std::memory_order_relaxed);
+  }
+
   // -- thread management ------------------------------------------------------
 
   void run() {
-    // Bail out without printing anything if the first event we receive is the
-    // shutdown (empty) event.
-    if (auto first = queue_.pop(); first == nullptr) {
-      return;
-    } else {
-      if (!open_file() && console_verbosity() == log::level::quiet)
+    std::vector<log::event_ptr> events;
+    // Bail out without printing anything if we receive the shutdown signal
+    // before receiving any event.
+    for (;;) {
+      drain(events);
+      if (!events.empty())
+        break;
+      if (stop_requested())
         return;
-      log_first_line();
-      handle_event(*first);
+      wait_for_events();
     }
-    // Loop until receiving an empty message.
+    if (!open_file() && console_verbosity() == log::level::quiet)
+      return;
+    if (file_ && cfg_.binary_file)
+      binary_writer_.emplace(t0_);
+    log_first_line();
+    // Loop until receiving the shutdown signal, then process all remaining
+    // events before returning.
     for (;;) {
-      if (auto next = queue_.pop()) {
-        handle_event(*next);
-      } else {
-        log_last_line();
-        return;
+      for (auto& event : events)
+        handle_event(*event);
+      events.clear();
+      drain(events);
+      if (events.empty()) {
+        if (stop_requested()) {
+          // Producers may still have added events after our last drain.
+          drain(events);
+          for (auto& event : events)
+            handle_event(*event);
+          log_last_line();
+          return;
+        }
+        wait_for_events();
+        drain(events);
       }
     }
   }
 
+  bool stop_requested() {
+    std::lock_guard<std::mutex> guard{mtx_};
+    return stopping_;
+  }
+
   void start() override {
     parent_thread_ = std::this_thread::get_id();
     if (verbosity() == log::level::quiet)
@@ -503,7 +699,8 @@ public:
     }
     if (cfg_.inline_output) {
       // Open file immediately for inline output.
-      open_file();
+      if (open_file() && cfg_.binary_file)
+        binary_writer_.emplace(t0_);
       log_first_line();
     } else {
       // Note: we don't call system_->launch_thread here since we don't want to
@@ -525,8 +722,12 @@ public:
     }
     if (!thread_.joinable())
       return;
-    // Send an empty message to the logger thread to make it terminate.
-    queue_.push(log::event_ptr{});
+    // Tell the logger thread to process all pending events and terminate.
+    {
+      std::lock_guard<std::mutex> guard{mtx_};
+      stopping_ = true;
+      cv_.notify_one();
+    }
     thread_.join();
   }
 
@@ -557,8 +758,37 @@ public:
   // Stream for file output.
   std::fstream file_;
 
-  // Filled with log events by other threads.
-  detail::sync_ring_buffer<log::event_ptr, queue_size> queue_;
+  // Identifies this logger in the thread-local cache for event buffers.
+  uint64_t id_;
+
+  // Guards buffers_, buffers_version_ and stopping_. Threads also must hold
+  // this lock when taking over an orphaned buffer. Also used for waiting on
+  // cv_.
+  std::mutex mtx_;
+
+  // Signals the logger thread that new events are available.
+  std::condition_variable cv_;
+
+  // Indicates whether the logger thread waits on cv_.
+  std::atomic<bool> sleeping_ = false;
+
+  // Indicates whether stop() has been called.
+  bool stopping_ = false;
+
+  // Stores the event buffer for each thread that has logged an event.
+  std::unordered_map<std::thread::id, log_event_buffer_ptr> buffers_;
+
+  // Increased whenever buffers_ changes.
+  size_t buffers_version_ = 0;
+
+  // Copy of all buffers for the logger thread to access them without lock.
+  std::vector<log_event_buffer_ptr> snapshot_;
+
+  // Stores the value of buffers_version_ when creating snapshot_.
+  size_t snapshot_version_ = 0;
+
+  // Encodes events for the log file when using the binary format.
+  std::optional<detail::binary_log_writer> binary_writer_;
 
   // Stores the assembled name of the log file.
   std::string file_name_;
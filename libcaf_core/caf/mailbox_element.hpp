@@ -6,6 +6,7 @@
 
 #include "caf/actor_control_block.hpp"
 #include "caf/detail/core_export.hpp"
+#include "caf/detail/message_pool.hpp"
 #include "caf/intrusive/singly_linked.hpp"
 #include "caf/message.hpp"
 #include "caf/message_id.hpp"
@@ -62,6 +63,16 @@ public:
   mailbox_element& operator=(mailbox_element&&) = delete;
   mailbox_element& operator=(const mailbox_element&) = delete;
 
+  // -- memory management ------------------------------------------------------
+
+  static void* operator new(size_t size) {
+    return detail::message_pool::allocate(size);
+  }
+
+  static void operator delete(void* ptr) noexcept {
+    detail::message_pool::deallocate(ptr);
+  }
+
   // -- backward compatibility -------------------------------------------------
 
   message& content() noexcept {
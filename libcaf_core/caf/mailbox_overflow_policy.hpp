@@ -0,0 +1,51 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/default_enum_inspect.hpp"
+#include "caf/detail/core_export.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace caf {
+
+/// Selects how a bounded mailbox responds to new messages when it is full.
+/// Urgent messages such as `exit_msg` bypass the limit and are never dropped.
+enum class mailbox_overflow_policy {
+  /// Drops the new message. Requests receive `sec::mailbox_full` as response.
+  drop_newest,
+  /// Accepts the new message and drops the oldest pending message instead.
+  /// Requests receive `sec::mailbox_full` as response.
+  drop_oldest,
+  /// Rejects the new message and sends `sec::mailbox_full` to the sender,
+  /// either as response to a request or as asynchronous error message.
+  reject,
+  /// Blocks the sender until the mailbox has room for the new message. Drops
+  /// the message if the mailbox remains full for too long. An actor that sends
+  /// a message to itself never blocks.
+  back_off,
+};
+
+/// @relates mailbox_overflow_policy
+CAF_CORE_EXPORT std::string to_string(mailbox_overflow_policy);
+
+/// @relates mailbox_overflow_policy
+CAF_CORE_EXPORT bool from_string(std::string_view, mailbox_overflow_policy&);
+
+/// @relates mailbox_overflow_policy
+CAF_CORE_EXPORT bool
+from_integer(std::underlying_type_t<mailbox_overflow_policy>,
+             mailbox_overflow_policy&);
+
+/// @relates mailbox_overflow_policy
+template <class Inspector>
+bool inspect(Inspector& f, mailbox_overflow_policy& x) {
+  return default_enum_inspect(f, x);
+}
+
+} // namespace caf
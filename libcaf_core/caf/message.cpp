@@ -62,26 +62,19 @@ bool load_data(Deserializer& source, message::data_ptr& data) {
              && source.end_object();
     }
     detail::type_id_list_builder ids{msg_size};
-    size_t data_size = 0;
     for (size_t i = 0; i < msg_size; ++i) {
       type_id_t id = 0;
       GUARDED(source.value(id));
-      if (auto meta = detail::global_meta_object_or_null(id))
-        data_size += meta->padded_size;
-      else
+      if (detail::global_meta_object_or_null(id) == nullptr)
         STOP(sec::unknown_type);
       ids.push_back(id);
     }
     GUARDED(source.end_sequence());
     CAF_ASSERT(ids.size() == msg_size);
-    intrusive_ptr<detail::message_data> ptr;
-    if (auto vptr = malloc(sizeof(detail::message_data) + data_size)) {
-      // We don't need to worry about exceptions here: the message_data
-      // constructor as well as `move_to_list` are `noexcept`.
-      ptr.reset(new (vptr) detail::message_data(ids.move_to_list()), false);
-    } else {
+    auto ptr = detail::message_data::try_make_uninitialized(
+      ids.move_to_list());
+    if (ptr == nullptr)
       STOP(sec::runtime_error, "unable to allocate memory");
-    }
     auto pos = ptr->storage();
     auto types = ptr->types();
     auto gmos = detail::global_meta_objects();
@@ -149,15 +142,12 @@ bool load_data(Deserializer& source, message::data_ptr& data) {
     // Deserialize message elements individually.
     detail::type_id_list_builder ids;
     objects.reserve(msg_size);
-    auto data_size = size_t{0};
     for (size_t i = 0; i < msg_size; ++i) {
       auto type = type_id_t{0};
       GUARDED(source.fetch_next_object_type(type));
       if (auto meta_obj = detail::global_meta_object_or_null(type)) {
         ids.push_back(type);
-        auto obj_size = meta_obj->padded_size;
-        data_size += obj_size;
-        unique_void_ptr vptr{malloc(obj_size)};
+        unique_void_ptr vptr{malloc(meta_obj->padded_size)};
         if (vptr == nullptr)
           STOP(sec::runtime_error, "unable to allocate memory");
         meta_obj->default_construct(vptr.get());
@@ -170,14 +160,10 @@ bool load_data(Deserializer& source, message::data_ptr& data) {
     }
     GUARDED(source.end_sequence());
     // Merge elements into a single message data object.
-    intrusive_ptr<detail::message_data> ptr;
-    if (auto vptr = malloc(sizeof(detail::message_data) + data_size)) {
-      // We don't need to worry about exceptions here: the message_data
-      // constructor as well as `move_to_list` are `noexcept`.
-      ptr.reset(new (vptr) detail::message_data(ids.move_to_list()), false);
-    } else {
+    auto ptr = detail::message_data::try_make_uninitialized(
+      ids.move_to_list());
+    if (ptr == nullptr)
       STOP(sec::runtime_error, "unable to allocate memory");
-    }
     auto pos = ptr->storage();
     for (auto& x : objects) {
       // TODO: avoid extra copy by adding move_construct to meta objects
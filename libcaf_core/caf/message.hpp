@@ -224,11 +224,9 @@ message make_message(Ts&&... xs) {
   static_assert((is_complete<type_id<strip_and_convert_t<Ts>>> && ...));
   static constexpr size_t data_size
     = sizeof(message_data) + (padded_size_v<strip_and_convert_t<Ts>> + ...);
-  auto types = make_type_id_list<strip_and_convert_t<Ts>...>();
-  auto vptr = malloc(data_size);
-  if (vptr == nullptr)
-    CAF_RAISE_ERROR(std::bad_alloc, "bad_alloc");
-  auto raw_ptr = new (vptr) message_data(types);
+  auto& layout = message_layout::of<strip_and_convert_t<Ts>...>();
+  auto vptr = message_pool::allocate(data_size);
+  auto raw_ptr = new (vptr) message_data(layout);
   intrusive_cow_ptr<message_data> ptr{raw_ptr, false};
   raw_ptr->init(std::forward<Ts>(xs)...);
   return message{std::move(ptr)};
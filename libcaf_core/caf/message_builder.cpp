@@ -19,29 +19,24 @@ enum to_msg_policy {
 };
 
 template <to_msg_policy Policy, class TypeListBuilder, class ElementVector>
-message to_message_impl(size_t storage_size, TypeListBuilder& types,
-                        ElementVector& elements) {
-  if (storage_size == 0)
+message to_message_impl(TypeListBuilder& types, ElementVector& elements) {
+  if (elements.empty())
     return message{};
-  auto vptr = malloc(sizeof(message_data) + storage_size);
-  if (vptr == nullptr)
-    CAF_RAISE_ERROR(std::bad_alloc, "bad_alloc");
-  message_data* raw_ptr;
+  intrusive_ptr<message_data> ptr;
   if constexpr (Policy == move_msg)
-    raw_ptr = new (vptr) message_data(types.move_to_list());
+    ptr = message_data::make_uninitialized(types.move_to_list());
   else
-    raw_ptr = new (vptr) message_data(types.copy_to_list());
-  intrusive_cow_ptr<message_data> ptr{raw_ptr, false};
-  auto storage = raw_ptr->storage();
+    ptr = message_data::make_uninitialized(types.copy_to_list());
+  auto storage = ptr->storage();
   for (auto& element : elements) {
     if constexpr (Policy == move_msg) {
       storage = element->move_init(storage);
     } else {
       storage = element->copy_init(storage);
     }
-    raw_ptr->inc_constructed_elements();
+    ptr->inc_constructed_elements();
   }
-  return message{std::move(ptr)};
+  return message{message::data_ptr{ptr.release(), false}};
 }
 
 class message_builder_element_adapter final : public message_builder_element {
@@ -79,10 +74,7 @@ message_builder& message_builder::append_from(const caf::message& msg,
     return *this;
   auto end = std::min(msg.size(), first + n);
   for (size_t index = first; index < end; ++index) {
-    auto tid = msg.type_at(index);
-    auto& meta = detail::global_meta_object(tid);
-    storage_size_ += meta.padded_size;
-    types_.push_back(tid);
+    types_.push_back(msg.type_at(index));
     elements_.emplace_back(
       std::make_unique<message_builder_element_adapter>(msg, index));
   }
@@ -90,17 +82,16 @@ message_builder& message_builder::append_from(const caf::message& msg,
 }
 
 void message_builder::clear() noexcept {
-  storage_size_ = 0;
   types_.clear();
   elements_.clear();
 }
 
 message message_builder::to_message() const {
-  return to_message_impl<copy_msg>(storage_size_, types_, elements_);
+  return to_message_impl<copy_msg>(types_, elements_);
 }
 
 message message_builder::move_to_message() {
-  return to_message_impl<move_msg>(storage_size_, types_, elements_);
+  return to_message_impl<move_msg>(types_, elements_);
 }
 
 } // namespace caf
@@ -48,7 +48,6 @@ public:
     using value_type = detail::strip_and_convert_t<T>;
     static_assert(detail::sendable<value_type>);
     using wrapper_type = detail::message_builder_element_impl<value_type>;
-    storage_size_ += detail::padded_size_v<value_type>;
     types_.push_back(type_id_v<value_type>);
     elements_.emplace_back(std::make_unique<wrapper_type>(std::forward<T>(x)));
     return *this;
@@ -102,7 +101,6 @@ public:
   }
 
 private:
-  size_t storage_size_ = 0;
   detail::type_id_list_builder types_;
   std::vector<detail::message_builder_element_ptr> elements_;
 };
@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <utility>
+#include <vector>
 
 namespace caf {
 
@@ -21,6 +22,9 @@ namespace {
 
 thread_local proxy_registry* current_proxy_registry;
 
+using exclusive_guard = std::unique_lock<std::shared_mutex>;
+using shared_guard = std::shared_lock<std::shared_mutex>;
+
 } // namespace
 
 proxy_registry* proxy_registry::current() noexcept {
@@ -45,15 +49,21 @@ proxy_registry::~proxy_registry() {
 }
 
 size_t proxy_registry::count_proxies(const node_id& node) const {
-  std::unique_lock<std::mutex> guard{mtx_};
-  auto i = proxies_.find(node);
-  return i != proxies_.end() ? i->second.size() : 0;
+  size_t result = 0;
+  for (auto& sh : shards_) {
+    shared_guard guard{sh.mtx};
+    auto i = sh.proxies.find(node);
+    if (i != sh.proxies.end())
+      result += i->second.size();
+  }
+  return result;
 }
 
 strong_actor_ptr proxy_registry::get(const node_id& node, actor_id aid) const {
-  std::unique_lock<std::mutex> guard{mtx_};
-  auto i = proxies_.find(node);
-  if (i == proxies_.end())
+  auto& sh = shard_for(aid);
+  shared_guard guard{sh.mtx};
+  auto i = sh.proxies.find(node);
+  if (i == sh.proxies.end())
     return nullptr;
   auto j = i->second.find(aid);
   return j != i->second.end() ? j->second : nullptr;
@@ -61,8 +71,13 @@ strong_actor_ptr proxy_registry::get(const node_id& node, actor_id aid) const {
 
 strong_actor_ptr proxy_registry::get_or_put(const node_id& nid, actor_id aid) {
   auto lg = log::core::trace("nid = {}, aid = {}", nid, aid);
-  std::unique_lock<std::mutex> guard{mtx_};
-  auto& result = proxies_[nid][aid];
+  // Fast path: the proxy already exists.
+  if (auto result = get(nid, aid))
+    return result;
+  // Slow path: check again with exclusive access before creating the proxy.
+  auto& sh = shard_for(aid);
+  exclusive_guard guard{sh.mtx};
+  auto& result = sh.proxies[nid][aid];
   if (!result)
     result = backend_.make_proxy(nid, aid);
   return result;
@@ -73,35 +88,44 @@ proxy_registry::get_all(const node_id& node) const {
   // Reserve at least some memory outside of the critical section.
   std::vector<strong_actor_ptr> result;
   result.reserve(128);
-  std::unique_lock<std::mutex> guard{mtx_};
-  auto i = proxies_.find(node);
-  if (i != proxies_.end())
-    for (auto& kvp : i->second)
-      result.emplace_back(kvp.second);
+  for (auto& sh : shards_) {
+    shared_guard guard{sh.mtx};
+    auto i = sh.proxies.find(node);
+    if (i != sh.proxies.end())
+      for (auto& kvp : i->second)
+        result.emplace_back(kvp.second);
+  }
+  auto by_id = [](const strong_actor_ptr& x, const strong_actor_ptr& y) {
+    return x->id() < y->id();
+  };
+  std::sort(result.begin(), result.end(), by_id);
   return result;
 }
 
 bool proxy_registry::empty() const {
-  std::unique_lock<std::mutex> guard{mtx_};
-  return proxies_.empty();
+  auto is_empty = [](const shard& sh) {
+    shared_guard guard{sh.mtx};
+    return sh.proxies.empty();
+  };
+  return std::all_of(shards_.begin(), shards_.end(), is_empty);
 }
 
 void proxy_registry::erase(const node_id& nid) {
   auto lg = log::core::trace("nid = {}", nid);
-  // Move submap for `nid` to a local variable.
-  proxy_map tmp;
-  {
-    using std::swap;
-    std::unique_lock<std::mutex> guard{mtx_};
-    auto i = proxies_.find(nid);
-    if (i == proxies_.end())
-      return;
-    swap(i->second, tmp);
-    proxies_.erase(i);
+  // Move the submaps for `nid` to a local variable.
+  std::vector<proxy_map> tmp;
+  for (auto& sh : shards_) {
+    exclusive_guard guard{sh.mtx};
+    auto i = sh.proxies.find(nid);
+    if (i != sh.proxies.end()) {
+      tmp.emplace_back(std::move(i->second));
+      sh.proxies.erase(i);
+    }
   }
   // Call kill_proxy outside the critical section.
-  for (auto& kvp : tmp)
-    kill_proxy(kvp.second, exit_reason::remote_link_unreachable);
+  for (auto& submap : tmp)
+    for (auto& kvp : submap)
+      kill_proxy(kvp.second, exit_reason::remote_link_unreachable);
 }
 
 void proxy_registry::erase(const node_id& nid, actor_id aid, error rsn) {
@@ -110,9 +134,10 @@ void proxy_registry::erase(const node_id& nid, actor_id aid, error rsn) {
   strong_actor_ptr erased_proxy;
   {
     using std::swap;
-    std::unique_lock<std::mutex> guard{mtx_};
-    auto i = proxies_.find(nid);
-    if (i != proxies_.end()) {
+    auto& sh = shard_for(aid);
+    exclusive_guard guard{sh.mtx};
+    auto i = sh.proxies.find(nid);
+    if (i != sh.proxies.end()) {
       auto& submap = i->second;
       auto j = submap.find(aid);
       if (j == submap.end())
@@ -120,7 +145,7 @@ void proxy_registry::erase(const node_id& nid, actor_id aid, error rsn) {
       swap(j->second, erased_proxy);
       submap.erase(j);
       if (submap.empty())
-        proxies_.erase(i);
+        sh.proxies.erase(i);
     }
   }
   // Call kill_proxy outside the critical section.
@@ -130,18 +155,19 @@ void proxy_registry::erase(const node_id& nid, actor_id aid, error rsn) {
 
 void proxy_registry::clear() {
   auto lg = log::core::trace("");
-  // Move the content of proxies_ to a local variable.
-  std::unordered_map<node_id, proxy_map> tmp;
-  {
-    using std::swap;
-    std::unique_lock<std::mutex> guard{mtx_};
-    swap(proxies_, tmp);
+  for (auto& sh : shards_) {
+    // Move the content of the shard to a local variable.
+    std::unordered_map<node_id, proxy_map> tmp;
+    {
+      using std::swap;
+      exclusive_guard guard{sh.mtx};
+      swap(sh.proxies, tmp);
+    }
+    // Call kill_proxy outside the critical section.
+    for (auto& kvp : tmp)
+      for (auto& sub_kvp : kvp.second)
+        kill_proxy(sub_kvp.second, exit_reason::remote_link_unreachable);
   }
-  // Call kill_proxy outside the critical section.
-  for (auto& kvp : tmp)
-    for (auto& sub_kvp : kvp.second)
-      kill_proxy(sub_kvp.second, exit_reason::remote_link_unreachable);
-  proxies_.clear();
 }
 
 void proxy_registry::kill_proxy(strong_actor_ptr& ptr, error rsn) {
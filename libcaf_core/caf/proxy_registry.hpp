@@ -6,14 +6,17 @@
 
 #include "caf/actor_addr.hpp"
 #include "caf/actor_proxy.hpp"
+#include "caf/config.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/exit_reason.hpp"
 #include "caf/fwd.hpp"
 #include "caf/node_id.hpp"
 
+#include <array>
 #include <functional>
 #include <map>
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include <utility>
 
@@ -73,7 +76,7 @@ public:
   /// or creates a new (default) proxy instance.
   strong_actor_ptr get_or_put(const node_id& nid, actor_id aid);
 
-  /// Returns all known proxies.
+  /// Returns all known proxies for `node`, ordered by their actor ID.
   std::vector<strong_actor_ptr> get_all(const node_id& node) const;
 
   /// Deletes all proxies for `node`.
@@ -105,13 +108,30 @@ public:
   }
 
 private:
-  /// @pre mtx_ is locked
+  /// Stores the proxies for a subset of all actor IDs. Lookups only acquire a
+  /// shared lock on a single shard, which allows many threads to deserialize
+  /// actor handles concurrently.
+  struct alignas(CAF_CACHE_LINE_SIZE) shard {
+    mutable std::shared_mutex mtx;
+    std::unordered_map<node_id, proxy_map> proxies;
+  };
+
+  /// Number of independently locked shards.
+  static constexpr size_t num_shards = 16;
+
+  shard& shard_for(actor_id aid) noexcept {
+    return shards_[aid % num_shards];
+  }
+
+  const shard& shard_for(actor_id aid) const noexcept {
+    return shards_[aid % num_shards];
+  }
+
   void kill_proxy(strong_actor_ptr&, error);
 
   actor_system& system_;
   backend& backend_;
-  mutable std::mutex mtx_;
-  std::unordered_map<node_id, proxy_map> proxies_;
+  std::array<shard, num_shards> shards_;
 };
 
 } // namespace caf
@@ -0,0 +1,134 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/proxy_registry.hpp"
+
+#include "caf/test/fixture/deterministic.hpp"
+#include "caf/test/test.hpp"
+
+#include "caf/event_based_actor.hpp"
+#include "caf/forwarding_actor_proxy.hpp"
+#include "caf/make_actor.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace caf;
+
+namespace {
+
+struct fixture : test::fixture::deterministic, proxy_registry::backend {
+  // Counts how many proxies the registry has created.
+  std::atomic<size_t> created = 0;
+
+  // Dummy broker that drops all messages from the proxies.
+  actor broker;
+
+  node_id earth;
+
+  node_id mars;
+
+  proxy_registry uut;
+
+  fixture() : uut(sys, *this) {
+    broker = sys.spawn([](event_based_actor* self) -> behavior {
+      self->set_default_handler(drop);
+      return {
+        [](int32_t) {},
+      };
+    });
+    earth = *make_node_id(1, "0102030405060708090A0B0C0D0E0F1011121314");
+    mars = *make_node_id(2, "1402030405060708090A0B0C0D0E0F1011121314");
+  }
+
+  ~fixture() {
+    uut.clear();
+    anon_send_exit(broker, exit_reason::user_shutdown);
+    dispatch_messages();
+  }
+
+  strong_actor_ptr make_proxy(node_id nid, actor_id aid) override {
+    ++created;
+    actor_config cfg;
+    return make_actor<forwarding_actor_proxy, strong_actor_ptr>(aid, nid, &sys,
+                                                                cfg, broker);
+  }
+
+  void set_last_hop(node_id*) override {
+    // nop
+  }
+};
+
+} // namespace
+
+WITH_FIXTURE(fixture) {
+
+TEST("get_or_put creates each proxy only once") {
+  check(uut.empty());
+  check_eq(uut.get(earth, 42), nullptr);
+  auto proxy = uut.get_or_put(earth, 42);
+  if (!check_ne(proxy, nullptr))
+    return;
+  check_eq(proxy->id(), 42u);
+  check_eq(proxy->node(), earth);
+  check_eq(uut.get_or_put(earth, 42), proxy);
+  check_eq(uut.get(earth, 42), proxy);
+  check_eq(uut.get(mars, 42), nullptr);
+  check_eq(created.load(), 1u);
+  check(!uut.empty());
+}
+
+TEST("proxies for a node may live in different shards") {
+  for (actor_id aid = 1; aid <= 40; ++aid) {
+    uut.get_or_put(earth, aid);
+    uut.get_or_put(mars, aid);
+  }
+  check_eq(uut.count_proxies(earth), 40u);
+  check_eq(uut.count_proxies(mars), 40u);
+  auto proxies = uut.get_all(earth);
+  if (check_eq(proxies.size(), 40u)) {
+    for (size_t index = 0; index < proxies.size(); ++index)
+      check_eq(proxies[index]->id(), index + 1);
+  }
+  SECTION("erasing a single proxy leaves the others intact") {
+    uut.erase(earth, 7);
+    check_eq(uut.get(earth, 7), nullptr);
+    check_eq(uut.count_proxies(earth), 39u);
+    check_eq(uut.count_proxies(mars), 40u);
+  }
+  SECTION("erasing a node removes all of its proxies") {
+    auto proxy = uut.get(earth, 3);
+    uut.erase(earth);
+    check(proxy->get()->getf(abstract_actor::is_terminated_flag));
+    check_eq(uut.count_proxies(earth), 0u);
+    check(uut.get_all(earth).empty());
+    check_eq(uut.count_proxies(mars), 40u);
+    uut.erase(mars);
+    check(uut.empty());
+  }
+  SECTION("clearing the registry removes all proxies") {
+    uut.clear();
+    check(uut.empty());
+    check_eq(uut.count_proxies(earth), 0u);
+    check_eq(uut.count_proxies(mars), 0u);
+  }
+}
+
+TEST("concurrent lookups agree on a single proxy per actor") {
+  constexpr size_t num_threads = 4;
+  std::vector<std::vector<strong_actor_ptr>> results(num_threads);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < num_threads; ++i)
+    threads.emplace_back([this, &xs = results[i]] {
+      for (actor_id aid = 1; aid <= 100; ++aid)
+        xs.push_back(uut.get_or_put(earth, aid));
+    });
+  for (auto& thread : threads)
+    thread.join();
+  check_eq(created.load(), 100u);
+  for (size_t i = 1; i < num_threads; ++i)
+    check(results[i] == results[0]);
+}
+
+} // WITH_FIXTURE(fixture)
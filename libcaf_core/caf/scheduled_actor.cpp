@@ -25,6 +25,8 @@
 #include "caf/send.hpp"
 #include "caf/stream.hpp"
 
+#include <utility>
+
 using namespace std::string_literals;
 
 namespace caf {
@@ -142,6 +144,7 @@ scheduled_actor::scheduled_actor(actor_config& cfg)
 }
 
 scheduled_actor::~scheduled_actor() {
+  return_batch();
   unstash();
   if (mailbox_ == &default_mailbox_)
     default_mailbox_.~default_mailbox();
@@ -158,11 +161,8 @@ bool scheduled_actor::enqueue(mailbox_element_ptr ptr, scheduler* sched) {
   CAF_LOG_SEND_EVENT(ptr);
   auto mid = ptr->mid;
   auto sender = ptr->sender;
-  auto collects_metrics = getf(abstract_actor::collects_metrics_flag);
-  if (collects_metrics) {
+  if (getf(abstract_actor::collects_metrics_flag))
     ptr->set_enqueue_time();
-    metrics_.mailbox_size->inc();
-  }
   switch (mailbox().push_back(std::move(ptr))) {
     case intrusive::inbox_result::unblocked_reader: {
       CAF_LOG_ACCEPT_EVENT(true);
@@ -179,11 +179,13 @@ bool scheduled_actor::enqueue(mailbox_element_ptr ptr, scheduler* sched) {
       // enqueued to a running actors' mailbox; nothing to do
       CAF_LOG_ACCEPT_EVENT(false);
       return true;
+    case intrusive::inbox_result::queue_full:
+      // the mailbox dropped the message and took care of the sender
+      CAF_LOG_REJECT_EVENT();
+      return false;
     default: { // intrusive::inbox_result::queue_closed
       CAF_LOG_REJECT_EVENT();
       home_system().base_metrics().rejected_messages->inc();
-      if (collects_metrics)
-        metrics_.mailbox_size->dec();
       if (mid.is_request()) {
         detail::sync_request_bouncer f{exit_reason()};
         f(sender, mid);
@@ -199,6 +201,10 @@ mailbox_element* scheduled_actor::peek_at_next_mailbox_element() {
                           : std::get<0>(*awaited_responses_.begin()));
 }
 
+size_t scheduled_actor::approximate_mailbox_size() const noexcept {
+  return mailbox_->approximate_size();
+}
+
 // -- overridden functions of local_actor --------------------------------------
 
 const char* scheduled_actor::name() const {
@@ -272,10 +278,10 @@ resumable::resume_result scheduled_actor::resume(scheduler* sched,
     if (consumed > 0)
       set_receive_timeout();
   };
-  mailbox_element_ptr ptr;
   while (consumed < max_throughput) {
-    auto ptr = mailbox().pop_front();
-    if (!ptr) {
+    // Take as many messages as we may process from the mailbox at once.
+    if (batch_.empty()
+        && mailbox().pop_front_n(batch_, max_throughput - consumed) == 0) {
       if (mailbox().try_block()) {
         reset_timeouts_if_needed();
         log::core::debug("mailbox empty: await new messages");
@@ -283,11 +289,12 @@ resumable::resume_result scheduled_actor::resume(scheduler* sched,
       }
       continue; // Interrupted by a new message, try again.
     }
+    auto ptr = batch_.pop_front();
     auto res = run_with_metrics(*ptr, [this, &ptr, &consumed] {
       auto res = reactivate(*ptr);
       switch (res) {
         case activation_result::success:
-          ++consumed;
+          consumed += 1 + std::exchange(batch_extra_, 0);
           unstash();
           break;
         case activation_result::skipped:
@@ -302,6 +309,7 @@ resumable::resume_result scheduled_actor::resume(scheduler* sched,
       return resumable::done;
   }
   reset_timeouts_if_needed();
+  return_batch();
   if (mailbox().try_block()) {
     log::core::debug("mailbox empty: await new messages");
     return resumable::awaiting_message;
@@ -788,6 +796,14 @@ invoke_message_result scheduled_actor::consume(mailbox_element& x) {
         log::core::debug("handled system message");
         return invoke_message_result::consumed;
       case message_category::ordinary: {
+        if (!batch_handlers_.empty() && x.mid.is_async()
+            && x.payload.size() == 1) {
+          auto i = batch_handlers_.find(x.payload.type_at(0));
+          if (i != batch_handlers_.end()) {
+            consume_batch(*i->second, x);
+            return invoke_message_result::consumed;
+          }
+        }
         detail::default_invoke_result_visitor<scheduled_actor> visitor{this};
         if (!bhvr_stack_.empty()) {
           auto& bhvr = bhvr_stack_.back();
@@ -1119,11 +1135,57 @@ void scheduled_actor::try_push_stream(uint64_t local_id) {
 
 void scheduled_actor::unstash() {
   while (auto stashed = stash_.pop())
-    mailbox().push_front(mailbox_element_ptr{stashed});
+    unstash(stashed);
+}
+
+void scheduled_actor::unstash(mailbox_element* ptr) {
+  // While processing a batch, the remaining messages of the batch are the
+  // front of the mailbox.
+  if (!batch_.empty())
+    batch_.push_front(ptr);
+  else
+    mailbox().push_front(mailbox_element_ptr{ptr});
 }
 
 void scheduled_actor::do_unstash(mailbox_element_ptr ptr) {
-  mailbox().push_front(std::move(ptr));
+  unstash(ptr.release());
+}
+
+void scheduled_actor::return_batch() {
+  if (batch_.empty())
+    return;
+  // Reverse the order, because we put each element to the front.
+  intrusive::stack<mailbox_element> tmp;
+  while (auto ptr = batch_.pop_front())
+    tmp.push(ptr.release());
+  while (auto ptr = tmp.pop())
+    mailbox().push_front(mailbox_element_ptr{ptr});
+}
+
+void scheduled_actor::consume_batch(callback<void(span<message>)>& fn,
+                                    mailbox_element& x) {
+  auto type = x.payload.type_at(0);
+  auto matches = [type](const mailbox_element& y) {
+    return y.mid.is_async() && y.payload.size() == 1
+           && y.payload.type_at(0) == type;
+  };
+  batch_payloads_.clear();
+  batch_payloads_.emplace_back(std::move(x.payload));
+  if (!batch_.empty()) {
+    intrusive::linked_list<mailbox_element> others;
+    batch_.drain([&](mailbox_element* ptr) {
+      if (matches(*ptr)) {
+        batch_payloads_.emplace_back(std::move(ptr->payload));
+        delete ptr;
+      } else {
+        others.push_back(ptr);
+      }
+    });
+    batch_.splice(others);
+  }
+  batch_extra_ = batch_payloads_.size() - 1;
+  fn(make_span(batch_payloads_));
+  batch_payloads_.clear();
 }
 
 void scheduled_actor::cancel_flows_and_streams() {
@@ -1152,21 +1214,21 @@ void scheduled_actor::cancel_flows_and_streams() {
 }
 
 void scheduled_actor::close_mailbox(const error& reason) {
-  // Discard stashed messages.
-  auto dropped = size_t{0};
-  if (!stash_.empty()) {
+  // Discard stashed messages and the remainder of the current batch.
+  if (!stash_.empty() || !batch_.empty()) {
     detail::sync_request_bouncer bounce{reason};
-    while (auto stashed = stash_.pop()) {
-      bounce(*stashed);
-      delete stashed;
-      ++dropped;
-    }
+    auto bounce_and_delete = [&bounce](mailbox_element* ptr) {
+      bounce(*ptr);
+      delete ptr;
+    };
+    while (auto stashed = stash_.pop())
+      bounce_and_delete(stashed);
+    batch_.drain(bounce_and_delete);
   }
   // Clear mailbox.
   if (!mailbox().closed())
-    dropped += mailbox().close(reason);
-  if (dropped > 0 && metrics_.mailbox_size)
-    metrics_.mailbox_size->dec(static_cast<int64_t>(dropped));
+    mailbox().close(reason);
+  stop_reporting_mailbox_size();
 }
 
 void scheduled_actor::force_close_mailbox() {
@@ -9,6 +9,7 @@
 #include "caf/action.hpp"
 #include "caf/actor_traits.hpp"
 #include "caf/async/fwd.hpp"
+#include "caf/callback.hpp"
 #include "caf/config.hpp"
 #include "caf/cow_string.hpp"
 #include "caf/detail/behavior_stack.hpp"
@@ -21,6 +22,7 @@
 #include "caf/flow/fwd.hpp"
 #include "caf/flow/multicaster.hpp"
 #include "caf/fwd.hpp"
+#include "caf/intrusive/linked_list.hpp"
 #include "caf/intrusive/stack.hpp"
 #include "caf/invoke_message_result.hpp"
 #include "caf/local_actor.hpp"
@@ -28,13 +30,16 @@
 #include "caf/ref.hpp"
 #include "caf/repeat.hpp"
 #include "caf/resumable.hpp"
+#include "caf/span.hpp"
 #include "caf/telemetry/timer.hpp"
 #include "caf/timespan.hpp"
+#include "caf/type_id.hpp"
 #include "caf/unordered_flat_map.hpp"
 
 #include <forward_list>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 #ifdef CAF_ENABLE_EXCEPTIONS
 #  include <exception>
@@ -145,6 +150,9 @@ public:
   /// Function object for handling timeouts.
   using idle_handler = std::function<void()>;
 
+  /// Function object for handling a batch of messages with the same type.
+  using batch_handler = unique_callback_ptr<void(span<message>)>;
+
 #ifdef CAF_ENABLE_EXCEPTIONS
   /// Function object for handling exit messages.
   using exception_handler = std::function<error(pointer, std::exception_ptr&)>;
@@ -200,6 +208,8 @@ public:
 
   mailbox_element* peek_at_next_mailbox_element() override;
 
+  size_t approximate_mailbox_size() const noexcept override;
+
   // -- overridden functions of local_actor ------------------------------------
 
   const char* name() const override;
@@ -371,6 +381,36 @@ public:
   }
 #endif // CAF_ENABLE_EXCEPTIONS
 
+  /// Sets a handler that receives all pending asynchronous messages that
+  /// consist of a single `T` at once. When processing such a message, the
+  /// actor also removes all other messages of this type from the current batch
+  /// of up to `max-throughput` messages and passes their content to `fun`.
+  /// Hence, messages of type `T` may overtake other messages. Requests and
+  /// responses still go to the regular message handlers.
+  /// @pre `T` is not a system message type such as `exit_msg`.
+  template <class T, class F>
+  void set_batch_handler(F fun) {
+    static_assert(std::is_invocable_v<F&, span<T>>,
+                  "the batch handler must accept a span<T>");
+    auto handler = [fn{std::move(fun)},
+                    buf{std::vector<T>{}}](span<message> xs) mutable {
+      buf.clear();
+      buf.reserve(xs.size());
+      for (auto& x : xs)
+        buf.emplace_back(std::move(x.get_mutable_as<T>(0)));
+      fn(make_span(buf));
+    };
+    batch_handlers_.insert_or_assign(type_id_v<T>,
+                                     make_type_erased_callback(
+                                       std::move(handler)));
+  }
+
+  /// Removes the batch handler for `T`.
+  template <class T>
+  void unset_batch_handler() {
+    batch_handlers_.erase(type_id_v<T>);
+  }
+
   /// Sets a custom handler for timeouts that trigger after *not* receiving
   /// a message for a certain amount of time.
   template <class RefType, class RepeatType>
@@ -784,6 +824,16 @@ private:
   /// Places all messages from the `stash_` back into the mailbox.
   void unstash();
 
+  /// Places a stashed message back into the mailbox or in front of the current
+  /// batch if it has any messages left.
+  void unstash(mailbox_element* ptr);
+
+  /// Places all messages from `batch_` back into the mailbox.
+  void return_batch();
+
+  /// Passes `x` and all matching messages from `batch_` to `fn`.
+  void consume_batch(callback<void(span<message>)>& fn, mailbox_element& x);
+
   template <class F>
   activation_result run_with_metrics(mailbox_element& x, F body) {
     if (metrics_.mailbox_time) {
@@ -793,7 +843,6 @@ private:
       if (res != activation_result::skipped) {
         telemetry::timer::observe(metrics_.processing_time, t0);
         metrics_.mailbox_time->observe(mbox_time);
-        metrics_.mailbox_size->dec();
       }
       return res;
     } else {
@@ -894,6 +943,21 @@ private:
   /// Stashes skipped messages until the actor processes the next message.
   intrusive::stack<mailbox_element> stash_;
 
+  /// Stores messages that `resume` took from the mailbox in one go but did not
+  /// process yet. Logically, these messages are still at the front of the
+  /// mailbox.
+  intrusive::linked_list<mailbox_element> batch_;
+
+  /// Stores handlers for consuming multiple messages of the same type at once.
+  unordered_flat_map<type_id_t, batch_handler> batch_handlers_;
+
+  /// Buffer for passing the content of batched messages to a batch handler.
+  std::vector<message> batch_payloads_;
+
+  /// Number of messages that the last call to `consume_batch` processed in
+  /// addition to the current message.
+  size_t batch_extra_ = 0;
+
   union {
     /// The default mailbox instance that we use if the user does not configure
     /// a mailbox via the ::actor_config.
@@ -11,6 +11,7 @@
 #include "caf/actor_system_config.hpp"
 #include "caf/config.hpp"
 #include "caf/event_based_actor.hpp"
+#include "caf/mail_cache.hpp"
 #include "caf/scoped_actor.hpp"
 
 using namespace caf;
@@ -206,6 +207,109 @@ TEST("actors can override the default exception handler") {
 
 #endif // CAF_ENABLE_EXCEPTIONS
 
+// -- batched message processing -----------------------------------------------
+
+using string_list = std::vector<std::string>;
+
+// Joins all lines of a log into a single string for sending it to a test.
+std::string join(const string_list& lines) {
+  std::string result;
+  for (const auto& line : lines) {
+    if (!result.empty())
+      result += " | ";
+    result += line;
+  }
+  return result;
+}
+
+TEST("batch handlers receive all pending messages of their type at once") {
+  actor_system_config cfg;
+  actor_system system{cfg};
+  scoped_actor self{system};
+  // Note: messages that an actor sends to itself during initialization are all
+  //       waiting in the mailbox when the actor processes its first message.
+  auto observer = actor{self};
+  self->spawn([observer](event_based_actor* aut) -> behavior {
+    auto log = std::make_shared<string_list>();
+    aut->set_batch_handler<int32_t>([log](span<int32_t> xs) {
+      std::string line;
+      for (auto x : xs) {
+        if (!line.empty())
+          line += ' ';
+        line += std::to_string(x);
+      }
+      log->push_back(std::move(line));
+    });
+    aut->mail(int32_t{1}).send(aut);
+    aut->mail(int32_t{2}).send(aut);
+    aut->mail("a").send(aut);
+    aut->mail(int32_t{3}).send(aut);
+    aut->mail(ok_atom_v).send(aut);
+    return {
+      [log](const std::string& str) { log->push_back(str); },
+      [aut, log, observer](ok_atom) {
+        aut->mail(join(*log)).send(observer);
+        aut->quit();
+      },
+    };
+  });
+  self->receive([this](const std::string& log) { check_eq(log, "1 2 3 | a"); });
+}
+
+TEST("requests bypass batch handlers") {
+  actor_system_config cfg;
+  actor_system system{cfg};
+  scoped_actor self{system};
+  auto aut = self->spawn([](event_based_actor* aut) -> behavior {
+    aut->set_batch_handler<int32_t>([](span<int32_t>) {
+      test::runnable::current().fail("batch handler called for a request");
+    });
+    return {
+      [](int32_t x) { return x * 2; },
+    };
+  });
+  self->mail(int32_t{21})
+    .request(aut, infinite)
+    .receive([this](int32_t x) { check_eq(x, 42); },
+             [this](const error& err) { fail("unexpected error: {}", err); });
+  self->send_exit(aut, exit_reason::user_shutdown);
+}
+
+TEST("actors keep the order of stashed messages within a batch") {
+  actor_system_config cfg;
+  actor_system system{cfg};
+  scoped_actor self{system};
+  auto observer = actor{self};
+  self->spawn([observer](event_based_actor* aut) -> behavior {
+    auto log = std::make_shared<string_list>();
+    auto cache = std::make_shared<mail_cache>(aut, 10);
+    aut->mail(int32_t{1}).send(aut);
+    aut->mail(int32_t{2}).send(aut);
+    aut->mail("a").send(aut);
+    aut->mail(int32_t{3}).send(aut);
+    return {
+      [aut, log, cache, observer](message msg) {
+        // Stash integers until receiving the first string.
+        if (!msg.match_elements<std::string>()) {
+          cache->stash(std::move(msg));
+          return;
+        }
+        log->push_back(msg.get_as<std::string>(0));
+        aut->become([aut, log, observer](int32_t x) {
+          log->push_back(std::to_string(x));
+          if (x == 3) {
+            aut->mail(join(*log)).send(observer);
+            aut->quit();
+          }
+        });
+        cache->unstash();
+      },
+    };
+  });
+  self->receive(
+    [this](const std::string& log) { check_eq(log, "a | 1 | 2 | 3"); });
+}
+
 } // namespace
 
 WITH_FIXTURE(caf::test::fixture::deterministic) {
@@ -14,6 +14,7 @@
 #include "caf/detail/cleanup_and_release.hpp"
 #include "caf/detail/default_thread_count.hpp"
 #include "caf/detail/double_ended_queue.hpp"
+#include "caf/detail/lock_free_double_ended_queue.hpp"
 #include "caf/logger.hpp"
 #include "caf/scheduled_actor.hpp"
 #include "caf/scoped_actor.hpp"
@@ -27,6 +28,7 @@
 #include <memory>
 #include <random>
 #include <thread>
+#include <type_traits>
 
 namespace caf {
 
@@ -38,7 +40,11 @@ namespace {
 
 namespace work_stealing {
 
+// Points to the worker that runs on the current thread (if any).
+thread_local scheduler* current_worker = nullptr;
+
 // Holds job queue of a worker and a random number generator.
+template <class Queue>
 struct worker_data {
   // Configuration for aggressive/moderate/relaxed poll strategies.
   struct poll_strategy {
@@ -85,7 +91,7 @@ struct worker_data {
 
   // This queue is exposed to other workers that may attempt to steal jobs
   // from it and the central scheduling unit can push new jobs to the queue.
-  detail::double_ended_queue<resumable> queue;
+  Queue queue;
 
   // Needed to generate pseudo random numbers.
   std::default_random_engine rengine;
@@ -94,12 +100,15 @@ struct worker_data {
 };
 
 /// Implementation of the work stealing worker class.
+template <class Queue>
 class worker : public scheduler {
 public:
   using job_ptr = resumable*;
 
+  using data_type = worker_data<Queue>;
+
   template <class SchedulerImpl>
-  worker(size_t worker_id, SchedulerImpl*, const worker_data& init,
+  worker(size_t worker_id, SchedulerImpl*, const data_type& init,
          size_t throughput)
     : max_throughput_(throughput), id_(worker_id), data_(init) {
     // nop
@@ -131,7 +140,16 @@ public:
 
   void delay(job_ptr job) override {
     CAF_ASSERT(job != nullptr);
-    data_.queue.prepend(job);
+    using locked_queue = detail::double_ended_queue<resumable>;
+    if constexpr (std::is_same_v<Queue, locked_queue>) {
+      data_.queue.prepend(job);
+    } else {
+      // Only the owner may access the front of a lock-free queue.
+      if (current_worker == this)
+        data_.queue.prepend(job);
+      else
+        data_.queue.append(job);
+    }
   }
 
   size_t id() const {
@@ -142,7 +160,7 @@ public:
     return this_thread_;
   }
 
-  worker_data& data() {
+  data_type& data() {
     return data_;
   }
 
@@ -201,6 +219,7 @@ private:
   template <typename Parent>
   void run(Parent* parent) {
     CAF_SET_LOGGER_SYS(&parent->system());
+    current_worker = this;
     // scheduling loop
     for (;;) {
       auto job = policy_dequeue(parent);
@@ -240,10 +259,11 @@ private:
   size_t id_;
 
   // Policy-specific data.
-  worker_data data_;
+  data_type data_;
 };
 
 /// Policy-based implementation of the scheduler base class.
+template <class Queue>
 class scheduler_impl : public scheduler {
 public:
   explicit scheduler_impl(actor_system& sys) : sys_(&sys) {
@@ -254,7 +274,7 @@ public:
                           detail::default_thread_count());
   }
 
-  using worker_type = worker;
+  using worker_type = worker<Queue>;
 
   worker_type* worker_by_id(size_t x) {
     return workers_[x].get();
@@ -287,7 +307,7 @@ public:
 
   void start() override {
     // Create initial state for all workers.
-    worker_data init{this};
+    worker_data<Queue> init{this};
     // Prepare workers vector.
     workers_.reserve(num_workers_);
     // Create worker instances.
@@ -633,7 +653,16 @@ private:
 // -- factory functions --------------------------------------------------------
 
 std::unique_ptr<scheduler> scheduler::make_work_stealing(actor_system& sys) {
-  return std::make_unique<work_stealing::scheduler_impl>(sys);
+  using impl_t
+    = work_stealing::scheduler_impl<detail::double_ended_queue<resumable>>;
+  return std::make_unique<impl_t>(sys);
+}
+
+std::unique_ptr<scheduler>
+scheduler::make_lock_free_work_stealing(actor_system& sys) {
+  using impl_t = work_stealing::scheduler_impl<
+    detail::lock_free_double_ended_queue<resumable>>;
+  return std::make_unique<impl_t>(sys);
 }
 
 std::unique_ptr<scheduler> scheduler::make_work_sharing(actor_system& sys) {
@@ -21,6 +21,12 @@ public:
 
   static std::unique_ptr<scheduler> make_work_stealing(actor_system& sys);
 
+  /// Creates a work-stealing scheduler that uses lock-free Chase-Lev deques
+  /// for its workers and lock-free injection queues for jobs from other
+  /// threads.
+  static std::unique_ptr<scheduler>
+  make_lock_free_work_stealing(actor_system& sys);
+
   static std::unique_ptr<scheduler> make_work_sharing(actor_system& sys);
 
   // -- constructors, destructors, and assignment operators --------------------
@@ -109,9 +109,10 @@ OUTLINE("scheduling resumables") {
     }
   }
   EXAMPLES = R"(
-    |    sched    |
-    | sharing     |
-    | stealing    |
+    | sched              |
+    | sharing            |
+    | stealing           |
+    | lock-free-stealing |
   )";
 }
 
@@ -174,8 +175,9 @@ OUTLINE("scheduling units that are awaiting") {
     }
   }
   EXAMPLES = R"(
-    |    sched    |
-    | sharing     |
-    | stealing    |
+    | sched              |
+    | sharing            |
+    | stealing           |
+    | lock-free-stealing |
   )";
 }
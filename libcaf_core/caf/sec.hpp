@@ -178,6 +178,9 @@ enum class sec : uint8_t {
   /// Signals that a supervisor failed to start a new worker because too many
   /// workers failed in a short period of time.
   too_many_worker_failures = 80,
+  /// Signals that the receiver dropped a message because its mailbox reached
+  /// its capacity.
+  mailbox_full,
 };
 // --(rst-sec-end)--
 
@@ -18,6 +18,8 @@
 #include "caf/serializer.hpp"
 #include "caf/string_algorithms.hpp"
 
+#include <cmath>
+#include <limits>
 #include <regex>
 #include <unordered_set>
 #include <variant>
@@ -933,6 +935,115 @@ SCENARIO("binary serializer and deserializer handle vectors of booleans") {
   }
 }
 
+SCENARIO("binary serializer and deserializer process numeric vectors in bulk") {
+  // Serializes each element individually for comparing the wire format.
+  auto element_wise = [](const auto& xs) {
+    byte_buffer buf;
+    binary_serializer sink{buf};
+    sink.begin_sequence(xs.size());
+    for (auto x : xs)
+      sink.value(x);
+    sink.end_sequence();
+    return buf;
+  };
+  auto bulk = [this](const auto& xs) {
+    byte_buffer buf;
+    binary_serializer sink{buf};
+    check(sink.apply(xs));
+    return buf;
+  };
+  GIVEN("vectors of integers") {
+    auto i16s = std::vector<int16_t>{0, 1, -1, 0x1234, INT16_MIN, INT16_MAX};
+    auto u32s = std::vector<uint32_t>{0, 1, 0xDEADBEEF, UINT32_MAX};
+    auto i64s = std::vector<int64_t>{0, -42, INT64_MIN, INT64_MAX};
+    WHEN("serializing them") {
+      THEN("the output matches the element-wise format") {
+        check_eq(bulk(i16s), element_wise(i16s));
+        check_eq(bulk(u32s), element_wise(u32s));
+        check_eq(bulk(i64s), element_wise(i64s));
+      }
+      AND_THEN("deserializing the result produces the values again") {
+        byte_buffer buf;
+        binary_serializer sink{buf};
+        check(sink.apply(i16s) && sink.apply(u32s) && sink.apply(i64s));
+        auto i16_copy = std::vector<int16_t>{7};
+        auto u32_copy = std::vector<uint32_t>{};
+        auto i64_copy = std::vector<int64_t>{};
+        binary_deserializer source{buf};
+        check(source.apply(i16_copy));
+        check(source.apply(u32_copy));
+        check(source.apply(i64_copy));
+        check_eq(i16_copy, i16s);
+        check_eq(u32_copy, u32s);
+        check_eq(i64_copy, i64s);
+        check_eq(source.remaining(), 0u);
+      }
+    }
+  }
+  GIVEN("vectors of floating point numbers with special values") {
+    using dlimits = std::numeric_limits<double>;
+    using flimits = std::numeric_limits<float>;
+    auto doubles = std::vector<double>{0.0,
+                                       -0.0,
+                                       1.5,
+                                       -3.25e100,
+                                       dlimits::max(),
+                                       dlimits::min(),
+                                       dlimits::infinity(),
+                                       -dlimits::infinity()};
+    auto floats = std::vector<float>{0.0f, -2.5f, flimits::lowest(),
+                                     flimits::infinity()};
+    WHEN("serializing them") {
+      THEN("the output matches the element-wise format") {
+        check_eq(bulk(doubles), element_wise(doubles));
+        check_eq(bulk(floats), element_wise(floats));
+      }
+      AND_THEN("deserializing the result produces the values again") {
+        byte_buffer buf;
+        binary_serializer sink{buf};
+        check(sink.apply(doubles) && sink.apply(floats));
+        auto doubles_copy = std::vector<double>{};
+        auto floats_copy = std::vector<float>{};
+        binary_deserializer source{buf};
+        check(source.apply(doubles_copy));
+        check(source.apply(floats_copy));
+        check_eq(doubles_copy, doubles);
+        check_eq(floats_copy, floats);
+      }
+    }
+    WHEN("serializing NaN") {
+      THEN("deserializing the result produces NaN again") {
+        auto nans = std::vector<double>{dlimits::quiet_NaN(), 1.0};
+        byte_buffer buf;
+        binary_serializer sink{buf};
+        check(sink.apply(nans));
+        check_eq(buf, element_wise(nans));
+        auto copy = std::vector<double>{};
+        binary_deserializer source{buf};
+        check(source.apply(copy));
+        if (check_eq(copy.size(), 2u)) {
+          check(std::isnan(copy[0]));
+          check(copy[1] == 1.0);
+        }
+      }
+    }
+  }
+  GIVEN("a truncated input") {
+    WHEN("deserializing a vector from it") {
+      THEN("the deserializer reports end_of_stream") {
+        byte_buffer buf;
+        binary_serializer sink{buf};
+        check(sink.apply(std::vector<int32_t>{1, 2, 3}));
+        buf.pop_back();
+        auto copy = std::vector<int32_t>{};
+        binary_deserializer source{buf};
+        check(!source.apply(copy));
+        check_eq(source.get_error(), sec::end_of_stream);
+      }
+    }
+  }
+}
+
 } // WITH_FIXTURE(fixture)
 
 TEST_INIT() {
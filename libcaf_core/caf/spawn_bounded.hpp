@@ -0,0 +1,44 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/actor_config.hpp"
+#include "caf/actor_system.hpp"
+#include "caf/detail/bounded_mailbox.hpp"
+#include "caf/infer_handle.hpp"
+#include "caf/mailbox_overflow_policy.hpp"
+#include "caf/scheduled_actor.hpp"
+#include "caf/spawn_options.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace caf {
+
+/// Returns a new function-based actor with a bounded mailbox that holds at
+/// most `capacity` pending messages. Once full, the mailbox applies `policy`
+/// to new messages. Overrides the system-wide settings `caf.mailbox.capacity`
+/// and `caf.mailbox.overflow-policy` for this actor.
+/// @pre `capacity > 0`
+template <spawn_options Os = no_spawn_options, class F, class... Ts>
+infer_handle_from_fun_t<F> spawn_bounded(actor_system& sys, size_t capacity,
+                                         mailbox_overflow_policy policy, F fun,
+                                         Ts&&... xs) {
+  using impl = infer_impl_from_fun_t<F>;
+  static constexpr bool spawnable = detail::spawnable<F, impl, Ts...>();
+  static_assert(spawnable,
+                "cannot spawn function-based actor with given arguments");
+  static_assert(std::is_base_of_v<scheduled_actor, impl>,
+                "bounded mailboxes require event-based actors");
+  // The actor creates its mailbox in its constructor, i.e., the factory only
+  // needs to outlive the call to `spawn_functor`.
+  detail::bounded_mailbox_factory factory{sys, capacity, policy};
+  actor_config cfg;
+  cfg.mbox_factory = &factory;
+  return sys.spawn_functor<Os>(std::bool_constant<spawnable>{}, cfg, fun,
+                               std::forward<Ts>(xs)...);
+}
+
+} // namespace caf
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include "caf/config.hpp"
 #include "caf/detail/assert.hpp"
+#include "caf/detail/thread_shard.hpp"
 #include "caf/fwd.hpp"
 #include "caf/settings.hpp"
 #include "caf/span.hpp"
@@ -14,11 +16,19 @@
 #include "caf/telemetry/metric_type.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 #include <type_traits>
 
 namespace caf::telemetry {
 
 /// Represent aggregatable distributions of events.
+/// @note To avoid contention, each thread records its observations to a
+///       thread-local shard. The observers `buckets` and `sum` only include
+///       observations up to the last call to `merge`. Metric families merge
+///       each histogram once before passing it to a collector. Hence, the
+///       buckets and the sum always agree when collecting metrics.
 template <class ValueType>
 class histogram {
 public:
@@ -47,6 +57,7 @@ public:
             span<const value_type> upper_bounds) {
     if (!init_buckets_from_config(labels, cfg))
       init_buckets(upper_bounds);
+    init_shards();
   }
 
   explicit histogram(std::initializer_list<value_type> upper_bounds)
@@ -68,18 +79,32 @@ public:
   /// Increments the bucket where the observed value falls into and increments
   /// the sum of all observed values.
   void observe(value_type value) {
+    auto& shard = shards_[detail::thread_shard() % num_shards_];
     // The last bucket has an upper bound of +inf or int_max, so we'll always
     // find a bucket and increment the counters.
     for (size_t index = 0;; ++index) {
-      auto& [upper_bound, count] = buckets_[index];
-      if (value <= upper_bound) {
-        count.inc();
-        sum_.inc(value);
+      if (value <= buckets_[index].upper_bound) {
+        shard.counts[index].fetch_add(1, std::memory_order_relaxed);
+        add(shard.sum, value);
         return;
       }
     }
   }
 
+  /// Moves the observations of all shards to the buckets and the sum. Counts
+  /// only ever increase, so draining a shard with `exchange` never loses
+  /// concurrent observations.
+  void merge() noexcept {
+    for (size_t i = 0; i < num_shards_; ++i) {
+      auto& shard = shards_[i];
+      for (size_t index = 0; index < num_buckets_; ++index)
+        if (auto n = shard.counts[index].exchange(0, std::memory_order_relaxed))
+          buckets_[index].count.inc(n);
+      if (auto n = shard.sum.exchange(0, std::memory_order_relaxed); n != 0)
+        sum_.inc(n);
+    }
+  }
+
   // -- observers --------------------------------------------------------------
 
   /// Returns the ``counter`` objects with the configured upper bounds.
@@ -93,6 +118,54 @@ public:
   }
 
 private:
+  using atomic_value_type = std::atomic<value_type>;
+
+  using atomic_count_type = std::atomic<int64_t>;
+
+  /// Number of counts that fit into a single cache line.
+  static constexpr size_t counts_per_cache_line
+    = CAF_CACHE_LINE_SIZE / sizeof(atomic_count_type);
+
+  struct alignas(CAF_CACHE_LINE_SIZE) shard_type {
+    /// Points to the counts of this shard in `counts_`.
+    atomic_count_type* counts = nullptr;
+    atomic_value_type sum{0};
+  };
+
+  static void add(atomic_value_type& x, value_type amount) noexcept {
+    if constexpr (std::is_integral_v<value_type>) {
+      x.fetch_add(amount, std::memory_order_relaxed);
+    } else {
+      auto val = x.load(std::memory_order_relaxed);
+      while (!x.compare_exchange_weak(val, val + amount,
+                                      std::memory_order_relaxed)) {
+        // repeat
+      }
+    }
+  }
+
+  void init_shards() {
+    num_shards_ = detail::thread_shard_count();
+    shards_.reset(new shard_type[num_shards_]);
+    // Store the counts of all shards in a single allocation. The counts of each
+    // shard start at a cache line boundary and occupy full cache lines. Hence,
+    // two shards never share a cache line. The extra cache line allows us to
+    // skip elements at the front until reaching an aligned address.
+    auto stride = (num_buckets_ + counts_per_cache_line - 1)
+                  / counts_per_cache_line * counts_per_cache_line;
+    auto total = num_shards_ * stride + counts_per_cache_line;
+    counts_.reset(new atomic_count_type[total]);
+    for (size_t index = 0; index < total; ++index)
+      counts_[index].store(0, std::memory_order_relaxed);
+    auto addr = reinterpret_cast<uintptr_t>(counts_.get());
+    auto misalignment = addr % CAF_CACHE_LINE_SIZE;
+    auto offset = misalignment == 0 ? size_t{0}
+                                    : (CAF_CACHE_LINE_SIZE - misalignment)
+                                        / sizeof(atomic_count_type);
+    for (size_t i = 0; i < num_shards_; ++i)
+      shards_[i].counts = counts_.get() + offset + i * stride;
+  }
+
   void init_buckets(span<const value_type> upper_bounds) {
     CAF_ASSERT(std::is_sorted(upper_bounds.begin(), upper_bounds.end()));
     using limits = std::numeric_limits<value_type>;
@@ -129,6 +202,9 @@ private:
   size_t num_buckets_;
   bucket_type* buckets_;
   gauge_type sum_;
+  size_t num_shards_;
+  std::unique_ptr<shard_type[]> shards_;
+  std::unique_ptr<atomic_count_type[]> counts_;
 };
 
 /// Convenience alias for a histogram with value type `double`.
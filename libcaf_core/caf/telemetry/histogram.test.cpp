@@ -11,6 +11,8 @@
 
 #include <cmath>
 #include <limits>
+#include <thread>
+#include <vector>
 
 using namespace caf;
 using namespace caf::telemetry;
@@ -36,6 +38,7 @@ TEST("histograms aggregate to buckets and keep a sum") {
   int_histogram h1{2, 4, 8};
   for (int64_t value = 1; value < 11; ++value)
     h1.observe(value);
+  h1.merge();
   auto buckets = h1.buckets();
   require_eq(buckets.size(), 4u);
   check_eq(buckets[0].count.value(), 2); // 1, 2
@@ -44,3 +47,30 @@ TEST("histograms aggregate to buckets and keep a sum") {
   check_eq(buckets[3].count.value(), 2); // 9, 10
   check_eq(h1.sum(), 55);
 }
+
+TEST("histograms merge observations from all threads") {
+  int_histogram h1{2, 4, 8};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&h1] {
+      for (int64_t value = 1; value < 11; ++value)
+        h1.observe(value);
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+  // Observations only become visible after merging.
+  check_eq(h1.sum(), 0);
+  h1.merge();
+  auto buckets = h1.buckets();
+  require_eq(buckets.size(), 4u);
+  check_eq(buckets[0].count.value(), 8);
+  check_eq(buckets[1].count.value(), 8);
+  check_eq(buckets[2].count.value(), 16);
+  check_eq(buckets[3].count.value(), 8);
+  check_eq(h1.sum(), 220);
+  // Merging is idempotent.
+  h1.merge();
+  check_eq(h1.buckets()[0].count.value(), 8);
+  check_eq(h1.sum(), 220);
+}
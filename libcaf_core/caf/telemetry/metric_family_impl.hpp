@@ -10,11 +10,16 @@
 #include "caf/telemetry/metric.hpp"
 #include "caf/telemetry/metric_family.hpp"
 #include "caf/telemetry/metric_impl.hpp"
+#include "caf/telemetry/metric_type.hpp"
 
 #include <algorithm>
+#include <array>
+#include <functional>
 #include <initializer_list>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace caf::telemetry {
 
@@ -53,24 +58,38 @@ public:
   }
 
   Type* get_or_add(span<const label_view> labels) {
-    auto has_label_values = [labels](const auto& metric_ptr) {
+    auto has_label_values = [labels](const impl_type* metric_ptr) {
       const auto& metric_labels = metric_ptr->labels();
       return std::is_permutation(metric_labels.begin(), metric_labels.end(),
                                  labels.begin(), labels.end());
     };
-    std::unique_lock<std::mutex> guard{mx_};
-    auto m = std::find_if(metrics_.begin(), metrics_.end(), has_label_values);
-    if (m == metrics_.end()) {
-      std::vector<label> cpy{labels.begin(), labels.end()};
-      std::sort(cpy.begin(), cpy.end());
-      std::unique_ptr<impl_type> ptr;
-      if constexpr (std::is_same_v<extra_setting_type, unit_t>)
-        ptr.reset(new impl_type(std::move(cpy)));
-      else
-        ptr.reset(new impl_type(std::move(cpy), config_, extra_setting_));
-      m = metrics_.emplace(m, std::move(ptr));
+    auto key = hash_labels(labels);
+    auto& shard = shards_[key % num_shards];
+    { // Fast path: the instance already exists.
+      std::shared_lock<std::shared_mutex> guard{shard.mtx};
+      auto [first, last] = shard.metrics.equal_range(key);
+      for (auto i = first; i != last; ++i)
+        if (has_label_values(i->second))
+          return i->second->impl_ptr();
     }
-    return std::addressof(m->get()->impl());
+    std::unique_lock<std::shared_mutex> guard{shard.mtx};
+    // Check again, another thread may have added the instance in the meantime.
+    auto [first, last] = shard.metrics.equal_range(key);
+    for (auto i = first; i != last; ++i)
+      if (has_label_values(i->second))
+        return i->second->impl_ptr();
+    std::vector<label> cpy{labels.begin(), labels.end()};
+    std::sort(cpy.begin(), cpy.end());
+    std::unique_ptr<impl_type> ptr;
+    if constexpr (std::is_same_v<extra_setting_type, unit_t>)
+      ptr.reset(new impl_type(std::move(cpy)));
+    else
+      ptr.reset(new impl_type(std::move(cpy), config_, extra_setting_));
+    auto* result = ptr.get();
+    shard.metrics.emplace(key, result);
+    std::unique_lock<std::mutex> metrics_guard{mx_};
+    metrics_.emplace_back(std::move(ptr));
+    return result->impl_ptr();
   }
 
   Type* get_or_add(std::initializer_list<label_view> labels) {
@@ -90,14 +109,41 @@ public:
   template <class Collector>
   void collect(Collector& collector) const {
     std::unique_lock<std::mutex> guard{mx_};
-    for (auto& ptr : metrics_)
+    for (auto& ptr : metrics_) {
+      // Merge histograms once, so that the collector sees buckets and a sum
+      // that include the same observations.
+      if constexpr (Type::runtime_type == metric_type::dbl_histogram
+                    || Type::runtime_type == metric_type::int_histogram)
+        ptr->impl().merge();
       collector(this, ptr.get(), std::addressof(ptr->impl()));
+    }
   }
 
 private:
+  /// Number of independently locked partitions for instance lookups.
+  static constexpr size_t num_shards = 16;
+
+  /// Maps label hashes to instances. Each shard has its own lock to allow
+  /// concurrent lookups, e.g., when spawning many actors with metrics enabled.
+  struct shard_type {
+    mutable std::shared_mutex mtx;
+    std::unordered_multimap<size_t, impl_type*> metrics;
+  };
+
+  /// Computes a hash value for `labels` that does not depend on their order.
+  static size_t hash_labels(span<const label_view> labels) noexcept {
+    size_t result = 0;
+    for (const auto& lbl : labels)
+      result += std::hash<label_view>{}(lbl);
+    return result;
+  }
+
   const settings* config_;
   extra_setting_type extra_setting_;
+  std::array<shard_type, num_shards> shards_;
+  /// Protects `metrics_`. When acquiring both, always lock a shard first.
   mutable std::mutex mx_;
+  /// Owns all instances in insertion order.
   std::vector<std::unique_ptr<impl_type>> metrics_;
 };
 
@@ -44,8 +44,9 @@ metric_registry* metric_registry::from(actor_system& sys) {
 void metric_registry::merge(metric_registry& other) {
   if (this == &other)
     return;
-  std::unique_lock<std::mutex> guard1{families_mx_, std::defer_lock};
-  std::unique_lock<std::mutex> guard2{other.families_mx_, std::defer_lock};
+  std::unique_lock<std::shared_mutex> guard1{families_mx_, std::defer_lock};
+  std::unique_lock<std::shared_mutex> guard2{other.families_mx_,
+                                             std::defer_lock};
   std::lock(guard1, guard2);
   families_.reserve(families_.size() + other.families_.size());
   for (auto& fptr : other.families_)
@@ -55,6 +56,15 @@ void metric_registry::merge(metric_registry& other) {
                    std::make_move_iterator(other.families_.begin()),
                    std::make_move_iterator(other.families_.end()));
   other.families_.clear();
+  collect_hooks_.insert(collect_hooks_.end(),
+                        std::make_move_iterator(other.collect_hooks_.begin()),
+                        std::make_move_iterator(other.collect_hooks_.end()));
+  other.collect_hooks_.clear();
+}
+
+void metric_registry::add_collect_hook(std::function<void()> fn) {
+  std::unique_lock<std::shared_mutex> guard{families_mx_};
+  collect_hooks_.emplace_back(std::move(fn));
 }
 
 metric_family* metric_registry::fetch(const std::string_view& prefix,
@@ -68,6 +78,12 @@ metric_family* metric_registry::fetch(const std::string_view& prefix,
   return nullptr;
 }
 
+metric_family* metric_registry::fetch_shared(const std::string_view& prefix,
+                                             const std::string_view& name) {
+  std::shared_lock<std::shared_mutex> guard{families_mx_};
+  return fetch(prefix, name);
+}
+
 std::vector<std::string_view>
 metric_registry::get_label_names(span_t<label_view> xs) {
   std::vector<std::string_view> result;
@@ -15,10 +15,12 @@
 #include "caf/telemetry/metric_family_impl.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <initializer_list>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string_view>
 
 namespace caf::telemetry {
@@ -71,7 +73,12 @@ public:
                std::string_view unit = "1", bool is_sum = false) {
     using gauge_type = gauge<ValueType>;
     using family_type = metric_family_impl<gauge_type>;
-    std::unique_lock<std::mutex> guard{families_mx_};
+    if (auto ptr = fetch_shared(prefix, name)) {
+      assert_properties(ptr, gauge_type::runtime_type, labels, unit, is_sum);
+      return static_cast<family_type*>(ptr);
+    }
+    std::unique_lock<std::shared_mutex> guard{families_mx_};
+    // Check again, another thread may have added the family in the meantime.
     if (auto ptr = fetch(prefix, name)) {
       assert_properties(ptr, gauge_type::runtime_type, labels, unit, is_sum);
       return static_cast<family_type*>(ptr);
@@ -104,7 +111,12 @@ public:
                std::string_view unit = "1", bool is_sum = false) {
     using gauge_type = gauge<ValueType>;
     using family_type = metric_family_impl<gauge_type>;
-    std::unique_lock<std::mutex> guard{families_mx_};
+    if (auto ptr = fetch_shared(prefix, name)) {
+      assert_properties(ptr, gauge_type::runtime_type, labels, unit, is_sum);
+      return static_cast<family_type*>(ptr);
+    }
+    std::unique_lock<std::shared_mutex> guard{families_mx_};
+    // Check again, another thread may have added the family in the meantime.
     if (auto ptr = fetch(prefix, name)) {
       assert_properties(ptr, gauge_type::runtime_type, labels, unit, is_sum);
       return static_cast<family_type*>(ptr);
@@ -205,7 +217,12 @@ public:
                  std::string_view unit = "1", bool is_sum = false) {
     using counter_type = counter<ValueType>;
     using family_type = metric_family_impl<counter_type>;
-    std::unique_lock<std::mutex> guard{families_mx_};
+    if (auto ptr = fetch_shared(prefix, name)) {
+      assert_properties(ptr, counter_type::runtime_type, labels, unit, is_sum);
+      return static_cast<family_type*>(ptr);
+    }
+    std::unique_lock<std::shared_mutex> guard{families_mx_};
+    // Check again, another thread may have added the family in the meantime.
     if (auto ptr = fetch(prefix, name)) {
       assert_properties(ptr, counter_type::runtime_type, labels, unit, is_sum);
       return static_cast<family_type*>(ptr);
@@ -328,7 +345,13 @@ public:
     using upper_bounds_list = std::vector<ValueType>;
     if (default_upper_bounds.empty())
       CAF_RAISE_ERROR("at least one bucket must exist in the default settings");
-    std::unique_lock<std::mutex> guard{families_mx_};
+    if (auto ptr = fetch_shared(prefix, name)) {
+      assert_properties(ptr, histogram_type::runtime_type, label_names, unit,
+                        is_sum);
+      return static_cast<family_type*>(ptr);
+    }
+    std::unique_lock<std::shared_mutex> guard{families_mx_};
+    // Check again, another thread may have added the family in the meantime.
     if (auto ptr = fetch(prefix, name)) {
       assert_properties(ptr, histogram_type::runtime_type, label_names, unit,
                         is_sum);
@@ -477,7 +500,9 @@ public:
   template <class Collector>
   void collect(Collector& collector) const {
     auto f = [&](auto* ptr) { ptr->collect(collector); };
-    std::unique_lock<std::mutex> guard{families_mx_};
+    std::shared_lock<std::shared_mutex> guard{families_mx_};
+    for (auto& hook : collect_hooks_)
+      hook();
     for (auto& ptr : families_)
       visit_family(f, ptr.get());
   }
@@ -493,11 +518,20 @@ public:
   /// @pre `other` *must not* contain any duplicated metric family
   void merge(metric_registry& other);
 
+  /// Registers a function that the registry calls at the beginning of each
+  /// `collect`. Allows metric sources to update their metrics lazily, e.g., by
+  /// merging per-thread counters into a gauge.
+  void add_collect_hook(std::function<void()> fn);
+
 private:
   /// @pre `families_mx_` is locked.
   metric_family* fetch(const std::string_view& prefix,
                        const std::string_view& name);
 
+  /// Like `fetch`, but acquires a shared lock on `families_mx_`.
+  metric_family* fetch_shared(const std::string_view& prefix,
+                              const std::string_view& name);
+
   static std::vector<std::string_view> get_label_names(span_t<label_view> xs);
 
   static std::vector<std::string> to_sorted_vec(span_t<std::string_view> xs);
@@ -531,8 +565,9 @@ private:
                          span_t<label_view> label_names, std::string_view unit,
                          bool is_sum);
 
-  mutable std::mutex families_mx_;
+  mutable std::shared_mutex families_mx_;
   std::vector<std::unique_ptr<metric_family>> families_;
+  std::vector<std::function<void()>> collect_hooks_;
   const caf::settings* config_;
 };
 
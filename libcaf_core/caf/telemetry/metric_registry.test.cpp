@@ -19,6 +19,11 @@
 #include "caf/telemetry/label_view.hpp"
 #include "caf/telemetry/metric_type.hpp"
 
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace caf;
 using namespace caf::telemetry;
 using namespace std::literals;
@@ -113,6 +118,8 @@ TEST("registries lazily create metrics") {
   check_eq(f->get_or_add(v2_reversed)->value(), 23);
   g->get_or_add(v1)->observe(3);
   g->get_or_add(v2)->observe(7);
+  g->get_or_add(v1)->merge();
+  g->get_or_add(v2)->merge();
   check_eq(g->get_or_add(v1)->sum(), 3);
   check_eq(g->get_or_add(v1_reversed)->sum(), 3);
   check_eq(g->get_or_add(v2)->sum(), 7);
@@ -293,6 +300,42 @@ SCENARIO("metric registries can merge families from other registries") {
   }
 }
 
+TEST("metric families support concurrent lookups") {
+  auto f = reg.counter_family("caf", "spawned-actors", {"name"},
+                              "How many actors did we spawn?");
+  constexpr size_t num_threads = 4;
+  constexpr size_t num_names = 50;
+  std::vector<std::string> names;
+  for (size_t i = 0; i < num_names; ++i)
+    names.push_back("actor-" + std::to_string(i));
+  std::vector<std::vector<int_counter*>> results(num_threads);
+  std::vector<std::thread> threads;
+  for (size_t id = 0; id < num_threads; ++id) {
+    threads.emplace_back([&, id] {
+      for (auto& name : names) {
+        auto* instance = f->get_or_add({{"name", name}});
+        instance->inc();
+        results[id].push_back(instance);
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+  for (size_t id = 1; id < num_threads; ++id)
+    check_eq(results[id], results[0]);
+  for (auto* instance : results[0])
+    check_eq(instance->value(), static_cast<int64_t>(num_threads));
+  // Collecting visits each instance once in insertion order.
+  size_t visited = 0;
+  auto visit = [&](auto*, const metric* instance, auto*) {
+    if (visited < num_names)
+      check_eq(instance->labels().front().value(), names[visited]);
+    ++visited;
+  };
+  f->collect(visit);
+  check_eq(visited, num_names);
+}
+
 } // WITH_FIXTURE(fixture)
 
 namespace {
@@ -305,6 +348,36 @@ struct foo_state {
   }
 };
 
+// Gets stuck in its first message handler until `release` becomes ready.
+struct bar_state {
+  static constexpr const char* name = "bar";
+
+  bar_state(event_based_actor* selfptr, actor observer_hdl,
+            std::shared_future<void> release_signal)
+    : self(selfptr),
+      observer(std::move(observer_hdl)),
+      release(std::move(release_signal)) {
+    // nop
+  }
+
+  behavior make_behavior() {
+    return {
+      [this](int32_t x) {
+        if (x == 0) {
+          self->mail(x).send(observer);
+          release.wait();
+        } else if (x == 3) {
+          self->quit();
+        }
+      },
+    };
+  }
+
+  event_based_actor* self;
+  actor observer;
+  std::shared_future<void> release;
+};
+
 } // namespace
 
 TEST("enabling actor metrics per config creates metric instances") {
@@ -319,4 +392,56 @@ TEST("enabling actor metrics per config creates metric instances") {
   sys.metrics().collect(collector);
   check_ne(collector.result.find(R"(caf.actor.mailbox-size{name="foo"})"),
            std::string::npos);
+  check_ne(collector.result.find(
+             R"(caf.actor.processing-time.seconds{name="foo"})"),
+           std::string::npos);
+  check_ne(
+    collector.result.find(R"(caf.actor.mailbox-time.seconds{name="foo"})"),
+    std::string::npos);
+}
+
+TEST("actors report their mailbox size without enabling actor metrics") {
+  actor_system_config cfg;
+  actor_system sys{cfg};
+  scoped_actor self{sys};
+  std::promise<void> release;
+  auto hdl = sys.spawn(actor_from_state<bar_state>, actor{self},
+                       release.get_future().share());
+  self->mail(int32_t{0}).send(hdl);
+  self->receive([](int32_t) {});
+  // The actor is now stuck. Still, the gauge must reflect its growing mailbox.
+  for (int32_t i = 1; i <= 3; ++i)
+    self->mail(i).send(hdl);
+  test_collector collector;
+  sys.metrics().collect(collector);
+  check_ne(collector.result.find(R"(caf.actor.mailbox-size{name="bar"} 3)"),
+           std::string::npos);
+  check_eq(collector.result.find("caf.actor.processing-time"),
+           std::string::npos);
+  release.set_value();
+  self->wait_for(hdl);
+  collector.result.clear();
+  sys.metrics().collect(collector);
+  check_ne(collector.result.find(R"(caf.actor.mailbox-size{name="bar"} 0)"),
+           std::string::npos);
+}
+
+TEST("actors selected by excludes never report their mailbox size") {
+  actor_system_config cfg;
+  put(cfg.content, "caf.metrics-filters.actors.excludes", std::vector{"bar"s});
+  actor_system sys{cfg};
+  scoped_actor self{sys};
+  std::promise<void> release;
+  auto hdl = sys.spawn(actor_from_state<bar_state>, actor{self},
+                       release.get_future().share());
+  self->mail(int32_t{0}).send(hdl);
+  self->receive([](int32_t) {});
+  for (int32_t i = 1; i <= 3; ++i)
+    self->mail(i).send(hdl);
+  test_collector collector;
+  sys.metrics().collect(collector);
+  check_eq(collector.result.find(R"(caf.actor.mailbox-size{name="bar"})"),
+           std::string::npos);
+  release.set_value();
+  self->wait_for(hdl);
 }
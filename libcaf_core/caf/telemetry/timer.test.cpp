@@ -18,6 +18,7 @@ TEST("timers observe how much time passes in a scope") {
       check_gt(t.started().time_since_epoch().count(), 0);
       // timer adds to h1 at scope exit
     }
+    h1.merge();
     check_gt(h1.sum(), 0.0);
   }
   SECTION("timers constructed with a nullptr have no effect") {
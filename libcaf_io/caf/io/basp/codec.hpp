@@ -0,0 +1,44 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/byte_buffer.hpp"
+#include "caf/byte_span.hpp"
+#include "caf/detail/io_export.hpp"
+
+#include <memory>
+#include <string_view>
+
+namespace caf::io::basp {
+
+/// Compresses and decompresses the payload of BASP messages. Nodes exchange
+/// the names of their codecs during the handshake and only compress messages
+/// to peers that support the configured codec. A single instance serves all
+/// connections, so implementations must not modify any state in `compress` or
+/// `decompress`.
+class CAF_IO_EXPORT codec {
+public:
+  virtual ~codec();
+
+  /// Returns the name that identifies this codec in the BASP handshake.
+  virtual std::string_view name() const noexcept = 0;
+
+  /// Appends the compressed representation of `input` to `output`.
+  virtual void compress(const_byte_span input, byte_buffer& output) const = 0;
+
+  /// Decompresses `input` and appends the result to `output`.
+  /// @param input The compressed bytes.
+  /// @param size The size of the original input to `compress`.
+  /// @param output The buffer for storing the result.
+  /// @returns `true` on success, `false` if `input` is malformed or does not
+  ///          decompress to exactly `size` bytes.
+  virtual bool decompress(const_byte_span input, size_t size,
+                          byte_buffer& output) const = 0;
+};
+
+/// @relates codec
+using codec_ptr = std::shared_ptr<const codec>;
+
+} // namespace caf::io::basp
@@ -10,6 +10,8 @@ namespace caf::io::basp {
 
 const uint8_t header::named_receiver_flag;
 
+const uint8_t header::compressed_flag;
+
 namespace {
 
 template <class T>
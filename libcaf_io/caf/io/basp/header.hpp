@@ -48,6 +48,11 @@ struct header {
   /// Identifies a receiver by name rather than ID.
   static const uint8_t named_receiver_flag = 0x01;
 
+  /// Marks a compressed payload. The payload starts with the index of the
+  /// codec in the list that the receiver announced during the handshake,
+  /// followed by the size of the uncompressed payload.
+  static const uint8_t compressed_flag = 0x02;
+
   /// Identifies the config server.
   static const uint64_t config_server_id = 1;
 
@@ -15,6 +15,7 @@
 #include "caf/detail/assert.hpp"
 #include "caf/log/io.hpp"
 #include "caf/settings.hpp"
+#include "caf/telemetry/counter.hpp"
 #include "caf/telemetry/histogram.hpp"
 #include "caf/telemetry/timer.hpp"
 
@@ -44,6 +45,18 @@ instance::instance(abstract_broker* parent, callee& lstnr)
     workers = std::min(3u, std::thread::hardware_concurrency() / 4u) + 1;
   for (size_t i = 0; i < workers; ++i)
     hub_.add_new_worker(queue_, proxies());
+  compression_threshold_
+    = get_or(config(), "caf.middleman.compression-threshold",
+             defaults::middleman::compression_threshold);
+  auto name = get_or(config(), "caf.middleman.compression",
+                     defaults::middleman::compression);
+  if (!name.empty()) {
+    for (auto& ptr : sys_->middleman().codecs())
+      if (ptr->name() == name)
+        codec_ = ptr.get();
+    if (codec_ == nullptr)
+      log::io::warning("unknown codec for compressing messages: {}", name);
+  }
 }
 
 connection_state instance::handle(scheduler* ctx, new_data_msg& dm, header& hdr,
@@ -53,6 +66,7 @@ connection_state instance::handle(scheduler* ctx, new_data_msg& dm, header& hdr,
   auto err = [&](connection_state code) {
     if (auto nid = tbl_.erase_direct(dm.handle))
       callee_.purge_state(nid);
+    erase_peer_codec(dm.handle);
     return code;
   };
   byte_buffer* payload = nullptr;
@@ -165,41 +179,22 @@ bool instance::dispatch(scheduler* ctx, const strong_actor_ptr& sender,
                         uint8_t flags, message_id mid, const message& msg) {
   auto lg = log::io::trace("sender = {}, dest_node = {}, mid = {}, msg = {}",
                            sender, dest_node, mid, msg);
-  CAF_ASSERT(dest_node && this_node_ != dest_node);
-  auto path = lookup(dest_node);
-  if (!path)
-    return false;
-  auto& source_node = sender ? sender->node() : this_node_;
-  if (dest_node == path->next_hop && source_node == this_node_) {
-    header hdr{message_type::direct_message,
-               flags,
-               0,
-               mid.integer_value(),
-               sender ? sender->id() : invalid_actor_id,
-               dest_actor};
-    auto writer = make_callback([&](binary_serializer& sink) { //
-      return sink.apply(msg);
-    });
-    write(*sys_, ctx, callee_.get_buffer(path->hdl), hdr, &writer);
-  } else {
-    header hdr{message_type::routed_message,
-               flags,
-               0,
-               mid.integer_value(),
-               sender ? sender->id() : invalid_actor_id,
-               dest_actor};
-    auto writer = make_callback([&](binary_serializer& sink) {
-      log::io::debug(
-        "send routed message: source_node = {} dest_node = {} msg = {}",
-        source_node, dest_node, msg);
-      return sink.apply(source_node)  //
-             && sink.apply(dest_node) //
-             && sink.apply(msg);
-    });
-    write(*sys_, ctx, callee_.get_buffer(path->hdl), hdr, &writer);
-  }
-  flush(*path);
-  return true;
+  auto writer = make_callback([&](binary_serializer& sink) { //
+    return sink.apply(msg);
+  });
+  return dispatch_impl(ctx, sender, dest_node, dest_actor, flags, mid, writer);
+}
+
+bool instance::dispatch(scheduler* ctx, const strong_actor_ptr& sender,
+                        const node_id& dest_node, uint64_t dest_actor,
+                        uint8_t flags, message_id mid,
+                        const_byte_span serialized_msg) {
+  auto lg = log::io::trace("sender = {}, dest_node = {}, mid = {}, size = {}",
+                           sender, dest_node, mid, serialized_msg.size());
+  auto writer = make_callback([&](binary_serializer& sink) { //
+    return sink.value(serialized_msg);
+  });
+  return dispatch_impl(ctx, sender, dest_node, dest_actor, flags, mid, writer);
 }
 
 void instance::write(actor_system& sys, scheduler*, byte_buffer& buf,
@@ -257,7 +252,8 @@ void instance::write_server_handshake(scheduler* ctx, byte_buffer& out_buf,
     return sink.apply(this_node_) //
            && sink.apply(app_ids) //
            && sink.apply(aid)     //
-           && sink.apply(iface);
+           && sink.apply(iface)   //
+           && sink.apply(codec_names());
   });
   header hdr{message_type::server_handshake,
              0,
@@ -270,7 +266,7 @@ void instance::write_server_handshake(scheduler* ctx, byte_buffer& out_buf,
 
 void instance::write_client_handshake(scheduler* ctx, byte_buffer& buf) {
   auto writer = make_callback([&](binary_serializer& sink) { //
-    return sink.apply(this_node_);
+    return sink.apply(this_node_) && sink.apply(codec_names());
   });
   header hdr{message_type::client_handshake,
              0,
@@ -323,6 +319,14 @@ connection_state instance::handle(scheduler* ctx, connection_handle hdl,
     log::io::warning("actual payload size differs from advertised size");
     return malformed_message;
   }
+  // Decompress the payload if necessary.
+  if (hdr.has(header::compressed_flag)) {
+    if (payload == nullptr || !decompress(hdr, *payload)) {
+      log::io::warning("unable to decompress payload");
+      return malformed_message;
+    }
+    payload = &decompressed_;
+  }
   // Dispatch by message type.
   switch (hdr.operation) {
     case message_type::server_handshake: {
@@ -333,10 +337,12 @@ connection_state instance::handle(scheduler* ctx, connection_handle hdl,
       string_list app_ids;
       actor_id aid = invalid_actor_id;
       std::set<std::string> sigs;
+      string_list codecs;
       if (!source.apply(source_node) //
           || !source.apply(app_ids)  //
           || !source.apply(aid)      //
-          || !source.apply(sigs)) {
+          || !source.apply(sigs)     //
+          || !source.apply(codecs)) {
         log::io::warning(
           "unable to deserialize payload of server handshake: {}",
           source.get_error());
@@ -374,6 +380,7 @@ connection_state instance::handle(scheduler* ctx, connection_handle hdl,
       // Add direct route to this node and remove any indirect entry.
       log::io::debug("new direct connection: source_node = {}", source_node);
       tbl_.add_direct(hdl, source_node);
+      select_codec(hdl, codecs);
       auto was_indirect = tbl_.erase_indirect(source_node);
       // write handshake as client in response
       auto path = tbl_.lookup(source_node);
@@ -389,7 +396,8 @@ connection_state instance::handle(scheduler* ctx, connection_handle hdl,
       // Deserialize payload.
       binary_deserializer source{*sys_, *payload};
       node_id source_node;
-      if (!source.apply(source_node)) {
+      std::vector<std::string> codecs;
+      if (!source.apply(source_node) || !source.apply(codecs)) {
         log::io::warning(
           "unable to deserialize payload of client handshake: {}",
           source.get_error());
@@ -404,6 +412,7 @@ connection_state instance::handle(scheduler* ctx, connection_handle hdl,
       // Add direct route to this node and remove any indirect entry.
       log::io::debug("new direct connection: source_node = {}", source_node);
       tbl_.add_direct(hdl, source_node);
+      select_codec(hdl, codecs);
       auto was_indirect = tbl_.erase_indirect(source_node);
       callee_.learned_new_node_directly(source_node, was_indirect);
       break;
@@ -523,6 +532,123 @@ connection_state instance::handle(scheduler* ctx, connection_handle hdl,
   return await_header;
 }
 
+bool instance::dispatch_impl(scheduler* ctx, const strong_actor_ptr& sender,
+                             const node_id& dest_node, uint64_t dest_actor,
+                             uint8_t flags, message_id mid,
+                             payload_writer& msg_writer) {
+  CAF_ASSERT(dest_node && this_node_ != dest_node);
+  auto path = lookup(dest_node);
+  if (!path)
+    return false;
+  auto& source_node = sender ? sender->node() : this_node_;
+  auto& buf = callee_.get_buffer(path->hdl);
+  auto offset = buf.size();
+  if (dest_node == path->next_hop && source_node == this_node_) {
+    header hdr{message_type::direct_message,
+               flags,
+               0,
+               mid.integer_value(),
+               sender ? sender->id() : invalid_actor_id,
+               dest_actor};
+    write(*sys_, ctx, buf, hdr, &msg_writer);
+    compress(path->hdl, buf, offset, hdr);
+  } else {
+    header hdr{message_type::routed_message,
+               flags,
+               0,
+               mid.integer_value(),
+               sender ? sender->id() : invalid_actor_id,
+               dest_actor};
+    auto writer = make_callback([&](binary_serializer& sink) {
+      log::io::debug("send routed message: source_node = {} dest_node = {}",
+                     source_node, dest_node);
+      return sink.apply(source_node)  //
+             && sink.apply(dest_node) //
+             && msg_writer(sink);
+    });
+    write(*sys_, ctx, buf, hdr, &writer);
+    compress(path->hdl, buf, offset, hdr);
+  }
+  flush(*path);
+  return true;
+}
+
+void instance::erase_peer_codec(connection_handle hdl) {
+  peer_codecs_.erase(hdl);
+}
+
+std::vector<std::string> instance::codec_names() const {
+  std::vector<std::string> result;
+  for (auto& ptr : sys_->middleman().codecs())
+    result.emplace_back(ptr->name());
+  return result;
+}
+
+void instance::select_codec(connection_handle hdl,
+                            const std::vector<std::string>& peer_codecs) {
+  if (codec_ == nullptr)
+    return;
+  auto i = std::find(peer_codecs.begin(), peer_codecs.end(), codec_->name());
+  auto index = std::distance(peer_codecs.begin(), i);
+  if (i == peer_codecs.end() || index > 255) {
+    log::io::debug("peer does not support codec {}", codec_->name());
+    peer_codecs_.erase(hdl);
+    return;
+  }
+  peer_codecs_[hdl] = peer_codec{codec_, static_cast<uint8_t>(index)};
+}
+
+void instance::compress(connection_handle hdl, byte_buffer& buf, size_t offset,
+                        header& hdr) {
+  if (hdr.payload_len == 0 || hdr.payload_len < compression_threshold_)
+    return;
+  auto i = peer_codecs_.find(hdl);
+  if (i == peer_codecs_.end())
+    return;
+  auto payload = const_byte_span{buf}.subspan(offset + header_size);
+  compressed_.clear();
+  binary_serializer sink{*sys_, compressed_};
+  if (!sink.value(i->second.index) || !sink.value(hdr.payload_len))
+    return;
+  i->second.ptr->compress(payload, compressed_);
+  // Only send the compressed payload if it actually saves bandwidth.
+  if (compressed_.size() >= payload.size())
+    return;
+  auto& mm_metrics = sys_->middleman().metric_singletons;
+  mm_metrics.outbound_uncompressed_bytes->inc(hdr.payload_len);
+  mm_metrics.outbound_compressed_bytes->inc(
+    static_cast<int64_t>(compressed_.size()));
+  buf.resize(offset + header_size);
+  buf.insert(buf.end(), compressed_.begin(), compressed_.end());
+  hdr.flags |= header::compressed_flag;
+  hdr.payload_len = static_cast<uint32_t>(compressed_.size());
+  binary_serializer hdr_sink{*sys_, buf};
+  hdr_sink.seek(offset);
+  if (!hdr_sink.apply(hdr))
+    log::io::error("{}", hdr_sink.get_error());
+}
+
+bool instance::decompress(header& hdr, const byte_buffer& payload) {
+  binary_deserializer source{*sys_, payload};
+  uint8_t index = 0;
+  uint32_t size = 0;
+  if (!source.value(index) || !source.value(size))
+    return false;
+  auto& codecs = sys_->middleman().codecs();
+  if (index >= codecs.size())
+    return false;
+  decompressed_.clear();
+  if (!codecs[index]->decompress(source.remainder(), size, decompressed_))
+    return false;
+  auto& mm_metrics = sys_->middleman().metric_singletons;
+  mm_metrics.inbound_compressed_bytes->inc(
+    static_cast<int64_t>(payload.size()));
+  mm_metrics.inbound_uncompressed_bytes->inc(size);
+  hdr.flags = static_cast<uint8_t>(hdr.flags & ~header::compressed_flag);
+  hdr.payload_len = size;
+  return true;
+}
+
 void instance::forward(scheduler*, const node_id& dest_node, const header& hdr,
                        byte_buffer& payload) {
   auto lg = log::io::trace("dest_node = {}, hdr = {}, payload = {}", dest_node,
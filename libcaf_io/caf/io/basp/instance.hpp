@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "caf/io/basp/codec.hpp"
 #include "caf/io/basp/connection_state.hpp"
 #include "caf/io/basp/header.hpp"
 #include "caf/io/basp/message_queue.hpp"
@@ -14,6 +15,7 @@
 
 #include "caf/actor_system_config.hpp"
 #include "caf/byte_buffer.hpp"
+#include "caf/byte_span.hpp"
 #include "caf/callback.hpp"
 #include "caf/detail/io_export.hpp"
 #include "caf/detail/worker_hub.hpp"
@@ -139,6 +141,13 @@ public:
                 const node_id& dest_node, uint64_t dest_actor, uint8_t flags,
                 message_id mid, const message& msg);
 
+  /// Like `dispatch`, but takes the content of the message in serialized form,
+  /// i.e., the output of a `binary_serializer` for the message.
+  /// @returns `true` if a path to destination existed, `false` otherwise.
+  bool dispatch(scheduler* ctx, const strong_actor_ptr& sender,
+                const node_id& dest_node, uint64_t dest_actor, uint8_t flags,
+                message_id mid, const_byte_span serialized_msg);
+
   /// Returns the actor namespace associated to this BASP protocol instance.
   proxy_registry& proxies() {
     return callee_.proxies();
@@ -211,7 +220,41 @@ public:
   connection_state handle(scheduler* ctx, connection_handle hdl, header& hdr,
                           byte_buffer* payload);
 
+  /// Drops the codec for compressing messages that the handshake with the
+  /// peer at `hdl` has negotiated.
+  void erase_peer_codec(connection_handle hdl);
+
 private:
+  /// Identifies the codec for compressing messages to a peer.
+  struct peer_codec {
+    /// Points to the codec in the codec list of the middleman.
+    const codec* ptr;
+
+    /// Stores the position of the codec in the list of the peer.
+    uint8_t index;
+  };
+
+  /// Returns the names of all codecs that this node can decompress.
+  std::vector<std::string> codec_names() const;
+
+  /// Enables compression for messages to `hdl` if the peer supports the
+  /// configured codec.
+  void select_codec(connection_handle hdl,
+                    const std::vector<std::string>& peer_codecs);
+
+  /// Compresses the payload of the message that starts at `offset` in `buf`
+  /// if the peer at `hdl` supports compression and the payload is large
+  /// enough. Updates `hdr` and the serialized header in `buf` accordingly.
+  void compress(connection_handle hdl, byte_buffer& buf, size_t offset,
+                header& hdr);
+
+  /// Decompresses `payload` into `decompressed_` and updates `hdr`.
+  bool decompress(header& hdr, const byte_buffer& payload);
+
+  bool dispatch_impl(scheduler* ctx, const strong_actor_ptr& sender,
+                     const node_id& dest_node, uint64_t dest_actor,
+                     uint8_t flags, message_id mid, payload_writer& msg_writer);
+
   void forward(scheduler* ctx, const node_id& dest_node, const header& hdr,
                byte_buffer& payload);
 
@@ -222,6 +265,21 @@ private:
   callee& callee_;
   message_queue queue_;
   detail::worker_hub<worker> hub_;
+
+  /// Points to the codec that `caf.middleman.compression` selects.
+  const codec* codec_ = nullptr;
+
+  /// Stores the minimum payload size for compressing messages.
+  size_t compression_threshold_;
+
+  /// Stores the negotiated codec for each connection.
+  std::unordered_map<connection_handle, peer_codec> peer_codecs_;
+
+  /// Scratch buffer for compressing outbound payloads.
+  byte_buffer compressed_;
+
+  /// Scratch buffer for decompressing inbound payloads.
+  byte_buffer decompressed_;
 };
 
 /// @}
@@ -0,0 +1,188 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/io/basp/lz4_codec.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace caf::io::basp {
+
+namespace {
+
+// -- constants of the LZ4 block format ----------------------------------------
+
+/// The minimum length of a match.
+constexpr size_t min_match = 4;
+
+/// The last bytes of a block are always literals.
+constexpr size_t last_literals = 5;
+
+/// Matches must start at least this many bytes before the end of a block.
+constexpr size_t mf_limit = 12;
+
+/// The maximum distance between a match and its reference.
+constexpr size_t max_offset = 65'535;
+
+/// A length field of 15 in the token signals additional length bytes.
+constexpr size_t run_mask = 15;
+
+// -- utility functions --------------------------------------------------------
+
+/// Configures the size of the hash table for finding matches.
+constexpr size_t hash_log = 12;
+
+uint32_t read32(const std::byte* ptr) noexcept {
+  uint32_t result;
+  memcpy(&result, ptr, sizeof(result));
+  return result;
+}
+
+size_t hash(uint32_t seq) noexcept {
+  return (seq * 2'654'435'761u) >> (32 - hash_log);
+}
+
+void write_length(byte_buffer& out, size_t len) {
+  len -= run_mask;
+  while (len >= 255) {
+    out.push_back(std::byte{255});
+    len -= 255;
+  }
+  out.push_back(static_cast<std::byte>(len));
+}
+
+} // namespace
+
+std::string_view lz4_codec::name() const noexcept {
+  return codec_name;
+}
+
+void lz4_codec::compress(const_byte_span input, byte_buffer& output) const {
+  const auto* first = input.data();
+  auto size = input.size();
+  size_t anchor = 0;
+  // Writes a sequence with all literals since `anchor` and (optionally) a
+  // match. The last sequence has no match.
+  auto emit = [&](size_t literals_end, size_t offset, size_t match_len) {
+    auto literals_len = literals_end - anchor;
+    auto token_pos = output.size();
+    auto token = literals_len >= run_mask ? run_mask << 4 : literals_len << 4;
+    output.push_back(static_cast<std::byte>(token));
+    if (literals_len >= run_mask)
+      write_length(output, literals_len);
+    output.insert(output.end(), first + anchor, first + literals_end);
+    if (match_len == 0)
+      return;
+    output.push_back(static_cast<std::byte>(offset & 0xFF));
+    output.push_back(static_cast<std::byte>(offset >> 8));
+    auto len = match_len - min_match;
+    if (len >= run_mask) {
+      output[token_pos] |= static_cast<std::byte>(run_mask);
+      write_length(output, len);
+    } else {
+      output[token_pos] |= static_cast<std::byte>(len);
+    }
+  };
+  if (size > mf_limit) {
+    // Stores the position + 1 of the last occurrence for each hash value.
+    std::array<uint32_t, size_t{1} << hash_log> table;
+    table.fill(0);
+    auto match_limit = size - mf_limit;
+    auto match_end_limit = size - last_literals;
+    size_t pos = 0;
+    while (pos < match_limit) {
+      auto seq = read32(first + pos);
+      auto& entry = table[hash(seq)];
+      auto candidate = static_cast<size_t>(entry);
+      entry = static_cast<uint32_t>(pos + 1);
+      if (candidate == 0 || pos + 1 - candidate > max_offset
+          || read32(first + candidate - 1) != seq) {
+        ++pos;
+        continue;
+      }
+      auto ref = candidate - 1;
+      auto len = min_match;
+      while (pos + len < match_end_limit
+             && first[ref + len] == first[pos + len])
+        ++len;
+      emit(pos, pos - ref, len);
+      pos += len;
+      anchor = pos;
+    }
+  }
+  emit(size, 0, 0);
+}
+
+bool lz4_codec::decompress(const_byte_span input, size_t size,
+                           byte_buffer& output) const {
+  // Each input byte expands to at most 255 output bytes. Reject anything else
+  // before allocating memory for the output.
+  if (size / 255 > input.size())
+    return false;
+  auto offset = output.size();
+  output.resize(offset + size);
+  auto* out = output.data() + offset;
+  const auto* in = input.data();
+  auto in_size = input.size();
+  size_t ipos = 0;
+  size_t opos = 0;
+  auto read_length = [&](size_t& len) {
+    for (;;) {
+      if (ipos == in_size)
+        return false;
+      auto x = std::to_integer<size_t>(in[ipos++]);
+      len += x;
+      if (x != 255)
+        return true;
+    }
+  };
+  auto fail = [&] {
+    output.resize(offset);
+    return false;
+  };
+  while (ipos < in_size) {
+    auto token = std::to_integer<size_t>(in[ipos++]);
+    // Copy the literals.
+    auto literals_len = token >> 4;
+    if (literals_len == run_mask && !read_length(literals_len))
+      return fail();
+    if (literals_len > in_size - ipos || literals_len > size - opos)
+      return fail();
+    memcpy(out + opos, in + ipos, literals_len);
+    ipos += literals_len;
+    opos += literals_len;
+    // The last sequence only consists of literals.
+    if (ipos == in_size)
+      break;
+    // Copy the match.
+    if (in_size - ipos < 2)
+      return fail();
+    auto match_offset = std::to_integer<size_t>(in[ipos])
+                        | (std::to_integer<size_t>(in[ipos + 1]) << 8);
+    ipos += 2;
+    if (match_offset == 0 || match_offset > opos)
+      return fail();
+    auto match_len = token & run_mask;
+    if (match_len == run_mask && !read_length(match_len))
+      return fail();
+    match_len += min_match;
+    if (match_len > size - opos)
+      return fail();
+    auto* src = out + opos - match_offset;
+    if (match_offset >= match_len) {
+      memcpy(out + opos, src, match_len);
+    } else {
+      // Overlapping copy, e.g., for repeating a single byte.
+      for (size_t i = 0; i < match_len; ++i)
+        out[opos + i] = src[i];
+    }
+    opos += match_len;
+  }
+  if (opos != size)
+    return fail();
+  return true;
+}
+
+} // namespace caf::io::basp
@@ -0,0 +1,28 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/io/basp/codec.hpp"
+
+#include "caf/detail/io_export.hpp"
+
+namespace caf::io::basp {
+
+/// A built-in codec that produces the LZ4 block format. The implementation
+/// favors speed over compression ratio, i.e., it performs a single greedy pass
+/// over the input and looks up previous occurrences in a small hash table.
+class CAF_IO_EXPORT lz4_codec : public codec {
+public:
+  static constexpr std::string_view codec_name = "lz4";
+
+  std::string_view name() const noexcept override;
+
+  void compress(const_byte_span input, byte_buffer& output) const override;
+
+  bool decompress(const_byte_span input, size_t size,
+                  byte_buffer& output) const override;
+};
+
+} // namespace caf::io::basp
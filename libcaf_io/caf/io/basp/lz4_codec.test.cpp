@@ -0,0 +1,150 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/io/basp/lz4_codec.hpp"
+
+#include "caf/test/test.hpp"
+
+#include <random>
+#include <string_view>
+
+using namespace caf;
+using namespace caf::io::basp;
+
+namespace {
+
+byte_buffer to_bytes(std::string_view str) {
+  byte_buffer result;
+  for (auto c : str)
+    result.push_back(static_cast<std::byte>(c));
+  return result;
+}
+
+byte_buffer random_bytes(size_t size, unsigned seed) {
+  std::minstd_rand rng{seed};
+  byte_buffer result;
+  result.reserve(size);
+  for (size_t i = 0; i < size; ++i)
+    result.push_back(static_cast<std::byte>(rng() & 0xFF));
+  return result;
+}
+
+// Compresses `input` and then decompresses the result again.
+byte_buffer round_trip(const byte_buffer& input, size_t* compressed_size) {
+  lz4_codec uut;
+  byte_buffer compressed;
+  uut.compress(input, compressed);
+  *compressed_size = compressed.size();
+  byte_buffer result;
+  if (!uut.decompress(compressed, input.size(), result))
+    test::runnable::current().fail("failed to decompress {} bytes",
+                                   compressed.size());
+  return result;
+}
+
+} // namespace
+
+TEST("the LZ4 codec restores its input") {
+  size_t compressed_size = 0;
+  SECTION("empty input") {
+    byte_buffer input;
+    check_eq(round_trip(input, &compressed_size), input);
+    check_eq(compressed_size, 1u);
+  }
+  SECTION("short input") {
+    auto input = to_bytes("hello world");
+    check_eq(round_trip(input, &compressed_size), input);
+  }
+  SECTION("repetitive input") {
+    std::string str;
+    for (int i = 0; i < 1000; ++i)
+      str += "hello world ";
+    auto input = to_bytes(str);
+    check_eq(round_trip(input, &compressed_size), input);
+    check_lt(compressed_size, input.size() / 10);
+  }
+  SECTION("runs of a single byte") {
+    auto input = byte_buffer(100'000, std::byte{'x'});
+    check_eq(round_trip(input, &compressed_size), input);
+    check_lt(compressed_size, 1'000u);
+  }
+  SECTION("random input") {
+    for (unsigned seed = 1; seed <= 10; ++seed) {
+      auto input = random_bytes(seed * 1'000, seed);
+      check_eq(round_trip(input, &compressed_size), input);
+    }
+  }
+  SECTION("random input with repetitions") {
+    auto chunk = random_bytes(100, 42);
+    byte_buffer input;
+    for (int i = 0; i < 100; ++i) {
+      input.insert(input.end(), chunk.begin(), chunk.end());
+      auto noise = random_bytes(static_cast<size_t>(i), i);
+      input.insert(input.end(), noise.begin(), noise.end());
+    }
+    check_eq(round_trip(input, &compressed_size), input);
+    check_lt(compressed_size, input.size() / 2);
+  }
+}
+
+TEST("the LZ4 codec appends to its output") {
+  lz4_codec uut;
+  auto input = to_bytes("abcabcabcabcabcabcabcabcabcabcabc");
+  auto compressed = to_bytes("prefix");
+  uut.compress(input, compressed);
+  auto result = to_bytes("prefix");
+  auto compressed_view = const_byte_span{compressed}.subspan(6);
+  if (check(uut.decompress(compressed_view, input.size(), result))) {
+    check_eq(result.size(), input.size() + 6);
+    check_eq(const_byte_span{result}.subspan(6).size(), input.size());
+    check(std::equal(result.begin() + 6, result.end(), input.begin()));
+  }
+}
+
+TEST("the LZ4 codec rejects malformed input") {
+  lz4_codec uut;
+  std::string str;
+  for (int i = 0; i < 100; ++i)
+    str += "hello world ";
+  auto input = to_bytes(str);
+  byte_buffer compressed;
+  uut.compress(input, compressed);
+  byte_buffer output;
+  SECTION("wrong size") {
+    check(!uut.decompress(compressed, input.size() - 1, output));
+    check(output.empty());
+    check(!uut.decompress(compressed, input.size() + 1, output));
+    check(output.empty());
+  }
+  SECTION("truncated input") {
+    for (size_t n = 0; n < compressed.size(); ++n) {
+      auto view = const_byte_span{compressed}.subspan(0, n);
+      check(!uut.decompress(view, input.size(), output));
+      check(output.empty());
+    }
+  }
+  SECTION("offsets before the start of the output") {
+    // Token with 1 literal and a match of length 4 at offset 2.
+    byte_buffer bad{std::byte{0x10}, std::byte{'a'}, std::byte{2},
+                    std::byte{0}};
+    check(!uut.decompress(bad, 5, output));
+    check(output.empty());
+  }
+  SECTION("arbitrary modifications") {
+    // Corrupted input must never crash the decoder or produce more output than
+    // requested. Some modifications still decode successfully, e.g., when
+    // changing a literal.
+    std::minstd_rand rng{1234};
+    for (int i = 0; i < 1'000; ++i) {
+      auto bad = compressed;
+      auto pos = rng() % bad.size();
+      bad[pos] = static_cast<std::byte>(rng() & 0xFF);
+      output.clear();
+      if (uut.decompress(bad, input.size(), output))
+        check_eq(output.size(), input.size());
+      else
+        check(output.empty());
+    }
+  }
+}
@@ -12,7 +12,7 @@ namespace caf::io::basp {
 /// @{
 
 /// The current BASP version. Note: BASP is not backwards compatible.
-constexpr uint64_t version = 8;
+constexpr uint64_t version = 9;
 
 /// @}
 
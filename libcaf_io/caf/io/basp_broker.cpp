@@ -149,11 +149,12 @@ behavior basp_broker::make_behavior() {
         ctx.cstate = next;
       }
     },
-    // received from proxy instances
+    // received from proxy instances, which serialize messages on the sending
+    // thread to take this work off the broker
     [this](forward_atom, strong_actor_ptr& src, strong_actor_ptr& dest,
-           message_id mid, const message& msg) {
-      auto lg = log::io::trace("src = {}, dest = {}, mid = {}, msg = {}", src,
-                               dest, mid, msg);
+           message_id mid, const byte_buffer& payload) {
+      auto lg = log::io::trace("src = {}, dest = {}, mid = {}, size = {}", src,
+                               dest, mid, payload.size());
       if (!dest || system().node() == dest->node()) {
         log::io::warning("cannot forward to invalid "
                          "or local actor: dest = {}",
@@ -163,7 +164,7 @@ behavior basp_broker::make_behavior() {
       if (src && system().node() == src->node())
         system().registry().put(src->id(), src);
       if (!instance.dispatch(context(), src, dest->node(), dest->id(), 0, mid,
-                             msg)
+                             payload)
           && mid.is_request()) {
         detail::sync_request_bouncer srb{exit_reason::remote_link_unreachable};
         srb(src, mid);
@@ -690,6 +691,7 @@ void basp_broker::connection_cleanup(connection_handle hdl, sec code) {
     emit_node_down_msg(nid, code);
     purge_state(nid);
   }
+  instance.erase_peer_codec(hdl);
   // Remove the context for `hdl`, making sure clients receive an error in case
   // this connection was closed during handshake.
   auto i = ctx.find(hdl);
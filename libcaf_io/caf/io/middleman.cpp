@@ -5,6 +5,7 @@
 #include "caf/io/middleman.hpp"
 
 #include "caf/io/basp/header.hpp"
+#include "caf/io/basp/lz4_codec.hpp"
 #include "caf/io/basp_broker.hpp"
 #include "caf/io/network/default_multiplexer.hpp"
 
@@ -31,6 +32,7 @@
 #include "caf/telemetry/metric_registry.hpp"
 #include "caf/thread_owner.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 
@@ -79,6 +81,22 @@ auto make_metrics(telemetry::metric_registry& reg) {
     reg.histogram_singleton<double>(
       "caf.middleman", "serialization-time", default_time_buckets,
       "Time the middleman needs to serialize outbound messages.", "seconds"),
+    reg.counter_singleton(
+      "caf.middleman", "outbound-uncompressed-bytes",
+      "Size of compressed outbound payloads before compressing them.", "bytes",
+      true),
+    reg.counter_singleton(
+      "caf.middleman", "outbound-compressed-bytes",
+      "Size of compressed outbound payloads after compressing them.", "bytes",
+      true),
+    reg.counter_singleton(
+      "caf.middleman", "inbound-compressed-bytes",
+      "Size of compressed inbound payloads before decompressing them.",
+      "bytes", true),
+    reg.counter_singleton(
+      "caf.middleman", "inbound-uncompressed-bytes",
+      "Size of compressed inbound payloads after decompressing them.",
+      "bytes", true),
   };
 }
 
@@ -193,7 +211,11 @@ void middleman::add_module_options(actor_system_config& cfg) {
                    "(disabled if 0, ignored if heartbeats are disabled)")
     .add<bool>("attach-utility-actors",
                "schedule utility actors instead of dedicating threads")
-    .add<size_t>("workers", "number of deserialization workers");
+    .add<size_t>("workers", "number of deserialization workers")
+    .add<std::string>("compression",
+                      "codec for compressing payloads (disabled if empty)")
+    .add<size_t>("compression-threshold",
+                 "min. payload size in bytes for compressing messages");
   config_option_adder{cfg.custom_options(), "caf.middleman.prometheus-http"}
     .add<uint16_t>("port", "listening port for incoming scrapes")
     .add<std::string>("address", "bind address for the HTTP server socket")
@@ -210,6 +232,10 @@ void middleman::add_module_options(actor_system_config& cfg) {
               defaults::middleman::heartbeat_interval);
   put_missing(grp, "connection-timeout",
               defaults::middleman::connection_timeout);
+  put_missing(grp, "compression",
+              std::string{defaults::middleman::compression});
+  put_missing(grp, "compression-threshold",
+              defaults::middleman::compression_threshold);
 }
 
 actor_system_module* middleman::make(actor_system& sys) {
@@ -224,6 +250,18 @@ void middleman::check_abi_compatibility(version::abi_token token) {
 
 middleman::middleman(actor_system& sys) : system_(sys) {
   metric_singletons = make_metrics(sys.metrics());
+  codecs_.push_back(std::make_shared<basp::lz4_codec>());
+}
+
+void middleman::add_codec(basp::codec_ptr ptr) {
+  auto has_name = [&ptr](const basp::codec_ptr& x) {
+    return x->name() == ptr->name();
+  };
+  auto i = std::find_if(codecs_.begin(), codecs_.end(), has_name);
+  if (i != codecs_.end())
+    *i = std::move(ptr);
+  else
+    codecs_.push_back(std::move(ptr));
 }
 
 expected<strong_actor_ptr>
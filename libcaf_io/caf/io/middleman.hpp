@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "caf/io/basp/codec.hpp"
 #include "caf/io/broker.hpp"
 #include "caf/io/middleman_actor.hpp"
 #include "caf/io/network/multiplexer.hpp"
@@ -49,6 +50,18 @@ public:
 
     /// Samples how long the middleman needs to serialize outbound messages.
     telemetry::dbl_histogram* serialization_time = nullptr;
+
+    /// Counts the bytes of outbound payloads before compressing them.
+    telemetry::int_counter* outbound_uncompressed_bytes = nullptr;
+
+    /// Counts the bytes of outbound payloads after compressing them.
+    telemetry::int_counter* outbound_compressed_bytes = nullptr;
+
+    /// Counts the bytes of inbound payloads before decompressing them.
+    telemetry::int_counter* inbound_compressed_bytes = nullptr;
+
+    /// Counts the bytes of inbound payloads after decompressing them.
+    telemetry::int_counter* inbound_uncompressed_bytes = nullptr;
   };
 
   /// Independent tasks that run in the background, usually in their own thread.
@@ -263,6 +276,19 @@ public:
     return {};
   }
 
+  /// Adds a codec for compressing BASP payloads. Nodes announce all of their
+  /// codecs during the handshake and peers pick the codec that matches the
+  /// option `caf.middleman.compression`. Replaces any previously added codec
+  /// with the same name.
+  /// @warning Must not be called after the middleman has opened or connected
+  ///          to any port.
+  void add_codec(basp::codec_ptr ptr);
+
+  /// Returns all codecs for compressing BASP payloads.
+  const std::vector<basp::codec_ptr>& codecs() const noexcept {
+    return codecs_;
+  }
+
   /// @private
   metric_singletons_t metric_singletons;
 
@@ -345,6 +371,9 @@ private:
   /// Stores the port where the Prometheus scraper is listening at (0 if no
   /// scraper is running in the background).
   uint16_t prometheus_scraping_port_ = 0;
+
+  /// Stores all codecs for compressing BASP payloads.
+  std::vector<basp::codec_ptr> codecs_;
 };
 
 } // namespace caf::io
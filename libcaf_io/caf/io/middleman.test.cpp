@@ -7,8 +7,15 @@
 #include "caf/test/fixture/deterministic.hpp"
 #include "caf/test/test.hpp"
 
+#include "caf/io/basp/lz4_codec.hpp"
+
+#include "caf/event_based_actor.hpp"
+#include "caf/scoped_actor.hpp"
+#include "caf/telemetry/counter.hpp"
+
 using namespace caf;
 using namespace caf::io;
+using namespace std::literals;
 
 TEST("GH-1900 regression") {
   // Note: we don't need to actually run `spawn_client`, we only check for a
@@ -23,3 +30,58 @@ TEST("GH-1900 regression") {
   };
   check(std::is_same_v<decltype(fn), decltype(fn)>);
 }
+
+TEST("nodes compress large messages if both sides support the codec") {
+  actor_system_config server_cfg;
+  server_cfg.load<io::middleman>();
+  server_cfg.set("caf.middleman.compression", "lz4");
+  actor_system server{server_cfg};
+  actor_system_config client_cfg;
+  client_cfg.load<io::middleman>();
+  client_cfg.set("caf.middleman.compression", "lz4");
+  client_cfg.set("caf.middleman.compression-threshold", 100);
+  actor_system client{client_cfg};
+  check_eq(server.middleman().codecs().size(), 1u);
+  check_eq(server.middleman().codecs()[0]->name(),
+           basp::lz4_codec::codec_name);
+  auto echo = server.spawn([](event_based_actor*) -> behavior {
+    return {
+      [](const std::string& str) { return str; },
+    };
+  });
+  auto port = server.middleman().publish(echo, 0, "127.0.0.1");
+  require(port.has_value());
+  auto remote_echo = client.middleman().remote_actor("127.0.0.1", *port);
+  require(remote_echo.has_value());
+  scoped_actor self{client};
+  auto run = [&](const std::string& str) {
+    self->mail(str).request(*remote_echo, 10s).receive(
+      [this, &str](const std::string& res) { check_eq(res, str); },
+      [this](const error& err) { fail("unexpected error: {}", err); });
+  };
+  SECTION("small messages remain uncompressed") {
+    run("hello world");
+    auto& metrics = client.middleman().metric_singletons;
+    check_eq(metrics.outbound_compressed_bytes->value(), 0);
+  }
+  SECTION("large messages are compressed") {
+    std::string str;
+    for (int i = 0; i < 100; ++i)
+      str += "hello world ";
+    run(str);
+    auto& client_metrics = client.middleman().metric_singletons;
+    check_gt(client_metrics.outbound_compressed_bytes->value(), 0);
+    check_lt(client_metrics.outbound_compressed_bytes->value(),
+             client_metrics.outbound_uncompressed_bytes->value());
+    auto& server_metrics = server.middleman().metric_singletons;
+    check_eq(server_metrics.inbound_compressed_bytes->value(),
+             client_metrics.outbound_compressed_bytes->value());
+    check_eq(server_metrics.inbound_uncompressed_bytes->value(),
+             client_metrics.outbound_uncompressed_bytes->value());
+    // The response is also large enough for the default threshold.
+    check_gt(client_metrics.inbound_compressed_bytes->value(), 0);
+    check_eq(client_metrics.inbound_compressed_bytes->value(),
+             server_metrics.outbound_compressed_bytes->value());
+  }
+  self->send_exit(echo, exit_reason::user_shutdown);
+}
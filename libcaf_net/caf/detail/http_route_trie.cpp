@@ -0,0 +1,120 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/http_route_trie.hpp"
+
+#include "caf/net/http/request_header.hpp"
+
+#include <algorithm>
+
+namespace caf::detail {
+
+namespace {
+
+bool is_absolute(std::string_view path) {
+  return !path.empty() && path.front() == '/';
+}
+
+} // namespace
+
+// -- constructors, destructors, and assignment operators ----------------------
+
+http_route_trie::http_route_trie(std::vector<net::http::route_ptr> routes)
+  : routes_(std::move(routes)) {
+  nodes_.emplace_back();
+  for (size_t index = 0; index < routes_.size(); ++index) {
+    auto& ptr = routes_[index];
+    auto pattern = ptr->path_pattern();
+    if (!is_absolute(pattern)) {
+      unindexed_.push_back(index);
+      continue;
+    }
+    // Note: we must split the pattern exactly like `match_path` does.
+    auto [head, tail] = next_path_component(pattern);
+    auto pos = child(0, head);
+    while (!tail.empty()) {
+      std::tie(head, tail) = next_path_component(tail);
+      pos = child(pos, head);
+    }
+    nodes_[pos].leaves.push_back(leaf{index, ptr->method_filter()});
+  }
+}
+
+http_route_trie::~http_route_trie() {
+  // nop
+}
+
+// -- lookups ------------------------------------------------------------------
+
+void http_route_trie::candidates(std::string_view path,
+                                 net::http::method method,
+                                 std::vector<size_t>& result) const {
+  result.clear();
+  // Routes without arguments compare the path as a whole. Hence, the trie only
+  // produces the same results as the routes for absolute paths.
+  if (!is_absolute(path)) {
+    result.resize(routes_.size());
+    for (size_t index = 0; index < result.size(); ++index)
+      result[index] = index;
+    return;
+  }
+  collect(0, path, method, result);
+  if (!unindexed_.empty())
+    result.insert(result.end(), unindexed_.begin(), unindexed_.end());
+  if (result.size() > 1)
+    std::sort(result.begin(), result.end());
+}
+
+bool http_route_trie::exec(const net::http::request_header& hdr,
+                           const_byte_span body, net::http::router* parent,
+                           std::vector<size_t>& buf) const {
+  candidates(hdr.path(), hdr.method(), buf);
+  for (auto index : buf)
+    if (routes_[index]->exec(hdr, body, parent))
+      return true;
+  return false;
+}
+
+size_t http_route_trie::child(size_t parent, std::string_view name) {
+  if (name == "<arg>") {
+    if (nodes_[parent].arg_child == 0) {
+      nodes_.emplace_back();
+      nodes_[parent].arg_child = nodes_.size() - 1;
+    }
+    return nodes_[parent].arg_child;
+  }
+  auto& children = nodes_[parent].children;
+  auto less = [](const auto& x, std::string_view y) { return x.first < y; };
+  auto i = std::lower_bound(children.begin(), children.end(), name, less);
+  if (i != children.end() && i->first == name)
+    return i->second;
+  auto pos = nodes_.size();
+  children.emplace(i, std::string{name}, pos);
+  nodes_.emplace_back();
+  return pos;
+}
+
+void http_route_trie::collect(size_t pos, std::string_view path,
+                              net::http::method method,
+                              std::vector<size_t>& result) const {
+  auto [head, tail] = next_path_component(path);
+  auto visit = [&, tail = tail](size_t next) {
+    if (!tail.empty()) {
+      collect(next, tail, method, result);
+      return;
+    }
+    for (auto& x : nodes_[next].leaves)
+      if (!x.method || *x.method == method)
+        result.push_back(x.index);
+  };
+  auto& children = nodes_[pos].children;
+  auto less = [](const auto& x, std::string_view y) { return x.first < y; };
+  auto i = std::lower_bound(children.begin(), children.end(), head, less);
+  if (i != children.end() && i->first == head)
+    visit(i->second);
+  if (auto next = nodes_[pos].arg_child; next != 0)
+    visit(next);
+}
+
+} // namespace caf::detail
@@ -0,0 +1,100 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/net/fwd.hpp"
+#include "caf/net/http/method.hpp"
+#include "caf/net/http/route.hpp"
+
+#include "caf/byte_span.hpp"
+#include "caf/detail/net_export.hpp"
+#include "caf/intrusive_ptr.hpp"
+#include "caf/ref_counted.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace caf::detail {
+
+/// An immutable index over a list of HTTP routes. Stores the path pattern of
+/// each route in a trie with one node per path component, whereas `<arg>`
+/// components map to a wildcard child. Looking up the candidates for a request
+/// thus only depends on the depth of the requested path rather than on the
+/// number of routes. Routes that do not provide a path pattern remain
+/// candidates for all requests.
+class CAF_NET_EXPORT http_route_trie : public ref_counted {
+public:
+  // -- constructors, destructors, and assignment operators --------------------
+
+  explicit http_route_trie(std::vector<net::http::route_ptr> routes);
+
+  ~http_route_trie() override;
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns all routes in registration order.
+  const std::vector<net::http::route_ptr>& routes() const noexcept {
+    return routes_;
+  }
+
+  // -- lookups ----------------------------------------------------------------
+
+  /// Stores the positions of all routes that may match a request to `path`
+  /// with `method` into `result`, sorted by registration order.
+  void candidates(std::string_view path, net::http::method method,
+                  std::vector<size_t>& result) const;
+
+  /// Calls `exec` on each candidate for `hdr` in registration order until a
+  /// route accepts the request.
+  /// @param hdr The HTTP request header from the client.
+  /// @param body The payload from the client.
+  /// @param parent Pointer to the object that uses the routes.
+  /// @param buf Scratch space for storing the candidates.
+  /// @return `true` if a route accepted the request, `false` otherwise.
+  bool exec(const net::http::request_header& hdr, const_byte_span body,
+            net::http::router* parent, std::vector<size_t>& buf) const;
+
+private:
+  /// Points to a route that ends at a node.
+  struct leaf {
+    size_t index;
+    std::optional<net::http::method> method;
+  };
+
+  /// A single node in the trie.
+  struct node {
+    /// Children for literal path components, sorted by name.
+    std::vector<std::pair<std::string, size_t>> children;
+
+    /// Child for `<arg>` components or 0 if there is none.
+    size_t arg_child = 0;
+
+    /// Routes with a pattern that ends at this node.
+    std::vector<leaf> leaves;
+  };
+
+  /// Returns the child of `parent` for `name`, creating it if necessary.
+  size_t child(size_t parent, std::string_view name);
+
+  void collect(size_t pos, std::string_view path, net::http::method method,
+               std::vector<size_t>& result) const;
+
+  /// Stores all routes in registration order.
+  std::vector<net::http::route_ptr> routes_;
+
+  /// Stores the nodes of the trie with the root at position 0.
+  std::vector<node> nodes_;
+
+  /// Stores the positions of routes without path pattern.
+  std::vector<size_t> unindexed_;
+};
+
+/// @relates http_route_trie
+using http_route_trie_ptr = intrusive_ptr<const http_route_trie>;
+
+} // namespace caf::detail
@@ -0,0 +1,143 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/http_route_trie.hpp"
+
+#include "caf/test/test.hpp"
+
+#include "caf/net/http/request_header.hpp"
+#include "caf/net/http/router.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace caf;
+using namespace std::literals;
+
+namespace http = caf::net::http;
+
+using http::make_route;
+using http::responder;
+
+namespace {
+
+struct fixture {
+  std::vector<http::route_ptr> routes;
+  std::vector<size_t> buf;
+  std::string req;
+  http::request_header hdr;
+  http::router rt;
+  std::string called;
+
+  template <class... Ts>
+  void add(Ts&&... xs) {
+    auto res = make_route(std::forward<Ts>(xs)...);
+    if (!res)
+      test::runnable::current().fail("failed to create route: {}",
+                                     res.error());
+    routes.push_back(std::move(*res));
+  }
+
+  std::vector<size_t> candidates(const detail::http_route_trie& uut,
+                                 std::string_view path,
+                                 http::method method = http::method::get) {
+    uut.candidates(path, method, buf);
+    return buf;
+  }
+
+  bool exec(const detail::http_route_trie& uut, std::string_view method,
+            std::string_view path) {
+    req = std::string{method};
+    req += ' ';
+    req += path;
+    req += " HTTP/1.1\r\nHost: localhost:8090\r\n\r\n";
+    auto [status, err_msg] = hdr.parse(req);
+    if (status != http::status::ok)
+      test::runnable::current().fail("failed to parse request: {}", err_msg);
+    called.clear();
+    return uut.exec(hdr, {}, &rt, buf);
+  }
+};
+
+using idx_vec = std::vector<size_t>;
+
+} // namespace
+
+WITH_FIXTURE(fixture) {
+
+TEST("the trie only selects routes with a matching path") {
+  add("/", [](responder&) {});
+  add("/foo", [](responder&) {});
+  add("/foo/bar", [](responder&) {});
+  add("/foo/<arg>", [](responder&, int) {});
+  add("/<arg>/bar", [](responder&, std::string) {});
+  add("/foo/bar/baz", [](responder&) {});
+  detail::http_route_trie uut{routes};
+  check_eq(uut.routes().size(), 6u);
+  check_eq(candidates(uut, "/"), idx_vec{0});
+  check_eq(candidates(uut, "/foo"), idx_vec{1});
+  check_eq(candidates(uut, "/foo/bar"), idx_vec({2, 3, 4}));
+  check_eq(candidates(uut, "/foo/42"), idx_vec{3});
+  check_eq(candidates(uut, "/qux/bar"), idx_vec{4});
+  check_eq(candidates(uut, "/foo/bar/baz"), idx_vec{5});
+  check_eq(candidates(uut, "/foo/bar/baz/qux"), idx_vec{});
+  check_eq(candidates(uut, "/qux"), idx_vec{});
+  check_eq(candidates(uut, "/foo/"), idx_vec{3});
+}
+
+TEST("the trie skips routes with a mismatching method") {
+  add("/foo", http::method::get, [](responder&) {});
+  add("/foo", http::method::post, [](responder&) {});
+  add("/foo", [](responder&) {});
+  add("/<arg>", http::method::put, [](responder&, std::string) {});
+  detail::http_route_trie uut{routes};
+  check_eq(candidates(uut, "/foo", http::method::get), idx_vec({0, 2}));
+  check_eq(candidates(uut, "/foo", http::method::post), idx_vec({1, 2}));
+  check_eq(candidates(uut, "/foo", http::method::put), idx_vec({2, 3}));
+  check_eq(candidates(uut, "/foo", http::method::head), idx_vec{2});
+}
+
+TEST("routes without path pattern are candidates for all requests") {
+  add("/foo", [](responder&) {});
+  add([](responder&) {});
+  add("/bar", [](responder&) {});
+  detail::http_route_trie uut{routes};
+  check_eq(candidates(uut, "/foo"), idx_vec({0, 1}));
+  check_eq(candidates(uut, "/bar"), idx_vec({1, 2}));
+  check_eq(candidates(uut, "/qux"), idx_vec{1});
+}
+
+TEST("the trie selects all routes for paths that are not absolute") {
+  add("/foo", [](responder&) {});
+  add("/<arg>", [](responder&, std::string) {});
+  detail::http_route_trie uut{routes};
+  check_eq(candidates(uut, "*"), idx_vec({0, 1}));
+}
+
+TEST("the trie dispatches to the first route that accepts the request") {
+  add("/foo/<arg>", [this](responder&, int) { called = "int"; });
+  add("/foo/bar", http::method::post,
+      [this](responder&) { called = "post"; });
+  add("/foo/<arg>", [this](responder&, std::string) { called = "string"; });
+  add([this](responder&) { called = "catch-all"; });
+  detail::http_route_trie uut{routes};
+  check(exec(uut, "GET", "/foo/42"));
+  check_eq(called, "int");
+  check(exec(uut, "POST", "/foo/bar"));
+  check_eq(called, "post");
+  check(exec(uut, "GET", "/foo/bar"));
+  check_eq(called, "string");
+  check(exec(uut, "GET", "/foo/bar/baz"));
+  check_eq(called, "catch-all");
+}
+
+TEST("the trie reports when no route accepts the request") {
+  add("/foo/<arg>", [this](responder&, int) { called = "int"; });
+  detail::http_route_trie uut{routes};
+  check(!exec(uut, "GET", "/foo/bar"));
+  check(!exec(uut, "GET", "/bar/42"));
+  check_eq(called, "");
+}
+
+} // WITH_FIXTURE(fixture)
@@ -8,21 +8,104 @@
 
 #include <cstring>
 
+#if defined(__x86_64__) || defined(_M_X64)
+#  define CAF_RFC6455_SSE2
+#  include <emmintrin.h>
+#  if defined(__GNUC__) || defined(__clang__)
+#    define CAF_RFC6455_AVX2
+#    include <immintrin.h>
+#  endif
+#endif
+
 namespace caf::detail {
 
+namespace {
+
+// Each function in this block XORs `key` repeatedly to `data` for as many full
+// blocks as possible and returns the number of processed bytes. Since all
+// block sizes are multiples of four, the caller can continue masking the
+// remaining bytes with the same key.
+
+using mask_blocks_fn = size_t (*)(std::byte*, size_t, uint32_t) noexcept;
+
+size_t mask_words(std::byte* data, size_t size, uint32_t key) noexcept {
+  auto pattern = (uint64_t{key} << 32) | key;
+  size_t pos = 0;
+  for (; pos + 8 <= size; pos += 8) {
+    uint64_t word;
+    memcpy(&word, data + pos, 8);
+    word ^= pattern;
+    memcpy(data + pos, &word, 8);
+  }
+  return pos;
+}
+
+#ifdef CAF_RFC6455_SSE2
+size_t mask_sse2(std::byte* data, size_t size, uint32_t key) noexcept {
+  auto pattern = _mm_set1_epi32(static_cast<int>(key));
+  size_t pos = 0;
+  for (; pos + 16 <= size; pos += 16) {
+    auto ptr = reinterpret_cast<__m128i*>(data + pos);
+    _mm_storeu_si128(ptr, _mm_xor_si128(_mm_loadu_si128(ptr), pattern));
+  }
+  return pos;
+}
+#endif
+
+#ifdef CAF_RFC6455_AVX2
+__attribute__((target("avx2"))) size_t
+mask_avx2(std::byte* data, size_t size, uint32_t key) noexcept {
+  auto pattern = _mm256_set1_epi32(static_cast<int>(key));
+  size_t pos = 0;
+  for (; pos + 32 <= size; pos += 32) {
+    auto ptr = reinterpret_cast<__m256i*>(data + pos);
+    _mm256_storeu_si256(ptr,
+                        _mm256_xor_si256(_mm256_loadu_si256(ptr), pattern));
+  }
+  return pos;
+}
+#endif
+
+// Picks the widest implementation that the CPU supports.
+mask_blocks_fn select_mask_blocks() noexcept {
+#ifdef CAF_RFC6455_AVX2
+  if (__builtin_cpu_supports("avx2"))
+    return mask_avx2;
+#endif
+#ifdef CAF_RFC6455_SSE2
+  return mask_sse2;
+#else
+  return mask_words;
+#endif
+}
+
+} // namespace
+
 void rfc6455::mask_data(uint32_t key, span<char> data, size_t offset) {
   mask_data(key, as_writable_bytes(data), offset);
 }
 
 void rfc6455::mask_data(uint32_t key, byte_span data, size_t offset) {
+  static const auto mask_blocks = select_mask_blocks();
+  if (offset >= data.size())
+    return;
   auto no_key = to_network_order(key);
   std::byte arr[4];
   memcpy(arr, &no_key, 4);
-  auto i = offset % 4;
-  for (auto it = data.begin() + offset; it < data.end(); ++it) {
-    *it ^= arr[i];
-    i = (i + 1) % 4;
-  }
+  // Rotate the key such that its first byte masks the byte at `offset`.
+  std::byte rotated[4];
+  for (size_t i = 0; i < 4; ++i)
+    rotated[i] = arr[(offset + i) % 4];
+  uint32_t rotated_key;
+  memcpy(&rotated_key, rotated, 4);
+  auto* ptr = data.data() + offset;
+  auto size = data.size() - offset;
+  size_t pos = 0;
+  if (size >= 16)
+    pos = mask_blocks(ptr, size, rotated_key);
+  pos += mask_words(ptr + pos, size - pos, rotated_key);
+  for (; pos < size; ++pos)
+    ptr[pos] ^= rotated[pos % 4];
 }
 
 void rfc6455::assemble_frame(uint32_t mask_key, span<const char> data,
@@ -7,10 +7,12 @@
 #include "caf/test/test.hpp"
 
 #include "caf/byte_buffer.hpp"
+#include "caf/log/test.hpp"
 #include "caf/span.hpp"
 
 #include <cstdint>
 #include <initializer_list>
+#include <random>
 #include <vector>
 
 using namespace caf;
@@ -32,6 +34,16 @@ auto take(const T& xs, size_t num_bytes) {
   return std::vector<typename T::value_type>{xs.begin(), xs.begin() + n};
 }
 
+// Masks the data one byte at a time for comparing the results of the optimized
+// implementation.
+void reference_mask(uint32_t key, byte_span data, size_t offset) {
+  std::byte arr[4];
+  for (size_t i = 0; i < 4; ++i)
+    arr[i] = static_cast<std::byte>(key >> (24 - i * 8));
+  for (auto i = offset; i < data.size(); ++i)
+    data[i] ^= arr[i % 4];
+}
+
 } // namespace
 
 TEST("masking the full payload") {
@@ -71,6 +83,28 @@ TEST("partial masking with offset") {
   }
 }
 
+TEST("masking produces the same result as masking byte by byte") {
+  std::minstd_rand rng{42};
+  auto random_byte = [&rng] { return static_cast<std::byte>(rng() & 0xFF); };
+  for (size_t size = 0; size < 300; ++size) {
+    auto key = static_cast<uint32_t>(rng());
+    byte_buffer buf;
+    buf.resize(size + 1);
+    for (auto& x : buf)
+      x = random_byte();
+    // Use an unaligned view for half of the inputs.
+    auto data = make_span(buf).subspan(size % 2, size);
+    auto offset = size > 0 ? rng() % size : 0;
+    auto expected = byte_buffer{data.begin(), data.end()};
+    reference_mask(key, expected, offset);
+    impl::mask_data(key, data, offset);
+    if (!check_eq(byte_buffer{data.begin(), data.end()}, expected)) {
+      log::test::error("size: {}, offset: {}, key: {}", size, offset, key);
+      return;
+    }
+  }
+}
+
 TEST("decoding a frame with RSV bits fails") {
   std::vector<uint8_t> data;
   byte_buffer out = bytes({
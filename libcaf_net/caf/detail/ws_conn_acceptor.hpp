@@ -15,6 +15,8 @@
 #include "caf/expected.hpp"
 #include "caf/intrusive_ptr.hpp"
 
+#include <mutex>
+#include <optional>
 #include <type_traits>
 
 namespace caf::detail {
@@ -30,6 +32,40 @@ public:
 
 using ws_conn_starter_ptr = intrusive_ptr<ws_conn_starter>;
 
+/// Wraps a blocking producer that the connection factory shares with all of
+/// its connections. Since connections may run on different multiplexer
+/// threads, each access to the producer must hold the mutex.
+template <class T>
+class ws_shared_producer {
+public:
+  explicit ws_shared_producer(async::producer_resource<T> push)
+    : producer_(push.try_open()) {
+    // nop
+  }
+
+  bool push(const T& item) {
+    std::lock_guard guard{mtx_};
+    return producer_ && producer_->push(item);
+  }
+
+  bool canceled() const {
+    std::lock_guard guard{mtx_};
+    return !producer_ || producer_->canceled();
+  }
+
+  void abort(const error& reason) {
+    std::lock_guard guard{mtx_};
+    if (producer_) {
+      producer_->abort(reason);
+      producer_.reset();
+    }
+  }
+
+private:
+  mutable std::mutex mtx_;
+  std::optional<async::blocking_producer<T>> producer_;
+};
+
 class CAF_NET_EXPORT ws_conn_acceptor : public ref_counted {
 public:
   virtual ~ws_conn_acceptor();
@@ -53,11 +89,9 @@ public:
     = cow_tuple<async::consumer_resource<net::web_socket::frame>,
                 async::producer_resource<net::web_socket::frame>, Ts...>;
 
-  using producer_type = async::blocking_producer<accept_event>;
+  using producer_type = ws_shared_producer<accept_event>;
 
-  // Note: this is shared with the connection factory. In general, this is
-  //       *unsafe*. However, we exploit the fact that there is currently only
-  //       one thread running in the multiplexer (which makes this safe).
+  // Note: this is shared with the connection factory.
   using shared_producer_type = std::shared_ptr<producer_type>;
 
   /// The pair of resources for the WebSocket worker.
@@ -92,19 +126,19 @@ public:
     = cow_tuple<async::consumer_resource<net::web_socket::frame>,
                 async::producer_resource<net::web_socket::frame>, Ts...>;
 
-  using producer_type = async::blocking_producer<accept_event>;
+  using producer_type = ws_shared_producer<accept_event>;
 
   using shared_producer_type = std::shared_ptr<producer_type>;
 
   ws_conn_acceptor_impl(OnRequest on_request,
                         async::producer_resource<accept_event> push)
     : on_request_(std::move(on_request)) {
-    producer_ = std::make_shared<producer_type>(push.try_open());
+    producer_ = std::make_shared<producer_type>(std::move(push));
   }
 
   expected<ws_conn_starter_ptr> accept(const net::http::request_header& hdr,
                                        net::socket_manager* mgr) override {
-    if (!producer_) {
+    if (producer_->canceled()) {
       return make_error(sec::runtime_error,
                         "WebSocket connection dropped: client canceled");
     }
@@ -122,14 +156,11 @@ public:
   }
 
   bool canceled() const noexcept override {
-    return !producer_ || producer_->canceled();
+    return producer_->canceled();
   }
 
   void abort(const error& reason) override {
-    if (producer_) {
-      producer_->abort(reason);
-      producer_ = nullptr;
-    }
+    producer_->abort(reason);
   }
 
 private:
@@ -74,9 +74,22 @@ public:
       open_connections_.push_back(child->as_disposable());
       if (open_connections_.size() == max_connections_)
         owner_->deregister_reading();
-      child->add_cleanup_listener(on_conn_close_);
-      if (auto err = child->start()) {
-        on_error(err);
+      if (child->mpx_ptr() == owner_->mpx_ptr()) {
+        child->add_cleanup_listener(on_conn_close_);
+        if (auto err = child->start()) {
+          on_error(err);
+        }
+      } else {
+        // The connection runs on another multiplexer. Hence, we need to bounce
+        // the cleanup notification back to our multiplexer and start the
+        // manager in the thread of its multiplexer.
+        auto ctx = async::execution_context_ptr{owner_->mpx_ptr()};
+        child->add_cleanup_listener(
+          make_action([ctx, cb = on_conn_close_] {
+            if (!cb.disposed())
+              ctx->schedule(cb);
+          }));
+        child->mpx().start(child);
       }
     } else if (conn.error() == sec::unavailable_or_would_block) {
       // Encountered a "soft" error: simply try again later.
@@ -128,11 +128,8 @@ bool abstract_actor_shell::enqueue(mailbox_element_ptr ptr, scheduler*) {
   CAF_LOG_SEND_EVENT(ptr);
   auto mid = ptr->mid;
   auto sender = ptr->sender;
-  auto collects_metrics = getf(abstract_actor::collects_metrics_flag);
-  if (collects_metrics) {
+  if (getf(abstract_actor::collects_metrics_flag))
     ptr->set_enqueue_time();
-    metrics_.mailbox_size->inc();
-  }
   switch (mailbox().push_back(std::move(ptr))) {
     case intrusive::inbox_result::unblocked_reader: {
       CAF_LOG_ACCEPT_EVENT(true);
@@ -149,11 +146,13 @@ bool abstract_actor_shell::enqueue(mailbox_element_ptr ptr, scheduler*) {
       // Enqueued to a running actors' mailbox: nothing to do.
       CAF_LOG_ACCEPT_EVENT(false);
       return true;
+    case intrusive::inbox_result::queue_full:
+      // The mailbox dropped the message and took care of the sender.
+      CAF_LOG_REJECT_EVENT();
+      return false;
     default: { // intrusive::inbox_result::queue_closed
       CAF_LOG_REJECT_EVENT();
       home_system().base_metrics().rejected_messages->inc();
-      if (collects_metrics)
-        metrics_.mailbox_size->dec();
       if (mid.is_request()) {
         detail::sync_request_bouncer f{exit_reason()};
         f(sender, mid);
@@ -167,6 +166,10 @@ mailbox_element* abstract_actor_shell::peek_at_next_mailbox_element() {
   return mailbox_.peek(make_message_id());
 }
 
+size_t abstract_actor_shell::approximate_mailbox_size() const noexcept {
+  return mailbox_.approximate_size();
+}
+
 // -- overridden functions of local_actor --------------------------------------
 
 void abstract_actor_shell::launch(scheduler*, bool, bool hide) {
@@ -198,9 +201,8 @@ void abstract_actor_shell::do_unstash(mailbox_element_ptr ptr) {
 
 void abstract_actor_shell::close_mailbox(const error& reason) {
   if (!mailbox_.closed()) {
-    auto dropped = mailbox_.close(reason);
-    if (dropped > 0 && metrics_.mailbox_size)
-      metrics_.mailbox_size->dec(static_cast<int64_t>(dropped));
+    mailbox_.close(reason);
+    stop_reporting_mailbox_size();
   }
 }
 
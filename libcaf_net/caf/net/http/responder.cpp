@@ -5,10 +5,25 @@
 
 namespace caf::net::http {
 
+responder::promise_state::promise_state(lower_layer::server* down)
+  : down_(down) {
+  // HTTP requires us to respond to pipelined requests in order. Hence, we stop
+  // reading until the promise is fulfilled.
+  down_->suspend_reading();
+}
+
 responder::promise_state::~promise_state() {
   if (!completed_) {
     down_->send_response(status::internal_server_error, "text/plain",
                          "Internal server error: broken responder promise.");
+    down_->request_messages();
+  }
+}
+
+void responder::promise_state::set_completed() {
+  if (!completed_) {
+    completed_ = true;
+    down_->request_messages();
   }
 }
 
@@ -29,9 +29,7 @@ public:
   /// Implementation detail for `promise`.
   class CAF_NET_EXPORT promise_state : public ref_counted {
   public:
-    explicit promise_state(lower_layer::server* down) : down_(down) {
-      // nop
-    }
+    explicit promise_state(lower_layer::server* down);
 
     promise_state(const promise_state&) = delete;
 
@@ -45,9 +43,7 @@ public:
     }
 
     /// Marks the promise as fulfilled
-    void set_completed() {
-      completed_ = true;
-    }
+    void set_completed();
 
   private:
     lower_layer::server* down_;
@@ -17,6 +17,14 @@ void route::init() {
   // nop
 }
 
+std::string_view route::path_pattern() const noexcept {
+  return {};
+}
+
+std::optional<http::method> route::method_filter() const noexcept {
+  return std::nullopt;
+}
+
 } // namespace caf::net::http
 
 namespace caf::detail {
@@ -63,4 +71,13 @@ bool http_simple_route_base::exec(const net::http::request_header& hdr,
   return false;
 }
 
+std::string_view http_simple_route_base::path_pattern() const noexcept {
+  return path_;
+}
+
+std::optional<net::http::method>
+http_simple_route_base::method_filter() const noexcept {
+  return method_;
+}
+
 } // namespace caf::detail
@@ -6,6 +6,7 @@
 
 #include "caf/net/fwd.hpp"
 #include "caf/net/http/arg_parser.hpp"
+#include "caf/net/http/method.hpp"
 #include "caf/net/http/request.hpp"
 #include "caf/net/http/request_header.hpp"
 #include "caf/net/http/responder.hpp"
@@ -15,6 +16,7 @@
 #include "caf/intrusive_ptr.hpp"
 #include "caf/ref_counted.hpp"
 
+#include <optional>
 #include <string_view>
 #include <tuple>
 
@@ -39,6 +41,16 @@ public:
   /// Called by the HTTP server when starting up. May be used to spin up workers
   /// that the path dispatches to. The default implementation does nothing.
   virtual void init();
+
+  /// Returns the path this route matches, e.g., `/foo/<arg>`. The @ref router
+  /// uses this information for skipping routes that cannot match a request.
+  /// The default implementation returns an empty string, which means that the
+  /// route may match any path.
+  virtual std::string_view path_pattern() const noexcept;
+
+  /// Returns the HTTP method this route matches or `std::nullopt` if the route
+  /// may match any method. The default implementation returns `std::nullopt`.
+  virtual std::optional<http::method> method_filter() const noexcept;
 };
 
 } // namespace caf::net::http
@@ -118,6 +130,14 @@ public:
     return exec_dis(hdr, body, parent, iseq{}, args);
   }
 
+  std::string_view path_pattern() const noexcept override {
+    return path_;
+  }
+
+  std::optional<net::http::method> method_filter() const noexcept override {
+    return method_;
+  }
+
   template <size_t... Is>
   bool exec_dis(const net::http::request_header& hdr, const_byte_span body,
                 net::http::router* parent, std::index_sequence<Is...>,
@@ -183,6 +203,10 @@ public:
   bool exec(const net::http::request_header& hdr, const_byte_span body,
             net::http::router* parent) override;
 
+  std::string_view path_pattern() const noexcept override;
+
+  std::optional<net::http::method> method_filter() const noexcept override;
+
 private:
   virtual void do_apply(net::http::responder&) = 0;
 
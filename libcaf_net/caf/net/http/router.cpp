@@ -12,6 +12,11 @@ namespace caf::net::http {
 
 // -- constructors and destructors ---------------------------------------------
 
+router::router(std::vector<route_ptr> routes)
+  : routes_(make_counted<detail::http_route_trie>(std::move(routes))) {
+  // nop
+}
+
 router::~router() {
   for (auto& [id, hdl] : pending_)
     hdl.dispose();
@@ -23,6 +28,10 @@ std::unique_ptr<router> router::make(std::vector<route_ptr> routes) {
   return std::make_unique<router>(std::move(routes));
 }
 
+std::unique_ptr<router> router::make(detail::http_route_trie_ptr routes) {
+  return std::make_unique<router>(std::move(routes));
+}
+
 // -- properties ---------------------------------------------------------------
 
 actor_shell* router::self() {
@@ -48,18 +57,27 @@ request router::lift(responder&& res) {
                      down_->add_header_field(key, val);
                    std::ignore = down_->end_header();
                    down_->send_payload(res.body());
-                   pending_.erase(request_id);
+                   complete(request_id);
                  },
                  [this, request_id](const error& err) {
                    auto description = to_string(err);
                    down_->send_response(status::internal_server_error,
                                         "text/plain", description);
-                   pending_.erase(request_id);
+                   complete(request_id);
                  });
   pending_.emplace(request_id, std::move(hdl));
+  // HTTP requires us to respond to pipelined requests in order. Hence, we stop
+  // reading until the response for this request is ready.
+  down_->suspend_reading();
   return lifted;
 }
 
+void router::complete(size_t request_id) {
+  pending_.erase(request_id);
+  if (pending_.empty())
+    down_->request_messages();
+}
+
 void router::shutdown(const error& err) {
   abort_and_shutdown(err);
 }
@@ -92,9 +110,8 @@ error router::start(lower_layer::server* down) {
 }
 
 ptrdiff_t router::consume(const request_header& hdr, const_byte_span payload) {
-  for (auto& ptr : routes_)
-    if (ptr->exec(hdr, payload, this))
-      return static_cast<ptrdiff_t>(payload.size());
+  if (routes_ && routes_->exec(hdr, payload, this, candidates_))
+    return static_cast<ptrdiff_t>(payload.size());
   down_->send_response(http::status::not_found, "text/plain", "Not found.");
   return static_cast<ptrdiff_t>(payload.size());
 }
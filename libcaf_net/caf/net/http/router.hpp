@@ -11,6 +11,7 @@
 #include "caf/net/http/route.hpp"
 #include "caf/net/http/upper_layer.hpp"
 
+#include "caf/detail/http_route_trie.hpp"
 #include "caf/detail/print.hpp"
 #include "caf/expected.hpp"
 #include "caf/intrusive_ptr.hpp"
@@ -32,7 +33,10 @@ public:
 
   router() = default;
 
-  explicit router(std::vector<route_ptr> routes) : routes_(std::move(routes)) {
+  explicit router(std::vector<route_ptr> routes);
+
+  explicit router(detail::http_route_trie_ptr routes)
+    : routes_(std::move(routes)) {
     // nop
   }
 
@@ -42,6 +46,10 @@ public:
 
   static std::unique_ptr<router> make(std::vector<route_ptr> routes);
 
+  /// Creates a new router from pre-indexed routes. Allows multiple routers to
+  /// share the same routes without indexing them once per router.
+  static std::unique_ptr<router> make(detail::http_route_trie_ptr routes);
+
   // -- properties -------------------------------------------------------------
 
   /// Returns a pointer to the underlying HTTP layer.
@@ -78,11 +86,17 @@ public:
   void abort(const error& reason) override;
 
 private:
+  /// Removes a lifted request from `pending_` after sending its response.
+  void complete(size_t request_id);
+
   /// Handle to the underlying HTTP layer.
   lower_layer::server* down_ = nullptr;
 
-  /// List of user-defined routes.
-  std::vector<route_ptr> routes_;
+  /// Index over the user-defined routes.
+  detail::http_route_trie_ptr routes_;
+
+  /// Scratch space for looking up candidate routes.
+  std::vector<size_t> candidates_;
 
   /// Generates ascending IDs for `pending_`.
   size_t request_id_ = 0;
@@ -10,6 +10,7 @@
 #include "caf/net/receive_policy.hpp"
 #include "caf/net/socket_manager.hpp"
 
+#include "caf/byte_buffer.hpp"
 #include "caf/byte_span.hpp"
 #include "caf/defaults.hpp"
 #include "caf/detail/format.hpp"
@@ -17,6 +18,8 @@
 #include "caf/log/net.hpp"
 
 #include <algorithm>
+#include <optional>
+#include <string_view>
 
 namespace caf::net::http {
 
@@ -30,9 +33,15 @@ public:
   enum class mode {
     read_header,
     read_payload,
-    read_chunks,
+    read_chunk_size,
+    read_chunk_data,
+    read_chunk_end,
+    read_trailer,
   };
 
+  /// Limits the size of chunk headers and trailer fields.
+  static constexpr size_t max_line_size = 4096;
+
   // -- constructors, destructors, and assignment operators --------------------
 
   explicit server_impl(upper_layer_ptr up) : up_(std::move(up)) {
@@ -150,7 +159,14 @@ public:
   ptrdiff_t consume(byte_span input, byte_span) override {
     auto lg = log::net::trace("bytes = {}", input.size());
     ptrdiff_t consumed = 0;
-    for (;;) {
+    auto advance = [&consumed, &input](size_t n) {
+      consumed += static_cast<ptrdiff_t>(n);
+      input = input.subspan(n);
+    };
+    // Note: the upper layer may suspend reading after receiving a request,
+    //       e.g., to respond asynchronously. In this case, we must not process
+    //       any pipelined request until the upper layer resumes reading.
+    while (down_->is_reading()) {
       switch (mode_) {
         case mode::read_header: {
           auto [hdr, remainder] = v1::split_header(input);
@@ -169,20 +185,18 @@ public:
             return -1;
           } else {
             // Prepare for next loop iteration.
-            consumed += static_cast<ptrdiff_t>(hdr.size());
-            input = remainder;
+            advance(hdr.size());
             // Transition to the next mode.
             if (hdr_.chunked_transfer_encoding()) {
-              mode_ = mode::read_chunks;
-            } else if (auto len = hdr_.content_length()) {
-              // Protect against payloads that exceed the maximum size.
-              if (*len >= max_request_size_) {
-                up_->abort(make_error(sec::protocol_error,
-                                      "payload exceeds maximum size"));
-                write_response(status::payload_too_large,
-                               "Payload exceeds maximum size.");
-                return -1;
-              }
+              streaming_ = up_->begin_payload(hdr_);
+              body_.clear();
+              mode_ = mode::read_chunk_size;
+            } else if (auto len = hdr_.content_length(); len && *len > 0) {
+              streaming_ = up_->begin_payload(hdr_);
+              // Protect against payloads that exceed the maximum size unless
+              // the upper layer receives the payload piece by piece.
+              if (!streaming_ && *len >= max_request_size_)
+                return payload_too_large();
               // Transition to read_payload mode and continue.
               payload_len_ = *len;
               mode_ = mode::read_payload;
@@ -197,25 +211,96 @@ public:
           break;
         }
         case mode::read_payload: {
-          if (input.size() >= payload_len_) {
-            if (!invoke_upper_layer(input.subspan(0, payload_len_)))
+          if (streaming_) {
+            if (input.empty())
+              return consumed;
+            auto n = std::min(input.size(), payload_len_);
+            if (up_->consume_payload(input.subspan(0, n)) < 0)
               return -1;
-            consumed += static_cast<ptrdiff_t>(payload_len_);
+            advance(n);
+            payload_len_ -= n;
+            if (payload_len_ == 0) {
+              mode_ = mode::read_header;
+              if (!up_->end_payload())
+                return -1;
+            }
+          } else if (input.size() >= payload_len_) {
             mode_ = mode::read_header;
+            if (!invoke_upper_layer(input.subspan(0, payload_len_)))
+              return -1;
+            advance(payload_len_);
           } else {
             // Wait for more data.
             return consumed;
           }
           break;
         }
-        case mode::read_chunks: {
-          // TODO: implement me
-          write_response(status::not_implemented,
-                         "Chunked transfer not implemented yet.");
-          return -1;
+        case mode::read_chunk_size: {
+          auto line = next_line(input);
+          if (!line)
+            return incomplete_line(input) ? consumed : bad_chunk();
+          auto chunk_size = parse_chunk_size(*line);
+          if (!chunk_size)
+            return bad_chunk();
+          advance(line->size() + 2);
+          if (*chunk_size == 0) {
+            mode_ = mode::read_trailer;
+          } else if (!streaming_
+                     && *chunk_size >= max_request_size_ - body_.size()) {
+            return payload_too_large();
+          } else {
+            payload_len_ = *chunk_size;
+            mode_ = mode::read_chunk_data;
+          }
+          break;
+        }
+        case mode::read_chunk_data: {
+          if (input.empty())
+            return consumed;
+          auto n = std::min(input.size(), payload_len_);
+          auto bytes = input.subspan(0, n);
+          if (streaming_) {
+            if (up_->consume_payload(bytes) < 0)
+              return -1;
+          } else {
+            body_.insert(body_.end(), bytes.begin(), bytes.end());
+          }
+          advance(n);
+          payload_len_ -= n;
+          if (payload_len_ == 0)
+            mode_ = mode::read_chunk_end;
+          break;
+        }
+        case mode::read_chunk_end: {
+          if (input.size() < 2)
+            return consumed;
+          if (input[0] != std::byte{'\r'} || input[1] != std::byte{'\n'})
+            return bad_chunk();
+          advance(2);
+          mode_ = mode::read_chunk_size;
+          break;
+        }
+        case mode::read_trailer: {
+          // We ignore any trailer fields and wait for the empty line that
+          // terminates the message.
+          auto line = next_line(input);
+          if (!line)
+            return incomplete_line(input) ? consumed : bad_chunk();
+          advance(line->size() + 2);
+          if (line->empty()) {
+            mode_ = mode::read_header;
+            if (streaming_) {
+              if (!up_->end_payload())
+                return -1;
+            } else if (!invoke_upper_layer(body_)) {
+              return -1;
+            }
+          }
+          break;
         }
       }
     }
+    return consumed;
   }
 
 private:
@@ -231,6 +316,61 @@ private:
     return up_->consume(hdr_, payload) >= 0;
   }
 
+  ptrdiff_t payload_too_large() {
+    up_->abort(make_error(sec::protocol_error, "payload exceeds maximum size"));
+    write_response(status::payload_too_large, "Payload exceeds maximum size.");
+    return -1;
+  }
+
+  ptrdiff_t bad_chunk() {
+    log::net::debug("received malformed chunk");
+    up_->abort(make_error(sec::protocol_error, "received malformed chunk"));
+    write_response(status::bad_request, "Malformed chunked payload.");
+    return -1;
+  }
+
+  /// Returns the first line in `input` without the trailing CRLF or
+  /// `std::nullopt` if `input` contains no CRLF.
+  static std::optional<std::string_view> next_line(const_byte_span input) {
+    auto str = std::string_view{reinterpret_cast<const char*>(input.data()),
+                                input.size()};
+    if (auto pos = str.find("\r\n"); pos != std::string_view::npos)
+      return str.substr(0, pos);
+    return std::nullopt;
+  }
+
+  /// Checks whether `input` may still become a valid line when receiving
+  /// more data.
+  static bool incomplete_line(const_byte_span input) {
+    return input.size() < max_line_size;
+  }
+
+  /// Parses the size of the next chunk from a line in the format
+  /// `<hex-size>[;<extensions>]`.
+  static std::optional<size_t> parse_chunk_size(std::string_view line) {
+    if (auto pos = line.find(';'); pos != std::string_view::npos)
+      line = line.substr(0, pos);
+    while (!line.empty() && (line.back() == ' ' || line.back() == '\t'))
+      line.remove_suffix(1);
+    // Note: rejecting the largest number of hex digits guarantees that the
+    //       chunk size cannot overflow.
+    if (line.empty() || line.size() >= sizeof(size_t) * 2)
+      return std::nullopt;
+    size_t result = 0;
+    for (auto c : line) {
+      result <<= 4;
+      if (c >= '0' && c <= '9')
+        result |= static_cast<size_t>(c - '0');
+      else if (c >= 'a' && c <= 'f')
+        result |= static_cast<size_t>(c - 'a' + 10);
+      else if (c >= 'A' && c <= 'F')
+        result |= static_cast<size_t>(c - 'A' + 10);
+      else
+        return std::nullopt;
+    }
+    return result;
+  }
+
   bool handle_header(std::string_view http) {
     // Parse the header and reject invalid inputs.
     auto [code, msg] = hdr_.parse(http);
@@ -254,9 +394,17 @@ private:
   /// Stores whether we are currently waiting for the payload.
   mode mode_ = mode::read_header;
 
-  /// Stores the expected payload size when in read_payload mode.
+  /// Stores the remaining payload size when in read_payload mode or the
+  /// remaining chunk size when in read_chunk_data mode.
   size_t payload_len_ = 0;
 
+  /// Stores whether the upper layer receives the current payload piece by
+  /// piece.
+  bool streaming_ = false;
+
+  /// Buffers the payload of chunked messages unless streaming.
+  byte_buffer body_;
+
   /// Maximum size for incoming HTTP requests.
   size_t max_request_size_ = caf::defaults::net::http_max_request_size;
 };
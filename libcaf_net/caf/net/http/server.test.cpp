@@ -16,6 +16,8 @@
 #include "caf/net/stream_socket.hpp"
 
 #include "caf/async/promise.hpp"
+#include "caf/defaults.hpp"
+#include "caf/detail/format.hpp"
 #include "caf/raise_error.hpp"
 
 using namespace caf;
@@ -89,6 +91,32 @@ public:
     cb(down, request_hdr, body);
     return static_cast<ptrdiff_t>(body.size());
   }
+
+  bool begin_payload(const net::http::request_header& request_hdr) override {
+    if (streaming) {
+      streamed_hdr = request_hdr;
+      streamed_payload.clear();
+    }
+    return streaming;
+  }
+
+  ptrdiff_t consume_payload(const_byte_span bytes) override {
+    streamed_payload.insert(streamed_payload.end(), bytes.begin(), bytes.end());
+    return static_cast<ptrdiff_t>(bytes.size());
+  }
+
+  bool end_payload() override {
+    cb(down, streamed_hdr, streamed_payload);
+    return true;
+  }
+
+  // -- state for receiving payloads piece by piece ----------------------------
+
+  bool streaming = false;
+
+  net::http::request_header streamed_hdr;
+
+  byte_buffer streamed_payload;
 };
 
 auto to_str(caf::byte_span buffer) {
@@ -140,6 +168,45 @@ struct fixture {
     fd2.id = net::invalid_socket_id;
   }
 
+  template <class Callback>
+  void run_streaming_server(Callback cb, async::promise<response_t> res = {}) {
+    auto app = app_t::make(std::move(cb), std::move(res));
+    app->streaming = true;
+    auto server = net::http::server::make(std::move(app));
+    auto transport = net::octet_stream::transport::make(fd2, std::move(server));
+    auto mgr = net::socket_manager::make(mpx.get(), std::move(transport));
+    mpx->start(mgr);
+    fd2.id = net::invalid_socket_id;
+  }
+
+  // Writes all of `str` to `fd1`.
+  void write_all(std::string_view str) {
+    auto bytes = as_bytes(make_span(str));
+    while (!bytes.empty()) {
+      auto res = net::write(fd1, bytes);
+      if (res <= 0)
+        CAF_RAISE_ERROR("failed to write to fd1");
+      bytes = bytes.subspan(static_cast<size_t>(res));
+    }
+  }
+
+  // Reads exactly `n` bytes from `fd1`.
+  std::string read_exactly(size_t n) {
+    std::string result;
+    result.resize(n);
+    size_t pos = 0;
+    while (pos < n) {
+      auto buf = as_writable_bytes(make_span(result.data() + pos, n - pos));
+      auto res = net::read(fd1, buf);
+      if (res <= 0) {
+        result.resize(pos);
+        return result;
+      }
+      pos += static_cast<size_t>(res);
+    }
+    return result;
+  }
+
   net::multiplexer_ptr mpx;
   net::stream_socket fd1;
   net::stream_socket fd2;
@@ -234,4 +301,157 @@ SCENARIO("the client receives a chunked HTTP response") {
   }
 }
 
+SCENARIO("the server decodes chunked HTTP request payloads") {
+  GIVEN("a valid HTTP POST request with a chunked payload") {
+    std::string_view request = "POST /foo HTTP/1.1\r\n"
+                               "Host: localhost:8090\r\n"
+                               "Transfer-Encoding: chunked\r\n\r\n"
+                               "C\r\n"
+                               "Hello world!\r\n"
+                               "11;name=value\r\n"
+                               "Developer Network\r\n"
+                               "0\r\n"
+                               "Foo: bar\r\n"
+                               "\r\n";
+    WHEN("sending it to an HTTP server") {
+      async::promise<response_t> res_promise;
+      run_server([res_promise](auto* down,
+                               const net::http::request_header& request_hdr,
+                               const_byte_span body) mutable {
+        response_t res;
+        res.hdr = request_hdr;
+        res.payload.assign(body.begin(), body.end());
+        res_promise.set_value(std::move(res));
+        down->send_response(net::http::status::no_content);
+      });
+      write_all(request);
+      THEN("the application layer receives the decoded payload") {
+        auto maybe_res = res_promise.get_future().get(1s);
+        require(maybe_res.has_value());
+        check_eq(maybe_res->hdr.method(), net::http::method::post);
+        check_eq(maybe_res->hdr.path(), "/foo");
+        check_eq(maybe_res->payload_as_str(), "Hello world!Developer Network");
+      }
+    }
+  }
+  GIVEN("an HTTP POST request with a malformed chunk size") {
+    std::string_view request = "POST /foo HTTP/1.1\r\n"
+                               "Host: localhost:8090\r\n"
+                               "Transfer-Encoding: chunked\r\n\r\n"
+                               "XYZ\r\n"
+                               "Hello world!\r\n"
+                               "0\r\n\r\n";
+    std::string_view response = "HTTP/1.1 400 Bad Request\r\n";
+    WHEN("sending it to an HTTP server") {
+      run_server(
+        [](auto*, const net::http::request_header&, const_byte_span) {});
+      write_all(request);
+      THEN("the server responds with an error") {
+        check_eq(read_exactly(response.size()), response);
+      }
+    }
+  }
+}
+
+SCENARIO("the server may pass payloads piece by piece to the upper layer") {
+  GIVEN("an HTTP POST request with a payload that exceeds the maximum size") {
+    std::string payload;
+    for (size_t i = 0; i < 3 * defaults::net::http_max_request_size; ++i)
+      payload += static_cast<char>('a' + i % 26);
+    WHEN("sending it to a streaming HTTP server with a Content-Length") {
+      async::promise<response_t> res_promise;
+      run_streaming_server(
+        [res_promise](auto* down, const net::http::request_header& request_hdr,
+                      const_byte_span body) mutable {
+          response_t res;
+          res.hdr = request_hdr;
+          res.payload.assign(body.begin(), body.end());
+          res_promise.set_value(std::move(res));
+          down->send_response(net::http::status::no_content);
+        });
+      auto request = "POST /upload HTTP/1.1\r\n"
+                     "Host: localhost:8090\r\n"
+                     "Content-Length: "
+                     + std::to_string(payload.size()) + "\r\n\r\n" + payload;
+      write_all(request);
+      THEN("the application layer receives the full payload") {
+        auto maybe_res = res_promise.get_future().get(5s);
+        require(maybe_res.has_value());
+        check_eq(maybe_res->hdr.path(), "/upload");
+        check_eq(maybe_res->payload.size(), payload.size());
+        check(maybe_res->payload_as_str() == payload);
+      }
+    }
+    WHEN("sending it to a streaming HTTP server in chunks") {
+      async::promise<response_t> res_promise;
+      run_streaming_server(
+        [res_promise](auto* down, const net::http::request_header& request_hdr,
+                      const_byte_span body) mutable {
+          response_t res;
+          res.hdr = request_hdr;
+          res.payload.assign(body.begin(), body.end());
+          res_promise.set_value(std::move(res));
+          down->send_response(net::http::status::no_content);
+        });
+      std::string request = "POST /upload HTTP/1.1\r\n"
+                            "Host: localhost:8090\r\n"
+                            "Transfer-Encoding: chunked\r\n\r\n";
+      auto chunk_size = payload.size() / 3;
+      for (size_t pos = 0; pos < payload.size(); pos += chunk_size) {
+        request += detail::format("{:x}\r\n", chunk_size);
+        request += payload.substr(pos, chunk_size);
+        request += "\r\n";
+      }
+      request += "0\r\n\r\n";
+      write_all(request);
+      THEN("the application layer receives the full payload") {
+        auto maybe_res = res_promise.get_future().get(5s);
+        require(maybe_res.has_value());
+        check_eq(maybe_res->hdr.path(), "/upload");
+        check_eq(maybe_res->payload.size(), payload.size());
+        check(maybe_res->payload_as_str() == payload);
+      }
+    }
+  }
+}
+
+SCENARIO("the server processes pipelined requests in order") {
+  GIVEN("multiple HTTP requests that arrive at once") {
+    std::string_view requests = "GET /one HTTP/1.1\r\n"
+                                "Host: localhost:8090\r\n\r\n"
+                                "POST /two HTTP/1.1\r\n"
+                                "Host: localhost:8090\r\n"
+                                "Content-Length: 5\r\n\r\n"
+                                "hello"
+                                "POST /three HTTP/1.1\r\n"
+                                "Host: localhost:8090\r\n"
+                                "Transfer-Encoding: chunked\r\n\r\n"
+                                "5\r\nworld\r\n0\r\n\r\n"
+                                "GET /four HTTP/1.1\r\n"
+                                "Host: localhost:8090\r\n\r\n";
+    std::string expected;
+    for (auto str : {"/one:"sv, "/two:hello"sv, "/three:world"sv, "/four:"sv})
+      expected += detail::format("HTTP/1.1 200 OK\r\n"
+                                 "Content-Type: text/plain\r\n"
+                                 "Content-Length: {}\r\n"
+                                 "\r\n"
+                                 "{}",
+                                 str.size(), str);
+    WHEN("sending them to an HTTP server") {
+      run_server([](auto* down, const net::http::request_header& request_hdr,
+                    const_byte_span body) {
+        auto str = std::string{request_hdr.path()};
+        str += ':';
+        str.insert(str.end(), reinterpret_cast<const char*>(body.data()),
+                   reinterpret_cast<const char*>(body.data()) + body.size());
+        down->send_response(net::http::status::ok, "text/plain", str);
+      });
+      write_all(requests);
+      THEN("the server responds to each request in order") {
+        check_eq(read_exactly(expected.size()), expected);
+      }
+    }
+  }
+}
+
 } // WITH_FIXTURE(fixture)
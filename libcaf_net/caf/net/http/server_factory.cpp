@@ -72,7 +72,7 @@ public:
                      std::vector<net::http::route_ptr> routes,
                      size_t max_consecutive_reads, size_t max_request_size)
     : acceptor_(std::move(acceptor)),
-      routes_(std::move(routes)),
+      routes_(make_counted<detail::http_route_trie>(std::move(routes))),
       max_consecutive_reads_(max_consecutive_reads),
       max_request_size_(max_request_size) {
     // nop
@@ -106,9 +106,11 @@ public:
                                                      std::move(serv));
     transport->max_consecutive_reads(max_consecutive_reads_);
     transport->active_policy().accept();
-    auto* mpx = parent_->mpx_ptr();
+    // Note: the watch list is not thread-safe, so we always add the new
+    // connection to the watch list of our own multiplexer.
+    auto* mpx = parent_->mpx().select_for_connection();
     auto res = net::socket_manager::make(mpx, std::move(transport));
-    mpx->watch(res->as_disposable());
+    parent_->mpx().watch(res->as_disposable());
     return res;
   }
 
@@ -122,7 +124,7 @@ public:
 private:
   net::socket_manager* parent_ = nullptr;
   Acceptor acceptor_;
-  std::vector<net::http::route_ptr> routes_;
+  detail::http_route_trie_ptr routes_;
   size_t max_consecutive_reads_;
   size_t max_request_size_;
 };
@@ -4,6 +4,8 @@
 
 #include "caf/net/http/upper_layer.hpp"
 
+#include "caf/byte_span.hpp"
+
 using namespace std::literals;
 
 namespace caf::net::http {
@@ -16,6 +18,18 @@ upper_layer::server::~server() {
   // nop
 }
 
+bool upper_layer::server::begin_payload(const request_header&) {
+  return false;
+}
+
+ptrdiff_t upper_layer::server::consume_payload(const_byte_span bytes) {
+  return static_cast<ptrdiff_t>(bytes.size());
+}
+
+bool upper_layer::server::end_payload() {
+  return true;
+}
+
 upper_layer::client::~client() {
   // nop
 }
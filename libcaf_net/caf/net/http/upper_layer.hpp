@@ -36,6 +36,28 @@ public:
   virtual ptrdiff_t consume(const request_header& hdr, const_byte_span payload)
     = 0;
 
+  /// Called for each HTTP message that has a payload before receiving any
+  /// part of the payload. Returning `true` causes the server to pass the
+  /// payload to `consume_payload` piece by piece as it arrives instead of
+  /// buffering the payload and calling `consume`. This allows the upper layer
+  /// to receive payloads that exceed the maximum request size. The default
+  /// implementation returns `false`.
+  /// @param hdr The header fields for the received message.
+  virtual bool begin_payload(const request_header& hdr);
+
+  /// Consumes a piece of the payload after `begin_payload` returned `true`.
+  /// The server removes chunked transfer encoding before passing the payload.
+  /// @param bytes The next piece of the payload.
+  /// @returns The number of consumed bytes or a negative value to signal an
+  ///          error.
+  /// @note Discarded data is lost permanently.
+  virtual ptrdiff_t consume_payload(const_byte_span bytes);
+
+  /// Signals that the upper layer has received the full payload after
+  /// `begin_payload` returned `true`.
+  /// @returns `false` to signal an error, `true` otherwise.
+  virtual bool end_payload();
+
   /// Initializes the upper layer.
   /// @param down A pointer to the lower layer that remains valid for the
   ///             lifetime of the upper layer.
@@ -63,11 +63,11 @@ private:
   intrusive_ptr<config_type> config_;
 };
 
-with_t with(actor_system& sys) {
+inline with_t with(actor_system& sys) {
   return with_t{multiplexer::from(sys)};
 }
 
-with_t with(multiplexer* mpx) {
+inline with_t with(multiplexer* mpx) {
   return with_t{mpx};
 }
 
@@ -10,6 +10,7 @@
 #include "caf/net/this_host.hpp"
 
 #include "caf/actor_system_config.hpp"
+#include "caf/defaults.hpp"
 #include "caf/expected.hpp"
 #include "caf/log/net.hpp"
 #include "caf/log/system.hpp"
@@ -99,9 +100,18 @@ actor_system::global_state_guard middleman::init_host_system() {
   }};
 }
 
-middleman::middleman(actor_system& sys)
-  : sys_(sys), mpx_(multiplexer::make(this)) {
-  // nop
+middleman::middleman(actor_system& sys) : sys_(sys) {
+  auto backend = get_or(sys.config(), "caf.net.multiplexer-backend",
+                        defaults::net::multiplexer_backend);
+  auto num_threads = get_or(sys.config(), "caf.net.multiplexer-threads",
+                            defaults::net::multiplexer_threads);
+  if (num_threads == 0) {
+    log::system::warning("caf.net.multiplexer-threads must be at least 1");
+    num_threads = 1;
+  }
+  mpx_.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; ++i)
+    mpx_.emplace_back(multiplexer::make(this, backend));
 }
 
 middleman::~middleman() {
@@ -109,29 +119,49 @@ middleman::~middleman() {
 }
 
 void middleman::start() {
-  auto fn = [this] {
-    mpx_->set_thread_id();
-    launch_background_tasks(sys_);
-    mpx_->run();
-  };
-  mpx_thread_ = sys_.launch_thread("caf.net.mpx", thread_owner::system, fn);
+  mpx_threads_.reserve(mpx_.size());
+  for (size_t i = 0; i < mpx_.size(); ++i) {
+    auto fn = [this, i] {
+      auto& mpx = mpx_[i];
+      mpx->set_thread_id();
+      if (i == 0)
+        launch_background_tasks(sys_);
+      mpx->run();
+    };
+    mpx_threads_.emplace_back(
+      sys_.launch_thread("caf.net.mpx", thread_owner::system, fn));
+  }
 }
 
 void middleman::stop() {
-  mpx_->shutdown();
-  if (mpx_thread_.joinable())
-    mpx_thread_.join();
-  else
-    mpx_->run();
+  for (auto& mpx : mpx_)
+    mpx->shutdown();
+  if (!mpx_threads_.empty()) {
+    for (auto& thread : mpx_threads_)
+      thread.join();
+    mpx_threads_.clear();
+  } else {
+    for (auto& mpx : mpx_)
+      mpx->run();
+  }
 }
 
 void middleman::init(actor_system_config&) {
-  if (auto err = mpx_->init()) {
-    log::system::error("failed to initialize multiplexer: {}", err);
-    CAF_RAISE_ERROR("mpx_->init() failed");
+  for (auto& mpx : mpx_) {
+    if (auto err = mpx->init()) {
+      log::system::error("failed to initialize multiplexer: {}", err);
+      CAF_RAISE_ERROR("mpx->init() failed");
+    }
   }
 }
 
+multiplexer* middleman::next_mpx_ptr() noexcept {
+  if (mpx_.size() == 1)
+    return mpx_.front().get();
+  auto index = next_mpx_.fetch_add(1, std::memory_order_relaxed);
+  return mpx_[index % mpx_.size()].get();
+}
+
 middleman::actor_system_module::id_t middleman::id() const {
   return actor_system_module::network_manager;
 }
@@ -141,6 +171,11 @@ void* middleman::subtype_ptr() {
 }
 
 void middleman::add_module_options(actor_system_config& cfg) {
+  config_option_adder{cfg.custom_options(), "caf.net"}
+    .add<std::string>("multiplexer-backend",
+                      "sets the I/O event notification backend: poll or epoll")
+    .add<size_t>("multiplexer-threads",
+                 "sets the number of threads for running socket managers");
   config_option_adder{cfg.custom_options(), "caf.net.prometheus-http"}
     .add<uint16_t>("port", "listening port for incoming scrapes")
     .add<std::string>("address", "bind address for the HTTP server socket")
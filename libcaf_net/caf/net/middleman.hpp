@@ -14,7 +14,9 @@
 #include "caf/type_list.hpp"
 #include "caf/version.hpp"
 
+#include <atomic>
 #include <thread>
+#include <vector>
 
 namespace caf::net {
 
@@ -79,29 +81,53 @@ public:
     return sys_.config();
   }
 
+  /// Returns the first multiplexer, which also runs all listening sockets.
   multiplexer& mpx() noexcept {
-    return *mpx_;
+    return *mpx_.front();
   }
 
+  /// @copydoc mpx
   const multiplexer& mpx() const noexcept {
-    return *mpx_;
+    return *mpx_.front();
   }
 
+  /// @copydoc mpx
   multiplexer* mpx_ptr() const noexcept {
-    return mpx_.get();
+    return mpx_.front().get();
   }
 
+  /// Returns the number of multiplexers, i.e., the number of threads for
+  /// running socket managers.
+  size_t num_mpx() const noexcept {
+    return mpx_.size();
+  }
+
+  /// Returns the multiplexer at `index`.
+  /// @pre `index < num_mpx()`
+  multiplexer* mpx_ptr(size_t index) const noexcept {
+    return mpx_[index].get();
+  }
+
+  /// Returns the multiplexer for the next incoming connection. Distributes
+  /// connections in round-robin order across all multiplexers.
+  /// @threadsafe
+  multiplexer* next_mpx_ptr() noexcept;
+
 private:
   // -- member variables -------------------------------------------------------
 
   /// Points to the parent system.
   actor_system& sys_;
 
-  /// Stores the global socket I/O multiplexer.
-  multiplexer_ptr mpx_;
+  /// Stores the socket I/O multiplexers. Each multiplexer runs in its own
+  /// thread and owns a disjoint set of socket managers.
+  std::vector<multiplexer_ptr> mpx_;
+
+  /// Runs the multiplexers' event loops.
+  std::vector<std::thread> mpx_threads_;
 
-  /// Runs the multiplexer's event loop
-  std::thread mpx_thread_;
+  /// Selects the multiplexer for the next call to `next_mpx_ptr`.
+  std::atomic<size_t> next_mpx_ = 0;
 };
 
 } // namespace caf::net
@@ -0,0 +1,126 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/net/middleman.hpp"
+
+#include "caf/test/test.hpp"
+
+#include "caf/net/lp/with.hpp"
+#include "caf/net/multiplexer.hpp"
+#include "caf/net/network_socket.hpp"
+#include "caf/net/socket.hpp"
+#include "caf/net/stream_socket.hpp"
+#include "caf/net/tcp_accept_socket.hpp"
+#include "caf/net/tcp_stream_socket.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/byte_buffer.hpp"
+#include "caf/detail/network_order.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/scheduled_actor/flow.hpp"
+
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace caf;
+
+namespace {
+
+byte_buffer encode(std::string_view msg) {
+  byte_buffer bytes;
+  using detail::to_network_order;
+  auto prefix = to_network_order(static_cast<uint32_t>(msg.size()));
+  auto prefix_bytes = as_bytes(make_span(&prefix, 1));
+  bytes.insert(bytes.end(), prefix_bytes.begin(), prefix_bytes.end());
+  auto msg_bytes = as_bytes(make_span(msg));
+  bytes.insert(bytes.end(), msg_bytes.begin(), msg_bytes.end());
+  return bytes;
+}
+
+// Reads exactly `n` bytes from `fd` in blocking mode.
+byte_buffer read_exactly(net::stream_socket fd, size_t n) {
+  byte_buffer result;
+  result.resize(n);
+  size_t pos = 0;
+  while (pos < n) {
+    auto res = net::read(fd, make_span(result.data() + pos, n - pos));
+    if (res <= 0) {
+      result.resize(pos);
+      return result;
+    }
+    pos += static_cast<size_t>(res);
+  }
+  return result;
+}
+
+} // namespace
+
+TEST("the middleman runs a single multiplexer by default") {
+  actor_system_config cfg;
+  cfg.load<net::middleman>();
+  actor_system sys{cfg};
+  auto& mm = sys.network_manager();
+  check_eq(mm.num_mpx(), 1u);
+  check_eq(mm.next_mpx_ptr(), mm.mpx_ptr());
+  check_eq(mm.mpx().select_for_connection(), mm.mpx_ptr());
+}
+
+TEST("the middleman assigns connections to multiplexers in round-robin order") {
+  actor_system_config cfg;
+  cfg.load<net::middleman>();
+  cfg.set("caf.net.multiplexer-threads", 3);
+  actor_system sys{cfg};
+  auto& mm = sys.network_manager();
+  require_eq(mm.num_mpx(), 3u);
+  check_eq(mm.mpx_ptr(), mm.mpx_ptr(0));
+  std::set<net::multiplexer*> selected;
+  for (size_t i = 0; i < 3; ++i)
+    selected.insert(mm.mpx().select_for_connection());
+  check_eq(selected.size(), 3u);
+  for (size_t i = 0; i < 3; ++i)
+    check_eq(selected.count(mm.mpx_ptr(i)), 1u);
+}
+
+TEST("servers accept connections on all multiplexer threads") {
+  actor_system_config cfg;
+  cfg.load<net::middleman>();
+  cfg.set("caf.net.multiplexer-threads", 3);
+  actor_system sys{cfg};
+  auto acc = net::make_tcp_accept_socket(0, "127.0.0.1");
+  require(acc.has_value());
+  auto port = net::local_port(*acc);
+  require(port.has_value());
+  // Start a server that echoes all frames back to the client.
+  auto server
+    = net::lp::with(sys)
+        .accept(*acc)
+        .start([&sys](auto events) {
+          sys.spawn([events](event_based_actor* self) {
+            events.observe_on(self).for_each([self](const auto& event) {
+              auto& [pull, push] = event.data();
+              pull.observe_on(self).subscribe(push);
+            });
+          });
+        });
+  require(server.has_value());
+  std::vector<net::stream_socket> clients;
+  for (int i = 0; i < 6; ++i) {
+    auto conn = net::make_connected_tcp_stream_socket("127.0.0.1", *port);
+    require(conn.has_value());
+    require(!net::nonblocking(*conn, false));
+    clients.push_back(*conn);
+  }
+  for (size_t i = 0; i < clients.size(); ++i) {
+    auto msg = encode("hello " + std::to_string(i));
+    check_eq(net::write(clients[i], msg), static_cast<ptrdiff_t>(msg.size()));
+  }
+  for (size_t i = 0; i < clients.size(); ++i) {
+    auto msg = encode("hello " + std::to_string(i));
+    check_eq(read_exactly(clients[i], msg.size()), msg);
+    net::close(clients[i]);
+  }
+  server->dispose();
+}
@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cerrno>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
@@ -39,6 +40,8 @@
 #include <mutex>
 #include <optional>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #ifndef CAF_WINDOWS
 #  include <poll.h>
@@ -47,6 +50,11 @@
 #  include "caf/internal/socket_sys_includes.hpp"
 #endif // CAF_WINDOWS
 
+#ifdef CAF_LINUX
+#  include <sys/epoll.h>
+#  include <unistd.h>
+#endif // CAF_LINUX
+
 namespace caf::net {
 
 namespace {
@@ -128,7 +136,8 @@ private:
   size_t buf_size_ = 0;
 };
 
-/// Multiplexes any number of ::socket_manager objects with a ::socket.
+/// Implements the platform-independent parts of a multiplexer. Subclasses
+/// implement the bookkeeping for registered sockets and waiting for events.
 class default_multiplexer : public detail::atomic_ref_counted,
                             public multiplexer {
 public:
@@ -141,10 +150,6 @@ public:
 
   using poll_update_map = unordered_flat_map<socket, poll_update>;
 
-  using pollfd_list = std::vector<pollfd>;
-
-  using manager_list = std::vector<socket_manager_ptr>;
-
   // -- friends ----------------------------------------------------------------
 
   friend class pollset_updater; // Needs access to the `do_*` functions.
@@ -168,15 +173,12 @@ public:
       return err;
     }
     write_handle_ = pipe_handles->second;
-    pollset_.emplace_back(pollfd{pipe_handles->first.id, input_mask, 0});
-    managers_.emplace_back(mgr);
+    updater_fd_ = pipe_handles->first;
+    poll_update entry{input_mask, std::move(mgr)};
+    add_registration(updater_fd_, entry);
     return none;
   }
 
-  size_t num_socket_managers() const noexcept override {
-    return managers_.size();
-  }
-
   middleman& owner() override {
     CAF_ASSERT(owner_ != nullptr);
     return *owner_;
@@ -185,6 +187,12 @@ public:
     return owner().system();
   }
 
+  multiplexer* select_for_connection() noexcept override {
+    if (owner_ == nullptr)
+      return this;
+    return owner_->next_mpx_ptr();
+  }
+
   // -- implementation of execution_context ------------------------------------
 
   void ref_execution_context() const noexcept override {
@@ -279,7 +287,7 @@ public:
 
   bool poll_once(bool blocking) override {
     auto lg = log::net::trace("blocking = {}", blocking);
-    if (pollset_.empty())
+    if (num_socket_managers() == 0)
       return false;
     // We'll call poll() until poll() succeeds or fails.
     for (;;) {
@@ -297,33 +305,9 @@ public:
           timeout = std::max(1, static_cast<int>(ms));
         }
       }
-      int presult =
-#ifdef CAF_WINDOWS
-        ::WSAPoll(pollset_.data(), static_cast<ULONG>(pollset_.size()),
-                  timeout);
-#else
-        ::poll(pollset_.data(), static_cast<nfds_t>(pollset_.size()), timeout);
-#endif
+      auto presult = wait_for_events(timeout);
       if (presult > 0) {
-        log::net::debug("poll() on {} sockets reported event(s) {}",
-                        pollset_.size(), presult);
-        // Scan pollset for events.
-        if (auto revents = pollset_[0].revents; revents != 0) {
-          // Index 0 is always the pollset updater. This is the only handler
-          // that is allowed to modify pollset_ and managers_. Since this may
-          // very well mess with the for loop below, we process this handler
-          // first.
-          auto mgr = managers_[0];
-          handle(mgr, pollset_[0].events, revents);
-          --presult;
-        }
-        apply_updates();
-        for (size_t i = 1; i < pollset_.size() && presult > 0; ++i) {
-          if (auto revents = pollset_[i].revents; revents != 0) {
-            handle(managers_[i], pollset_[i].events, revents);
-            --presult;
-          }
-        }
+        dispatch_events(presult);
         run_timeouts();
         return true;
       }
@@ -349,7 +333,7 @@ public:
           // Must not happen.
           auto int_code = static_cast<int>(code);
           auto msg = std::generic_category().message(int_code);
-          std::string_view prefix = "poll() failed: ";
+          std::string_view prefix = "waiting for socket events failed: ";
           msg.insert(msg.begin(), prefix.begin(), prefix.end());
           CAF_CRITICAL(msg.c_str());
         }
@@ -375,18 +359,13 @@ public:
     for (;;) {
       if (!updates_.empty()) {
         for (auto& [fd, update] : updates_) {
-          if (auto index = index_of(fd); index == -1) {
-            if (update.events != 0) {
-              pollfd new_entry{socket_cast<socket_id>(fd), update.events, 0};
-              pollset_.emplace_back(new_entry);
-              managers_.emplace_back(std::move(update.mgr));
-            }
+          if (!is_registered(fd)) {
+            if (update.events != 0)
+              add_registration(fd, update);
           } else if (update.events != 0) {
-            pollset_[index].events = update.events;
-            managers_[index].swap(update.mgr);
+            modify_registration(fd, update);
           } else {
-            pollset_.erase(pollset_.begin() + index);
-            managers_.erase(managers_.begin() + index);
+            remove_registration(fd);
           }
         }
         updates_.clear();
@@ -415,7 +394,7 @@ public:
     // need to block the signal at thread level since some APIs (such as
     // OpenSSL) are unsafe to call otherwise.
     block_sigpipe();
-    while (!shutting_down_ || pollset_.size() > 1 || !watched_.empty()) {
+    while (!shutting_down_ || num_socket_managers() > 1 || !watched_.empty()) {
       poll_once(true);
       disposable::erase_disposed(watched_);
     }
@@ -435,9 +414,7 @@ public:
     log::net::debug("initiate shutdown");
     shutting_down_ = true;
     apply_updates();
-    // Skip the first manager (the pollset updater).
-    for (size_t i = 1; i < managers_.size(); ++i)
-      managers_[i]->dispose();
+    dispose_managers();
     apply_updates();
   }
 
@@ -457,23 +434,6 @@ public:
 
   // -- utility functions ------------------------------------------------------
 
-  /// Returns the index of `mgr` in the pollset or `-1`.
-  ptrdiff_t index_of(const socket_manager_ptr& mgr) const noexcept {
-    auto first = managers_.begin();
-    auto last = managers_.end();
-    auto i = std::find(first, last, mgr);
-    return i == last ? -1 : std::distance(first, i);
-  }
-
-  /// Returns the index of `fd` in the pollset or `-1`.
-  ptrdiff_t index_of(socket fd) const noexcept {
-    auto first = pollset_.begin();
-    auto last = pollset_.end();
-    auto i = std::find_if(first, last,
-                          [fd](const pollfd& x) { return x.fd == fd.id; });
-    return i == last ? -1 : std::distance(first, i);
-  }
-
   /// Handles an I/O event on given manager.
   void handle(const socket_manager_ptr& mgr, [[maybe_unused]] short events,
               short revents) {
@@ -506,30 +466,14 @@ public:
     }
   }
 
-  /// Returns a change entry for the socket at given index. Lazily creates a new
-  /// entry before returning if necessary.
-  poll_update& update_for(ptrdiff_t index) {
-    auto fd = socket{pollset_[index].fd};
-    if (auto i = updates_.find(fd); i != updates_.end()) {
-      return i->second;
-    } else {
-      updates_.container().emplace_back(fd, poll_update{pollset_[index].events,
-                                                        managers_[index]});
-      return updates_.container().back().second;
-    }
-  }
-
   /// Returns a change entry for the socket of the manager.
   poll_update& update_for(socket_manager* mgr) {
     auto fd = mgr->handle();
     if (auto i = updates_.find(fd); i != updates_.end()) {
       return i->second;
-    } else if (auto index = index_of(fd); index != -1) {
-      updates_.container().emplace_back(
-        fd, poll_update{pollset_[index].events, socket_manager_ptr{mgr}});
-      return updates_.container().back().second;
     } else {
-      updates_.container().emplace_back(fd, poll_update{0, mgr});
+      updates_.container().emplace_back(
+        fd, poll_update{registered_events(fd), socket_manager_ptr{mgr}});
       return updates_.container().back().second;
     }
   }
@@ -568,13 +512,9 @@ public:
   /// Queries the currently active event bitmask for `mgr`.
   short active_mask_of(const socket_manager* mgr) const noexcept {
     auto fd = mgr->handle();
-    if (auto i = updates_.find(fd); i != updates_.end()) {
+    if (auto i = updates_.find(fd); i != updates_.end())
       return i->second.events;
-    } else if (auto index = index_of(fd); index != -1) {
-      return pollset_[index].events;
-    } else {
-      return 0;
-    }
+    return registered_events(fd);
   }
 
   /// Pending actions to run immediately.
@@ -586,15 +526,48 @@ public:
   /// Scheduled actions.
   scheduled_actions_map scheduled_actions;
 
-private:
-  // -- member variables -------------------------------------------------------
+protected:
+  // -- bookkeeping for registered sockets -------------------------------------
 
-  /// Bookkeeping data for managed sockets.
-  pollfd_list pollset_;
+  /// Queries whether `fd` is currently registered.
+  virtual bool is_registered(socket fd) const noexcept = 0;
 
-  /// Maps sockets to their owning managers by storing the managers in the same
-  /// order as their sockets appear in `pollset_`.
-  manager_list managers_;
+  /// Returns the events that are currently registered for `fd`.
+  virtual short registered_events(socket fd) const noexcept = 0;
+
+  /// Registers `fd` for the events in `update`.
+  /// @pre `!is_registered(fd) && update.events != 0`
+  virtual void add_registration(socket fd, poll_update& update) = 0;
+
+  /// Sets the events and the manager of `fd` to the values in `update`.
+  /// @pre `is_registered(fd) && update.events != 0`
+  virtual void modify_registration(socket fd, poll_update& update) = 0;
+
+  /// Removes `fd` from the set of registered sockets.
+  /// @pre `is_registered(fd)`
+  virtual void remove_registration(socket fd) = 0;
+
+  /// Calls `dispose` on all managers except the pollset updater.
+  virtual void dispose_managers() = 0;
+
+  // -- waiting for events -----------------------------------------------------
+
+  /// Waits for events on the registered sockets for up to `timeout`
+  /// milliseconds or indefinitely if `timeout` is -1. Returns the number of
+  /// sockets with pending events, 0 on timeout or -1 on error.
+  virtual int wait_for_events(int timeout) = 0;
+
+  /// Runs the socket event handlers for the `num_events` sockets that
+  /// `wait_for_events` has reported. Implementations must run the pollset
+  /// updater first and then call `apply_updates` before running any other
+  /// handler.
+  virtual void dispatch_events(int num_events) = 0;
+
+  /// Reads from the pipe of the pollset updater.
+  socket updater_fd_;
+
+private:
+  // -- member variables -------------------------------------------------------
 
   /// Caches changes to the events mask of managed sockets until they can safely
   /// take place.
@@ -620,6 +593,285 @@ private:
   std::vector<disposable> watched_;
 };
 
+/// Waits for events on all sockets with a single call to `poll()`. Available
+/// on all platforms.
+class poll_multiplexer final : public default_multiplexer {
+public:
+  // -- member types -----------------------------------------------------------
+
+  using super = default_multiplexer;
+
+  using pollfd_list = std::vector<pollfd>;
+
+  using manager_list = std::vector<socket_manager_ptr>;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  using super::super;
+
+  // -- properties -------------------------------------------------------------
+
+  size_t num_socket_managers() const noexcept override {
+    return managers_.size();
+  }
+
+protected:
+  // -- bookkeeping for registered sockets -------------------------------------
+
+  bool is_registered(socket fd) const noexcept override {
+    return index_of(fd) != -1;
+  }
+
+  short registered_events(socket fd) const noexcept override {
+    if (auto index = index_of(fd); index != -1)
+      return pollset_[index].events;
+    return 0;
+  }
+
+  void add_registration(socket fd, poll_update& update) override {
+    pollfd new_entry{socket_cast<socket_id>(fd), update.events, 0};
+    pollset_.emplace_back(new_entry);
+    managers_.emplace_back(std::move(update.mgr));
+  }
+
+  void modify_registration(socket fd, poll_update& update) override {
+    auto index = index_of(fd);
+    pollset_[index].events = update.events;
+    managers_[index].swap(update.mgr);
+  }
+
+  void remove_registration(socket fd) override {
+    auto index = index_of(fd);
+    pollset_.erase(pollset_.begin() + index);
+    managers_.erase(managers_.begin() + index);
+  }
+
+  void dispose_managers() override {
+    // Skip the first manager (the pollset updater).
+    for (size_t i = 1; i < managers_.size(); ++i)
+      managers_[i]->dispose();
+  }
+
+  // -- waiting for events -----------------------------------------------------
+
+  int wait_for_events(int timeout) override {
+#ifdef CAF_WINDOWS
+    return ::WSAPoll(pollset_.data(), static_cast<ULONG>(pollset_.size()),
+                     timeout);
+#else
+    return ::poll(pollset_.data(), static_cast<nfds_t>(pollset_.size()),
+                  timeout);
+#endif
+  }
+
+  void dispatch_events(int presult) override {
+    log::net::debug("poll() on {} sockets reported event(s) {}",
+                    pollset_.size(), presult);
+    // Scan pollset for events.
+    if (auto revents = pollset_[0].revents; revents != 0) {
+      // Index 0 is always the pollset updater. This is the only handler that
+      // is allowed to modify pollset_ and managers_. Since this may very well
+      // mess with the for loop below, we process this handler first.
+      auto mgr = managers_[0];
+      handle(mgr, pollset_[0].events, revents);
+      --presult;
+    }
+    apply_updates();
+    for (size_t i = 1; i < pollset_.size() && presult > 0; ++i) {
+      if (auto revents = pollset_[i].revents; revents != 0) {
+        handle(managers_[i], pollset_[i].events, revents);
+        --presult;
+      }
+    }
+  }
+
+private:
+  /// Returns the index of `fd` in the pollset or `-1`.
+  ptrdiff_t index_of(socket fd) const noexcept {
+    auto first = pollset_.begin();
+    auto last = pollset_.end();
+    auto i = std::find_if(first, last,
+                          [fd](const pollfd& x) { return x.fd == fd.id; });
+    return i == last ? -1 : std::distance(first, i);
+  }
+
+  /// Bookkeeping data for managed sockets.
+  pollfd_list pollset_;
+
+  /// Maps sockets to their owning managers by storing the managers in the same
+  /// order as their sockets appear in `pollset_`.
+  manager_list managers_;
+};
+
+#ifdef CAF_LINUX
+
+// The epoll flags share their values with the poll flags on Linux. Hence, we
+// can pass the event masks back and forth without converting them.
+static_assert(EPOLLIN == POLLIN && EPOLLPRI == POLLPRI && EPOLLOUT == POLLOUT
+              && EPOLLERR == POLLERR && EPOLLHUP == POLLHUP);
+
+/// Waits for events with `epoll_wait()`. Unlike `poll()`, the kernel keeps
+/// track of the registered sockets and only reports ready sockets. Hence, the
+/// cost for waiting and dispatching no longer grows with the number of idle
+/// sockets. Available on Linux only.
+class epoll_multiplexer final : public default_multiplexer {
+public:
+  // -- member types -----------------------------------------------------------
+
+  using super = default_multiplexer;
+
+  using registration_map = std::unordered_map<socket_id, poll_update>;
+
+  // -- constants --------------------------------------------------------------
+
+  /// Number of events that we retrieve initially per call to `epoll_wait()`.
+  static constexpr size_t initial_event_buffer_size = 64;
+
+  /// Maximum number of events that we retrieve per call to `epoll_wait()`.
+  static constexpr size_t max_event_buffer_size = 4096;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  using super::super;
+
+  ~epoll_multiplexer() override {
+    if (epoll_fd_ != -1)
+      ::close(epoll_fd_);
+  }
+
+  // -- implementation of caf::net::multiplexer --------------------------------
+
+  error init() override {
+    epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd_ == -1)
+      return make_error(sec::network_syscall_failed, "epoll_create1",
+                        last_socket_error_as_string());
+    events_.resize(initial_event_buffer_size);
+    return super::init();
+  }
+
+  size_t num_socket_managers() const noexcept override {
+    return registrations_.size();
+  }
+
+protected:
+  // -- bookkeeping for registered sockets -------------------------------------
+
+  bool is_registered(socket fd) const noexcept override {
+    return registrations_.count(fd.id) != 0;
+  }
+
+  short registered_events(socket fd) const noexcept override {
+    if (auto i = registrations_.find(fd.id); i != registrations_.end())
+      return i->second.events;
+    return 0;
+  }
+
+  void add_registration(socket fd, poll_update& update) override {
+    if (!ctl(EPOLL_CTL_ADD, fd, update.events)) {
+      // Report the error asynchronously, because the handler may update the
+      // registrations while we iterate them.
+      log::system::error("failed to add socket {} to epoll: {}", fd.id,
+                         last_socket_error_as_string());
+      pending_actions.push_back(make_action([mgr = std::move(update.mgr)] {
+        mgr->handle_error(sec::socket_operation_failed);
+      }));
+      return;
+    }
+    registrations_.emplace(fd.id,
+                           poll_update{update.events, std::move(update.mgr)});
+  }
+
+  void modify_registration(socket fd, poll_update& update) override {
+    auto& entry = registrations_.find(fd.id)->second;
+    // A different manager means that the previous manager closed the socket
+    // and the OS reused its descriptor. Closing a socket removes it from the
+    // epoll set. Hence, we need to add the descriptor again in this case.
+    if (entry.events != update.events || entry.mgr != update.mgr) {
+      if (!ctl(EPOLL_CTL_MOD, fd, update.events)
+          && (errno != ENOENT || !ctl(EPOLL_CTL_ADD, fd, update.events)))
+        log::system::error("failed to modify socket {} in epoll: {}", fd.id,
+                           last_socket_error_as_string());
+    }
+    entry.events = update.events;
+    entry.mgr.swap(update.mgr);
+  }
+
+  void remove_registration(socket fd) override {
+    // Note: closing a socket removes it from the epoll set automatically.
+    // Hence, errors here are expected if the manager has closed its socket
+    // already.
+    if (!ctl(EPOLL_CTL_DEL, fd, 0))
+      log::net::debug("failed to remove socket {} from epoll: {}", fd.id,
+                      last_socket_error_as_string());
+    registrations_.erase(fd.id);
+  }
+
+  void dispose_managers() override {
+    for (auto& [fd, entry] : registrations_)
+      if (fd != updater_fd_.id)
+        entry.mgr->dispose();
+  }
+
+  // -- waiting for events -----------------------------------------------------
+
+  int wait_for_events(int timeout) override {
+    return ::epoll_wait(epoll_fd_, events_.data(),
+                        static_cast<int>(events_.size()), timeout);
+  }
+
+  void dispatch_events(int num_events) override {
+    log::net::debug("epoll_wait() on {} sockets reported event(s) {}",
+                    registrations_.size(), num_events);
+    auto first = events_.begin();
+    auto last = first + num_events;
+    // Run the pollset updater first, because it is the only handler that may
+    // add or remove registrations right away (see poll_multiplexer).
+    auto is_updater = [this](const epoll_event& ev) {
+      return ev.data.fd == updater_fd_.id;
+    };
+    if (auto i = std::find_if(first, last, is_updater); i != last)
+      dispatch(*i);
+    apply_updates();
+    for (auto i = first; i != last; ++i)
+      if (!is_updater(*i))
+        dispatch(*i);
+    // Grow the buffer if `epoll_wait()` filled it completely.
+    if (static_cast<size_t>(num_events) == events_.size()
+        && events_.size() < max_event_buffer_size)
+      events_.resize(events_.size() * 2);
+  }
+
+private:
+  /// Runs the handler for the socket in `ev`, unless the socket has been
+  /// removed from the epoll set in the meantime.
+  void dispatch(const epoll_event& ev) {
+    if (auto i = registrations_.find(ev.data.fd); i != registrations_.end()) {
+      auto revents = static_cast<short>(ev.events);
+      handle(i->second.mgr, i->second.events, revents);
+    }
+  }
+
+  /// Calls `epoll_ctl` for `fd`.
+  bool ctl(int op, socket fd, short events) {
+    epoll_event ev;
+    ev.events = static_cast<uint32_t>(static_cast<unsigned short>(events));
+    ev.data.fd = fd.id;
+    return ::epoll_ctl(epoll_fd_, op, fd.id, &ev) == 0;
+  }
+
+  /// The file descriptor for the epoll instance.
+  int epoll_fd_ = -1;
+
+  /// Stores the events and managers of all registered sockets.
+  registration_map registrations_;
+
+  /// Receives the events from `epoll_wait()`.
+  std::vector<epoll_event> events_;
+};
+
+#endif // CAF_LINUX
+
 error pollset_updater::start(socket_manager* owner) {
   auto lg = log::net::trace("");
   owner_ = owner;
@@ -705,7 +957,20 @@ void multiplexer::block_sigpipe() {
 }
 
 multiplexer_ptr multiplexer::make(middleman* parent) {
-  return make_counted<default_multiplexer>(parent);
+  return make_counted<poll_multiplexer>(parent);
+}
+
+multiplexer_ptr multiplexer::make(middleman* parent, std::string_view backend) {
+  if (backend == "poll")
+    return make_counted<poll_multiplexer>(parent);
+#ifdef CAF_LINUX
+  if (backend == "epoll")
+    return make_counted<epoll_multiplexer>(parent);
+#endif
+  log::system::warning("multiplexer backend {} is not available on this "
+                       "platform, falling back to poll",
+                       backend);
+  return make_counted<poll_multiplexer>(parent);
 }
 
 multiplexer* multiplexer::from(actor_system& sys) {
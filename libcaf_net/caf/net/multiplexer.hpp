@@ -13,6 +13,7 @@
 #include <deque>
 #include <memory>
 #include <mutex>
+#include <string_view>
 #include <thread>
 
 namespace caf::net {
@@ -49,6 +50,14 @@ public:
   ///               @ref actor_system.
   static multiplexer_ptr make(middleman* parent);
 
+  /// Creates a new multiplexer instance with the implementation selected by
+  /// `backend`. Supported backends are `poll` (all platforms) and `epoll`
+  /// (Linux only). Falls back to `poll` for unavailable backends.
+  /// @param parent Points to the owning middleman instance. May be `nullptr`
+  ///               only for the purpose of unit testing.
+  /// @param backend The name of the implementation.
+  static multiplexer_ptr make(middleman* parent, std::string_view backend);
+
   // -- initialization ---------------------------------------------------------
 
   virtual error init() = 0;
@@ -78,6 +87,12 @@ public:
   /// Returns the enclosing @ref actor_system.
   virtual actor_system& system() = 0;
 
+  /// Returns the multiplexer for running a connection that a socket manager of
+  /// this multiplexer has accepted. Returns `this` unless the owning
+  /// @ref middleman runs multiple multiplexers, in which case the middleman
+  /// assigns connections in round-robin order.
+  virtual multiplexer* select_for_connection() noexcept = 0;
+
   // -- thread-safe signaling --------------------------------------------------
 
   /// Registers `mgr` for initialization in the multiplexer's thread.
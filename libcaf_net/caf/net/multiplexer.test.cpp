@@ -20,6 +20,7 @@
 #include <new>
 #include <string_view>
 #include <tuple>
+#include <vector>
 
 using namespace caf;
 
@@ -76,6 +77,7 @@ public:
   }
 
   void handle_read_event() override {
+    ++read_events;
     if (read_capacity() < 1024)
       rd_buf_.resize(rd_buf_.size() + 2048);
     auto res = read(fd_, make_span(read_position_begin(), read_capacity()));
@@ -88,6 +90,7 @@ public:
   }
 
   void handle_write_event() override {
+    ++write_events;
     if (wr_buf_.size() == 0) {
       mgr_->deregister_writing();
     } else if (auto res = write(fd_, wr_buf_); res > 0) {
@@ -107,6 +110,12 @@ public:
 
   error abort_reason;
 
+  /// Counts how many times the multiplexer called `handle_read_event`.
+  size_t read_events = 0;
+
+  /// Counts how many times the multiplexer called `handle_write_event`.
+  size_t write_events = 0;
+
 private:
   std::byte* read_position_begin() {
     return rd_buf_.data() + rd_buf_pos_;
@@ -133,7 +142,12 @@ private:
 };
 
 struct fixture {
-  fixture() : mpx(net::multiplexer::make(nullptr)) {
+  fixture() : fixture("poll") {
+    // nop
+  }
+
+  explicit fixture(std::string_view backend)
+    : mpx(net::multiplexer::make(nullptr, backend)) {
     manager_count = std::make_shared<std::atomic<size_t>>(0);
     mpx->set_thread_id();
   }
@@ -175,6 +189,12 @@ struct fixture {
   net::multiplexer_ptr mpx;
 };
 
+struct epoll_fixture : fixture {
+  epoll_fixture() : fixture("epoll") {
+    // nop
+  }
+};
+
 template <class T>
 T unbox(caf::expected<T> x) {
   if (!x)
@@ -295,3 +315,103 @@ SCENARIO("a multiplexer terminates its thread after shutting down") {
 // }
 
 } // WITH_FIXTURE(fixture)
+
+#ifdef CAF_LINUX
+
+WITH_FIXTURE(epoll_fixture) {
+
+SCENARIO("the epoll multiplexer constructs the pollset updater") {
+  GIVEN("an initialized multiplexer") {
+    WHEN("querying the number of socket managers") {
+      THEN("the result is 1") {
+        check_eq(mpx->num_socket_managers(), 0u);
+        check_eq(mpx->init(), none);
+        exhaust();
+        check_eq(mpx->num_socket_managers(), 1u);
+      }
+    }
+  }
+}
+
+SCENARIO("the epoll multiplexer runs callbacks on socket activity") {
+  GIVEN("an initialized multiplexer with many idle socket managers") {
+    init();
+    std::vector<mock_event_layer*> idle_layers;
+    std::vector<net::socket_manager_ptr> idle_mgrs;
+    for (int i = 0; i < 100; ++i) {
+      auto [fd1, fd2] = unbox(net::make_stream_socket_pair());
+      for (auto fd : {fd1, fd2}) {
+        auto [layer, mgr] = make_manager(fd, "idle");
+        mgr->register_reading();
+        idle_layers.push_back(layer);
+        idle_mgrs.push_back(mgr);
+      }
+    }
+    apply_updates();
+    check_eq(mpx->num_socket_managers(), 201u);
+    WHEN("two socket managers exchange data") {
+      auto [alice_fd, bob_fd] = unbox(net::make_stream_socket_pair());
+      auto [alice, alice_mgr] = make_manager(alice_fd, "Alice");
+      auto [bob, bob_mgr] = make_manager(bob_fd, "Bob");
+      alice_mgr->register_reading();
+      bob_mgr->register_reading();
+      apply_updates();
+      check_eq(mpx->num_socket_managers(), 203u);
+      THEN("only the managers with pending events receive callbacks") {
+        alice->send("Hello Bob!");
+        alice_mgr->register_writing();
+        exhaust();
+        check_eq(bob->receive(), "Hello Bob!");
+        check(!mpx->is_writing(alice_mgr.get()));
+        bob->send("Hello Alice!");
+        bob_mgr->register_writing();
+        exhaust();
+        check_eq(alice->receive(), "Hello Alice!");
+        check_gt(bob->read_events, 0u);
+        check_gt(alice->read_events, 0u);
+        auto idle_events = size_t{0};
+        for (auto* layer : idle_layers)
+          idle_events += layer->read_events + layer->write_events;
+        check_eq(idle_events, 0u);
+      }
+    }
+    WHEN("socket managers deregister") {
+      for (auto& mgr : idle_mgrs)
+        mgr->deregister();
+      apply_updates();
+      THEN("the multiplexer removes them from the epoll set") {
+        check_eq(mpx->num_socket_managers(), 1u);
+      }
+    }
+  }
+}
+
+SCENARIO("the epoll multiplexer terminates its thread after shutting down") {
+  GIVEN("a multiplexer running in its own thread and some socket managers") {
+    init();
+    auto go_time = std::make_shared<detail::latch>(2);
+    auto mpx_thread = std::thread{[this, go_time] {
+      mpx->set_thread_id();
+      go_time->count_down_and_wait();
+      mpx->run();
+    }};
+    go_time->count_down_and_wait();
+    auto [alice_fd, bob_fd] = unbox(net::make_stream_socket_pair());
+    auto [alice, alice_mgr] = make_manager(alice_fd, "Alice");
+    auto [bob, bob_mgr] = make_manager(bob_fd, "Bob");
+    alice_mgr->register_reading();
+    bob_mgr->register_reading();
+    WHEN("calling shutdown on the multiplexer") {
+      mpx->shutdown();
+      THEN("the thread terminates and all socket managers get shut down") {
+        mpx_thread.join();
+        check(alice_mgr->disposed());
+        check(bob_mgr->disposed());
+      }
+    }
+  }
+}
+
+} // WITH_FIXTURE(epoll_fixture)
+
+#endif // CAF_LINUX
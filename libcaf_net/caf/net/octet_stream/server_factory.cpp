@@ -79,7 +79,8 @@ public:
     auto transport = internal::make_transport(std::move(*conn),
                                               std::move(bridge));
     transport->active_policy().accept();
-    return net::socket_manager::make(parent_->mpx_ptr(), std::move(transport));
+    auto* mpx = parent_->mpx().select_for_connection();
+    return net::socket_manager::make(mpx, std::move(transport));
   }
 
 private:
@@ -105,6 +105,11 @@ public:
     return fix_->mail_count(owner_);
   }
 
+  size_t approximate_size() const noexcept override {
+    // Note: the deterministic fixture runs all actors in the same thread.
+    return fix_->mail_count(owner_);
+  }
+
   void ref_mailbox() noexcept override {
     ref();
   }
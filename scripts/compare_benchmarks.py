@@ -0,0 +1,58 @@
+#!/usr/bin/env python
+
+# Compares two result files of caf-bench. Run the benchmarks with
+# "--benchmark_out=FILE --benchmark_out_format=json" once on the baseline and
+# once with the change under test, then pass both files to this script. The
+# output lists the time per iteration for each benchmark and the relative
+# change. Negative changes are improvements.
+
+# usage: compare_benchmarks.py [--threshold PERCENT] BASELINE CONTENDER
+
+import argparse, json, sys
+
+def load(path):
+    with open(path) as fp:
+        data = json.load(fp)
+    result = {}
+    for entry in data.get('benchmarks', []):
+        # With --benchmark_repetitions, only compare the mean.
+        if entry.get('run_type') == 'aggregate' \
+           and entry.get('aggregate_name') != 'mean':
+            continue
+        name = entry.get('run_name', entry['name'])
+        result[name] = (entry['real_time'], entry.get('time_unit', 'ns'))
+    return result
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare caf-bench results.')
+    parser.add_argument('baseline', help='JSON output of the baseline run')
+    parser.add_argument('contender', help='JSON output of the new run')
+    parser.add_argument('--threshold', type=float, default=0.0,
+                        help='only list changes of at least PERCENT percent')
+    args = parser.parse_args()
+    baseline = load(args.baseline)
+    contender = load(args.contender)
+    names = [name for name in baseline if name in contender]
+    if not names:
+        sys.stderr.write('no common benchmarks found\n')
+        sys.exit(1)
+    width = max(len(name) for name in names)
+    print('%-*s %14s %14s %9s' % (width, 'benchmark', 'baseline',
+                                  'contender', 'change'))
+    for name in names:
+        old, unit = baseline[name]
+        new, _ = contender[name]
+        change = (new - old) / old * 100.0 if old > 0 else 0.0
+        if abs(change) < args.threshold:
+            continue
+        print('%-*s %11.1f %s %11.1f %s %+8.1f%%' % (width, name, old, unit,
+                                                    new, unit, change))
+    for name in baseline:
+        if name not in contender:
+            print('%s: missing in %s' % (name, args.contender))
+    for name in contender:
+        if name not in baseline:
+            print('%s: missing in %s' % (name, args.baseline))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,151 @@
+#!/usr/bin/env python
+
+# Converts a log file in the binary format of CAF (caf.logger.file.binary) to
+# text. The output uses the default format for log files, i.e.,
+# "%r %c %p %a %t %M %F:%L %m%n", and thus works as input for
+# indent_trace_log.py.
+
+# usage (read file): decode_binary_log.py FILENAME
+#      (read stdin): decode_binary_log.py -
+
+import argparse, struct, sys
+
+MAGIC = b'CAFLOG'
+VERSION = 1
+
+STRING_RECORD = 1
+EVENT_RECORD = 2
+
+NULL_FIELD = 0
+BOOL_FIELD = 1
+INT_FIELD = 2
+UINT_FIELD = 3
+DOUBLE_FIELD = 4
+STRING_FIELD = 5
+LIST_FIELD = 6
+
+LEVEL_NAMES = {
+    200: 'ERROR',
+    300: 'WARN',
+    400: 'INFO',
+    500: 'DEBUG',
+    600: 'TRACE',
+}
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def at_end(self):
+        return self.pos >= len(self.data)
+
+    def byte(self):
+        if self.at_end():
+            raise EOFError('unexpected end of input')
+        result = self.data[self.pos]
+        self.pos += 1
+        return result
+
+    def raw(self, size):
+        if self.pos + size > len(self.data):
+            raise EOFError('unexpected end of input')
+        result = self.data[self.pos:self.pos + size]
+        self.pos += size
+        return result
+
+    def varint(self):
+        result = 0
+        shift = 0
+        while True:
+            x = self.byte()
+            result |= (x & 0x7f) << shift
+            if x & 0x80 == 0:
+                return result
+            shift += 7
+
+    def signed_varint(self):
+        x = self.varint()
+        return (x >> 1) ^ -(x & 1)
+
+    def string(self):
+        return self.raw(self.varint()).decode('utf-8', errors='replace')
+
+def render_fields(src, strings):
+    result = []
+    for _ in range(src.varint()):
+        key = strings[src.varint()]
+        tag = src.byte()
+        if tag == NULL_FIELD:
+            result.append(key + ' = null')
+        elif tag == BOOL_FIELD:
+            result.append(key + ' = ' + str(src.byte()))
+        elif tag == INT_FIELD:
+            result.append(key + ' = ' + str(src.signed_varint()))
+        elif tag == UINT_FIELD:
+            result.append(key + ' = ' + str(src.varint()))
+        elif tag == DOUBLE_FIELD:
+            result.append(key + ' = ' + '%g' % struct.unpack('<d', src.raw(8)))
+        elif tag == STRING_FIELD:
+            result.append(key + ' = ' + src.string())
+        elif tag == LIST_FIELD:
+            result.append(key + ' { ' + render_fields(src, strings) + ' }')
+        else:
+            raise ValueError('invalid field type: %d' % tag)
+    return ', '.join(result)
+
+def read_header(src):
+    if src.raw(len(MAGIC)) != MAGIC:
+        raise ValueError('not a binary CAF log')
+    version = src.byte()
+    if version != VERSION:
+        raise ValueError('unsupported version: %d' % version)
+    src.byte() # reserved
+    return src.signed_varint()
+
+def decode(data, out):
+    src = Reader(data)
+    strings = []
+    while not src.at_end():
+        tag = src.byte()
+        if tag == MAGIC[0]:
+            # The logger appends to existing files, so a file may contain the
+            # output of multiple runs.
+            src.pos -= 1
+            read_header(src)
+            strings = []
+        elif tag == STRING_RECORD:
+            if src.varint() != len(strings):
+                raise ValueError('unexpected string ID')
+            strings.append(src.string())
+        elif tag == EVENT_RECORD:
+            level = src.varint()
+            runtime_ms = src.signed_varint() // 1000000
+            aid = src.varint()
+            thread = strings[src.varint()]
+            component = strings[src.varint()]
+            file_name = strings[src.varint()]
+            line = src.varint()
+            function = strings[src.varint()]
+            msg = src.string()
+            fields = render_fields(src, strings)
+            if fields:
+                msg += ' ; ' + fields
+            out.write('%d %s %s actor%d %s %s %s:%d %s\n' % (
+                runtime_ms, component, LEVEL_NAMES.get(level, str(level)),
+                aid, thread, function, file_name, line, msg))
+        else:
+            raise ValueError('invalid record type: %d' % tag)
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode a binary CAF log.')
+    parser.add_argument("log", help='path to the log file or "-" for reading from STDIN')
+    args = parser.parse_args()
+    if args.log == '-':
+        decode(sys.stdin.buffer.read(), sys.stdout)
+    else:
+        with open(args.log, 'rb') as fp:
+            decode(fp.read(), sys.stdout)
+
+if __name__ == "__main__":
+    main()